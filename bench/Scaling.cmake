@@ -0,0 +1,71 @@
+# Runs mpbench over programs from mpgen that grow along one dimension at a
+# time, leaving the others at mpgen's defaults. Every program gets an mpbench
+# process of its own so that the peak memory column is its own. The results
+# are collected into OUTPUT, each file named <dimension>-<size>.pas.
+# Programs growing in procedures also get a run of mpbench --stream, whose
+# stream row shows the peak memory of compiling them straight from the
+# parser next to that of the other stages.
+#
+#   cmake -DMPGEN=... -DMPBENCH=... -DDIR=... -DOUTPUT=... [-DREPS=3]
+#         [-DWARMUP=1] -P Scaling.cmake
+
+if (NOT DEFINED REPS)
+    set(REPS 3)
+endif()
+if (NOT DEFINED WARMUP)
+    set(WARMUP 1)
+endif()
+
+set(procedures 10 20 40 80 160 320)
+set(statements 10 40 160 640 2560)
+set(depth 2 4 8 16 32)
+set(expr-length 4 16 64 256 1024)
+set(vars 4 16 64 256 1024)
+
+file(MAKE_DIRECTORY "${DIR}")
+set(header "")
+set(rows "")
+foreach (dimension IN ITEMS procedures statements depth expr-length vars)
+    foreach (size IN LISTS ${dimension})
+        set(program "${DIR}/${dimension}-${size}.pas")
+        message(STATUS "${dimension} ${size}")
+        execute_process(COMMAND "${MPGEN}" --${dimension}=${size}
+                        OUTPUT_FILE "${program}"
+                        RESULT_VARIABLE failed)
+        if (failed)
+            message(FATAL_ERROR "generating ${program} failed")
+        endif()
+
+        set(modes "")
+        if (dimension STREQUAL "procedures")
+            set(modes "--stream")
+        endif()
+        foreach (mode IN ITEMS "" ${modes})
+            string(REPLACE "--" "-" suffix "${mode}")
+            set(result "${DIR}/${dimension}-${size}${suffix}.tsv")
+            execute_process(COMMAND "${MPBENCH}" --reps=${REPS}
+                                    --warmup=${WARMUP} ${mode}
+                                    -o "${result}" "${program}"
+                            OUTPUT_QUIET
+                            RESULT_VARIABLE failed)
+            if (failed)
+                message(FATAL_ERROR "benchmarking ${program} ${mode} failed")
+            endif()
+
+            file(STRINGS "${result}" lines)
+            foreach (line IN LISTS lines)
+                if (line MATCHES "^#" OR line MATCHES "^file\t")
+                    if (NOT header_done)
+                        string(APPEND header "${line}\n")
+                    endif()
+                else()
+                    string(APPEND rows "${line}\n")
+                endif()
+            endforeach()
+            set(header_done TRUE)
+        endforeach()
+    endforeach()
+endforeach()
+
+file(WRITE "${OUTPUT}" "${header}${rows}")
+message(STATUS "Wrote ${OUTPUT}")
@@ -0,0 +1,433 @@
+// Measures how fast the compiler gets through a corpus of programs:
+//
+//   mpbench [--reps=N] [--warmup=N] [--stream] [-o results.tsv] file...
+//
+// Every file goes through each stage of the compiler on its own, warm-up runs
+// first, and the measured runs are summarized per stage:
+//
+//   lex       gettok over the whole file                   tokens/s
+//   parse     ParseProgram for every program in the file   nodes/s
+//   codegen   GenIRVisitor without function passes         nodes/s
+//   optimize  function passes and runtime helper inlining, timed around
+//             the pass managers                            nodes/s
+//   codegen-cold
+//             codegen with an LLVMContext and pass managers of its own
+//             for every program, as without a CompilerSession nodes/s
+//   jit       adding the optimized module to a fresh JITDylib and looking up
+//             its entry point                              programs/s
+//   stream    parsing, generating and JIT-compiling each program with its
+//             procedures compiled as soon as they are parsed, as
+//             micropascal --stream does                    programs/s
+//
+// The other stages share one CompilerSession across all programs, the way
+// the compiler does, so codegen-cold minus codegen is the setup the session
+// saves. --programs-per-context sets how often it starts a new context.
+// --stream runs the stream stage instead of all the others, so that the peak
+// memory column shows what streaming needs and can be compared with that of
+// a run without it.
+//
+// Programs are compiled but never run. The results file is tab separated,
+// one line per file and stage, with columns that will only ever be appended
+// to so that runs of different versions can be compared. The peak memory
+// column is the process's high-water mark once a file is done, so it belongs
+// to that file only when mpbench is given one file at a time.
+
+#include <sys/resource.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "codegen/codegen.h"
+#include "harness.h"
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "lexer/lexer.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/TargetSelect.h"
+#include "logger/logger.h"
+#include "parser/parser.h"
+#include "symbols/symbols.h"
+
+static llvm::cl::list<std::string> Files(llvm::cl::Positional,
+                                         llvm::cl::desc("<file>..."),
+                                         llvm::cl::OneOrMore);
+static llvm::cl::opt<unsigned> Reps(
+    "reps", llvm::cl::desc("Measured runs of every stage"),
+    llvm::cl::init(10));
+static llvm::cl::opt<unsigned> Warmup(
+    "warmup", llvm::cl::desc("Unmeasured runs before the measured ones"),
+    llvm::cl::init(2));
+static llvm::cl::opt<unsigned> ProgramsPerContext(
+    "programs-per-context",
+    llvm::cl::desc("Programs compiled in one LLVMContext before the session "
+                   "starts a new one"),
+    llvm::cl::init(CompilerSession::DefaultProgramsPerContext));
+static llvm::cl::opt<bool> Streamed(
+    "stream", llvm::cl::desc("Measure the stream stage instead of the others"));
+static llvm::cl::opt<std::string> OutputFilename(
+    "o", llvm::cl::desc("Where to write the results"),
+    llvm::cl::value_desc("filename"), llvm::cl::init("bench-results.tsv"));
+
+static llvm::ExitOnError ExitOnErr;
+
+// Bumped when a column changes meaning, never when one is appended
+static const int FormatVersion = 1;
+
+// Counts every node of a tree
+class NodeCounter : public ASTVisitor {
+   public:
+    uint64_t Count = 0;
+
+    virtual void Visit(NumberExprAST &) override { Count++; }
+    virtual void Visit(ConcreteBoolExprAST &) override { Count++; }
+    virtual void Visit(StringExprAST &) override { Count++; }
+    virtual void Visit(VariableExprAST &) override { Count++; }
+    virtual void Visit(BinaryExprAST &E) override {
+        Count++;
+        E.GetLeft().Accept(*this);
+        E.GetRight().Accept(*this);
+    }
+    virtual void Visit(CallExprAST &E) override {
+        Count++;
+        for (auto &Arg : E.GetArgs()) {
+            Arg->Accept(*this);
+        }
+    }
+    virtual void Visit(StatementCallExprAST &E) override {
+        Count++;
+        for (auto &Arg : E.GetArgs()) {
+            Arg->Accept(*this);
+        }
+    }
+    virtual void Visit(IfStatementAST &S) override {
+        Count++;
+        S.GetCond().Accept(*this);
+        S.GetThen().Accept(*this);
+        if (S.HasElse()) {
+            S.GetElse().Accept(*this);
+        }
+    }
+    virtual void Visit(ForStatementAST &S) override {
+        Count++;
+        S.GetStart().Accept(*this);
+        S.GetEnd().Accept(*this);
+        S.GetBody().Accept(*this);
+    }
+    virtual void Visit(VariableAssignmentAST &S) override {
+        Count++;
+        S.GetValue().Accept(*this);
+    }
+    virtual void Visit(VariableDeclAST &) override { Count++; }
+    virtual void Visit(PrototypeAST &P) override {
+        Count++;
+        for (auto &Param : P.GetParameters()) {
+            Param->Accept(*this);
+        }
+    }
+    virtual void Visit(DeclarationAST &D) override {
+        Count++;
+        for (auto &Decl : D.GetVarDeclarations()) {
+            Decl->Accept(*this);
+        }
+    }
+    virtual void Visit(CompoundStatementAST &S) override {
+        Count++;
+        for (auto &Statement : S.GetStatements()) {
+            Statement->Accept(*this);
+        }
+    }
+    virtual void Visit(BlockAST &B) override {
+        Count++;
+        B.GetDeclaration().Accept(*this);
+        B.GetCompoundStatementAST().Accept(*this);
+    }
+    virtual void Visit(FunctionAST &F) override {
+        Count++;
+        F.GetPrototype().Accept(*this);
+        F.GetBody().Accept(*this);
+    }
+    virtual void Visit(ProgramAST &P) override {
+        Count++;
+        for (auto &F : P.GetFunctions()) {
+            F->Accept(*this);
+        }
+        P.GetBlock().Accept(*this);
+    }
+};
+
+static uint64_t Lex(std::string &Source) {
+    ResetLexer(Source);
+    uint64_t Tokens = 0;
+    while (gettok() != tok_eof) {
+        Tokens++;
+    }
+    return Tokens;
+}
+
+// The process's high-water mark so far
+static long PeakRSSKiB() {
+    rusage Usage;
+    getrusage(RUSAGE_SELF, &Usage);
+    return Usage.ru_maxrss;
+}
+
+struct StageResult {
+    std::string File;
+    std::string Stage;
+    uint64_t Units;
+    std::string Unit;
+    Stats Seconds;
+    long PeakRSSKiB;
+};
+
+class Benchmark {
+    llvm::orc::KaleidoscopeJIT &TheJIT;
+    std::unique_ptr<llvm::TargetMachine> TM;
+    CompilerSession Session;
+    unsigned NextJITDylib = 0;
+
+    /**
+     * Seconds to generate every program in Source without function passes,
+     * in the session or each in a context of its own
+     */
+    double Codegen(std::string &Source, bool Cold) {
+        double Seconds = 0;
+        for (auto &P : Parse(Source)) {
+            CodeGen CG(Cold ? nullptr : &Session);
+            // Printing every module's IR would be measured too
+            CG.SetVerbose(false);
+            Clock::time_point Start = Clock::now();
+            CG.Generate(std::move(P), TheJIT.getDataLayout(), false, TM.get());
+            Seconds += Since(Start);
+        }
+        return Seconds;
+    }
+
+    /**
+     * Seconds that the passes take when every program in Source is
+     * generated with them
+     */
+    double Optimize(std::string &Source) {
+        double Seconds = 0;
+        for (auto &P : Parse(Source)) {
+            CodeGen CG(&Session);
+            CG.SetVerbose(false);
+            CG.Generate(std::move(P), TheJIT.getDataLayout(), true, TM.get());
+            Seconds += CG.GetTimings().Optimize;
+        }
+        return Seconds;
+    }
+
+    double Link(std::string &Source) {
+        double Seconds = 0;
+        for (auto &P : Parse(Source)) {
+            CodeGen CG(&Session);
+            CG.SetVerbose(false);
+            CG.Generate(std::move(P), TheJIT.getDataLayout(), true, TM.get());
+            auto &JD = ExitOnErr(TheJIT.createProgramJITDylib(
+                "bench#" + std::to_string(NextJITDylib++)));
+            Clock::time_point Start = Clock::now();
+            ExitOnErr(TheJIT.addModule(CG.TakeModule(),
+                                       JD.getDefaultResourceTracker()));
+            ExitOnErr(TheJIT.lookup(JD, "micropascal_main"));
+            Seconds += Since(Start);
+            ExitOnErr(TheJIT.removeJITDylib(JD));
+        }
+        return Seconds;
+    }
+
+    /**
+     * Seconds to compile every program in Source into the JIT straight from
+     * the parser, counting them in Programs
+     */
+    double Stream(std::string &Source, size_t &Programs) {
+        double Seconds = 0;
+        Programs = 0;
+        ResetLexer(Source);
+        getNextToken();
+        while (CurTok != tok_eof) {
+            if (CurTok != tok_program) {
+                getNextToken();
+                continue;
+            }
+            CodeGen CG(&Session);
+            CG.SetVerbose(false);
+            auto &JD = ExitOnErr(TheJIT.createProgramJITDylib(
+                "bench#" + std::to_string(NextJITDylib++)));
+            Clock::time_point Start = Clock::now();
+            llvm::orc::ExecutorAddr Main = CG.Link(
+                [](CodeGen &Gen) {
+                    return ParseProgram(
+                        [&Gen](std::unique_ptr<FunctionAST> F) {
+                            Gen.AddProcedure(std::move(F));
+                        });
+                },
+                TheJIT, JD.getDefaultResourceTracker());
+            Seconds += Since(Start);
+            ExitOnErr(TheJIT.removeJITDylib(JD));
+            if (Main) {
+                Programs++;
+            } else {
+                getNextToken();
+            }
+        }
+        return Seconds;
+    }
+
+   public:
+    std::vector<StageResult> Results;
+    // Median codegen seconds per program that the session saved on the last
+    // file
+    double SessionSavings = 0;
+
+    Benchmark(llvm::orc::KaleidoscopeJIT &TheJIT)
+        : TheJIT(TheJIT),
+          TM(ExitOnErr(TheJIT.createTargetMachine())),
+          Session(ExitOnErr(TheJIT.createTargetMachine()),
+                  ProgramsPerContext) {}
+
+    void Run(const std::string &Path, std::string &Source) {
+        uint64_t Tokens = Lex(Source);
+        uint64_t Nodes = 0;
+        size_t Programs = 0;
+        for (auto &P : Parse(Source)) {
+            NodeCounter Counter;
+            P->Accept(Counter);
+            Nodes += Counter.Count;
+            Programs++;
+        }
+
+        std::vector<double> LexTimes, ParseTimes, CodegenTimes, OptimizeTimes,
+            LinkTimes, ColdTimes;
+        for (unsigned i = 0; i < Warmup + Reps; i++) {
+            Clock::time_point Start = Clock::now();
+            Lex(Source);
+            double LexTime = Since(Start);
+
+            Start = Clock::now();
+            Parse(Source);
+            double ParseTime = Since(Start);
+
+            double CodegenTime = Codegen(Source, false);
+            double OptimizeTime = Optimize(Source);
+            double LinkTime = Link(Source);
+            double ColdTime = Codegen(Source, true);
+
+            if (i < Warmup) {
+                continue;
+            }
+            LexTimes.push_back(LexTime);
+            ParseTimes.push_back(ParseTime);
+            CodegenTimes.push_back(CodegenTime);
+            OptimizeTimes.push_back(OptimizeTime);
+            LinkTimes.push_back(LinkTime);
+            ColdTimes.push_back(ColdTime);
+        }
+
+        long Peak = PeakRSSKiB();
+        Results.push_back(
+            {Path, "lex", Tokens, "tokens", Summarize(LexTimes), Peak});
+        Results.push_back(
+            {Path, "parse", Nodes, "nodes", Summarize(ParseTimes), Peak});
+        Results.push_back(
+            {Path, "codegen", Nodes, "nodes", Summarize(CodegenTimes), Peak});
+        Results.push_back({Path, "optimize", Nodes, "nodes",
+                           Summarize(OptimizeTimes), Peak});
+        Results.push_back(
+            {Path, "jit", Programs, "programs", Summarize(LinkTimes), Peak});
+        Results.push_back({Path, "codegen-cold", Nodes, "nodes",
+                           Summarize(ColdTimes), Peak});
+        double Saved = Summarize(ColdTimes).Median -
+                       Summarize(CodegenTimes).Median;
+        SessionSavings = Programs ? Saved / Programs : 0;
+    }
+
+    void RunStreamed(const std::string &Path, std::string &Source) {
+        size_t Programs = 0;
+        std::vector<double> StreamTimes;
+        for (unsigned i = 0; i < Warmup + Reps; i++) {
+            double StreamTime = Stream(Source, Programs);
+            if (i >= Warmup) {
+                StreamTimes.push_back(StreamTime);
+            }
+        }
+        Results.push_back({Path, "stream", Programs, "programs",
+                           Summarize(StreamTimes), PeakRSSKiB()});
+    }
+};
+
+static void WriteResults(std::ostream &OS, const std::vector<StageResult> &Rs,
+                         const std::string &Target) {
+    OS << "# micropascal-bench " << FormatVersion << "\n"
+       << "# target " << Target << "\n"
+       << "# reps " << Reps << " warmup " << Warmup << "\n"
+       << "# programs-per-context " << ProgramsPerContext << "\n"
+       << "file\tstage\tunits\tunit\tmin_s\tmedian_s\tmean_s\tstddev_s\tmax_s"
+          "\tunits_per_s\tpeak_rss_kib\n";
+    OS << std::setprecision(6);
+    for (auto &R : Rs) {
+        const Stats &S = R.Seconds;
+        OS << R.File << "\t" << R.Stage << "\t" << R.Units << "\t" << R.Unit
+           << "\t" << S.Min << "\t" << S.Median << "\t" << S.Mean << "\t"
+           << S.StdDev << "\t" << S.Max << "\t"
+           << (S.Median > 0 ? R.Units / S.Median : 0) << "\t" << R.PeakRSSKiB
+           << "\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    llvm::cl::ParseCommandLineOptions(argc, argv,
+                                      "micropascal compiler benchmarks\n");
+    if (Reps == 0) {
+        std::cerr << "mpbench: --reps must be at least 1\n";
+        return 1;
+    }
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    InstantiateBinopPrecendence();
+
+    auto TheJIT = ExitOnErr(llvm::orc::KaleidoscopeJIT::Create());
+    ExitOnErr(DefineRuntimeSymbols(*TheJIT));
+    Benchmark B(*TheJIT);
+
+    for (auto &Path : Files) {
+        std::string Source = ReadSource(Path);
+
+        // Broken programs would be measured as far as the parser got.
+        // Parsing the whole file first would set the peak memory of a
+        // streamed run, so those are checked once they are done.
+        unsigned ErrorsBefore = GetErrorCount();
+        if (!Streamed) {
+            Parse(Source);
+        }
+        if (GetErrorCount() != ErrorsBefore) {
+            std::cerr << "mpbench: " << Path << " does not compile\n";
+            return 1;
+        }
+
+        std::cerr << "mpbench: " << Path << "\n";
+        if (Streamed) {
+            B.RunStreamed(Path, Source);
+            if (GetErrorCount() != ErrorsBefore) {
+                std::cerr << "mpbench: " << Path << " does not compile\n";
+                return 1;
+            }
+            continue;
+        }
+        B.Run(Path, Source);
+        std::cerr << "mpbench: the session saves "
+                  << B.SessionSavings * 1000 << " ms per program\n";
+    }
+
+    std::ofstream Out(OutputFilename);
+    if (!Out) {
+        std::cerr << "mpbench: cannot write " << OutputFilename << "\n";
+        return 1;
+    }
+    WriteResults(Out, B.Results, TheJIT->getTargetFingerprint());
+    WriteResults(std::cout, B.Results, TheJIT->getTargetFingerprint());
+    return 0;
+}
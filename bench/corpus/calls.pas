@@ -0,0 +1,606 @@
+program calls;
+
+procedure p0(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 1 + b;
+    if 1000 < c then
+        writeln('p0 ', c)
+end;
+
+procedure p1(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 2 + b;
+    if 2000 < c then
+        writeln('p1 ', c)
+end;
+
+procedure p2(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 3 + b;
+    p1(c, b);
+    if 3000 < c then
+        writeln('p2 ', c)
+end;
+
+procedure p3(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 4 + b;
+    p2(c, b);
+    if 4000 < c then
+        writeln('p3 ', c)
+end;
+
+procedure p4(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 5 + b;
+    p3(c, b);
+    if 5000 < c then
+        writeln('p4 ', c)
+end;
+
+procedure p5(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 6 + b;
+    p4(c, b);
+    if 6000 < c then
+        writeln('p5 ', c)
+end;
+
+procedure p6(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 7 + b;
+    p5(c, b);
+    if 7000 < c then
+        writeln('p6 ', c)
+end;
+
+procedure p7(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 8 + b;
+    p6(c, b);
+    if 8000 < c then
+        writeln('p7 ', c)
+end;
+
+procedure p8(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 9 + b;
+    p7(c, b);
+    if 9000 < c then
+        writeln('p8 ', c)
+end;
+
+procedure p9(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 10 + b;
+    p8(c, b);
+    if 10000 < c then
+        writeln('p9 ', c)
+end;
+
+procedure p10(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 11 + b;
+    p9(c, b);
+    if 11000 < c then
+        writeln('p10 ', c)
+end;
+
+procedure p11(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 12 + b;
+    p10(c, b);
+    if 12000 < c then
+        writeln('p11 ', c)
+end;
+
+procedure p12(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 13 + b;
+    p11(c, b);
+    if 13000 < c then
+        writeln('p12 ', c)
+end;
+
+procedure p13(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 14 + b;
+    p12(c, b);
+    if 14000 < c then
+        writeln('p13 ', c)
+end;
+
+procedure p14(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 15 + b;
+    p13(c, b);
+    if 15000 < c then
+        writeln('p14 ', c)
+end;
+
+procedure p15(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 16 + b;
+    p14(c, b);
+    if 16000 < c then
+        writeln('p15 ', c)
+end;
+
+procedure p16(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 17 + b;
+    p15(c, b);
+    if 17000 < c then
+        writeln('p16 ', c)
+end;
+
+procedure p17(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 18 + b;
+    p16(c, b);
+    if 18000 < c then
+        writeln('p17 ', c)
+end;
+
+procedure p18(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 19 + b;
+    p17(c, b);
+    if 19000 < c then
+        writeln('p18 ', c)
+end;
+
+procedure p19(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 20 + b;
+    p18(c, b);
+    if 20000 < c then
+        writeln('p19 ', c)
+end;
+
+procedure p20(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 21 + b;
+    p19(c, b);
+    if 21000 < c then
+        writeln('p20 ', c)
+end;
+
+procedure p21(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 22 + b;
+    p20(c, b);
+    if 22000 < c then
+        writeln('p21 ', c)
+end;
+
+procedure p22(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 23 + b;
+    p21(c, b);
+    if 23000 < c then
+        writeln('p22 ', c)
+end;
+
+procedure p23(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 24 + b;
+    p22(c, b);
+    if 24000 < c then
+        writeln('p23 ', c)
+end;
+
+procedure p24(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 25 + b;
+    p23(c, b);
+    if 25000 < c then
+        writeln('p24 ', c)
+end;
+
+procedure p25(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 26 + b;
+    p24(c, b);
+    if 26000 < c then
+        writeln('p25 ', c)
+end;
+
+procedure p26(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 27 + b;
+    p25(c, b);
+    if 27000 < c then
+        writeln('p26 ', c)
+end;
+
+procedure p27(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 28 + b;
+    p26(c, b);
+    if 28000 < c then
+        writeln('p27 ', c)
+end;
+
+procedure p28(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 29 + b;
+    p27(c, b);
+    if 29000 < c then
+        writeln('p28 ', c)
+end;
+
+procedure p29(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 30 + b;
+    p28(c, b);
+    if 30000 < c then
+        writeln('p29 ', c)
+end;
+
+procedure p30(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 31 + b;
+    p29(c, b);
+    if 31000 < c then
+        writeln('p30 ', c)
+end;
+
+procedure p31(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 32 + b;
+    p30(c, b);
+    if 32000 < c then
+        writeln('p31 ', c)
+end;
+
+procedure p32(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 33 + b;
+    p31(c, b);
+    if 33000 < c then
+        writeln('p32 ', c)
+end;
+
+procedure p33(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 34 + b;
+    p32(c, b);
+    if 34000 < c then
+        writeln('p33 ', c)
+end;
+
+procedure p34(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 35 + b;
+    p33(c, b);
+    if 35000 < c then
+        writeln('p34 ', c)
+end;
+
+procedure p35(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 36 + b;
+    p34(c, b);
+    if 36000 < c then
+        writeln('p35 ', c)
+end;
+
+procedure p36(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 37 + b;
+    p35(c, b);
+    if 37000 < c then
+        writeln('p36 ', c)
+end;
+
+procedure p37(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 38 + b;
+    p36(c, b);
+    if 38000 < c then
+        writeln('p37 ', c)
+end;
+
+procedure p38(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 39 + b;
+    p37(c, b);
+    if 39000 < c then
+        writeln('p38 ', c)
+end;
+
+procedure p39(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 40 + b;
+    p38(c, b);
+    if 40000 < c then
+        writeln('p39 ', c)
+end;
+
+procedure p40(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 41 + b;
+    p39(c, b);
+    if 41000 < c then
+        writeln('p40 ', c)
+end;
+
+procedure p41(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 42 + b;
+    p40(c, b);
+    if 42000 < c then
+        writeln('p41 ', c)
+end;
+
+procedure p42(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 43 + b;
+    p41(c, b);
+    if 43000 < c then
+        writeln('p42 ', c)
+end;
+
+procedure p43(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 44 + b;
+    p42(c, b);
+    if 44000 < c then
+        writeln('p43 ', c)
+end;
+
+procedure p44(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 45 + b;
+    p43(c, b);
+    if 45000 < c then
+        writeln('p44 ', c)
+end;
+
+procedure p45(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 46 + b;
+    p44(c, b);
+    if 46000 < c then
+        writeln('p45 ', c)
+end;
+
+procedure p46(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 47 + b;
+    p45(c, b);
+    if 47000 < c then
+        writeln('p46 ', c)
+end;
+
+procedure p47(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 48 + b;
+    p46(c, b);
+    if 48000 < c then
+        writeln('p47 ', c)
+end;
+
+procedure p48(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 49 + b;
+    p47(c, b);
+    if 49000 < c then
+        writeln('p48 ', c)
+end;
+
+procedure p49(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 50 + b;
+    p48(c, b);
+    if 50000 < c then
+        writeln('p49 ', c)
+end;
+
+procedure p50(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 51 + b;
+    p49(c, b);
+    if 51000 < c then
+        writeln('p50 ', c)
+end;
+
+procedure p51(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 52 + b;
+    p50(c, b);
+    if 52000 < c then
+        writeln('p51 ', c)
+end;
+
+procedure p52(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 53 + b;
+    p51(c, b);
+    if 53000 < c then
+        writeln('p52 ', c)
+end;
+
+procedure p53(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 54 + b;
+    p52(c, b);
+    if 54000 < c then
+        writeln('p53 ', c)
+end;
+
+procedure p54(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 55 + b;
+    p53(c, b);
+    if 55000 < c then
+        writeln('p54 ', c)
+end;
+
+procedure p55(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 56 + b;
+    p54(c, b);
+    if 56000 < c then
+        writeln('p55 ', c)
+end;
+
+procedure p56(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 57 + b;
+    p55(c, b);
+    if 57000 < c then
+        writeln('p56 ', c)
+end;
+
+procedure p57(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 58 + b;
+    p56(c, b);
+    if 58000 < c then
+        writeln('p57 ', c)
+end;
+
+procedure p58(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 59 + b;
+    p57(c, b);
+    if 59000 < c then
+        writeln('p58 ', c)
+end;
+
+procedure p59(a : integer; b : integer);
+var c : integer;
+begin
+    c := a * 60 + b;
+    p58(c, b);
+    if 60000 < c then
+        writeln('p59 ', c)
+end;
+
+var i : integer;
+begin
+    for i := 1 to 3 do
+    begin
+        p0(i, 0);
+        p1(i, 1);
+        p2(i, 2);
+        p3(i, 3);
+        p4(i, 4);
+        p5(i, 5);
+        p6(i, 6);
+        p7(i, 7);
+        p8(i, 8);
+        p9(i, 9);
+        p10(i, 10);
+        p11(i, 11);
+        p12(i, 12);
+        p13(i, 13);
+        p14(i, 14);
+        p15(i, 15);
+        p16(i, 16);
+        p17(i, 17);
+        p18(i, 18);
+        p19(i, 19);
+        p20(i, 20);
+        p21(i, 21);
+        p22(i, 22);
+        p23(i, 23);
+        p24(i, 24);
+        p25(i, 25);
+        p26(i, 26);
+        p27(i, 27);
+        p28(i, 28);
+        p29(i, 29);
+        p30(i, 30);
+        p31(i, 31);
+        p32(i, 32);
+        p33(i, 33);
+        p34(i, 34);
+        p35(i, 35);
+        p36(i, 36);
+        p37(i, 37);
+        p38(i, 38);
+        p39(i, 39);
+        p40(i, 40);
+        p41(i, 41);
+        p42(i, 42);
+        p43(i, 43);
+        p44(i, 44);
+        p45(i, 45);
+        p46(i, 46);
+        p47(i, 47);
+        p48(i, 48);
+        p49(i, 49);
+        p50(i, 50);
+        p51(i, 51);
+        p52(i, 52);
+        p53(i, 53);
+        p54(i, 54);
+        p55(i, 55);
+        p56(i, 56);
+        p57(i, 57);
+        p58(i, 58);
+        p59(i, 0)
+    end
+end.
@@ -0,0 +1,6950 @@
+program huge;
+
+procedure q0(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := a;
+    for i := 1 to 3 do
+    begin
+        a := z;
+        b := (((x + 21) * (b - y)) + ((a * a) - z));
+        if (b - (13 - x)) < x then
+        begin
+            writeln(a, b);
+            for j := 1 to 5 do
+            begin
+                x := (((99 + a) - (z * y)) - ((b + 69) - (z - b)))
+            end;
+            for j := 1 to 3 do
+            begin
+                b := (((y * 68) - (2 * 88)) * ((x - a) * (z + a)))
+            end
+        end
+    end;
+    z := (70 * ((a - 40) + 11))
+end;
+
+procedure q1(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((b + 71) + 55) < ((89 + 52) * (z - b)) then
+    begin
+        z := ((8 + x) + (z + (74 - y)))
+    end;
+    a := (((7 * 83) + 14) + b);
+    x := ((71 + 2) + ((y - y) + y));
+    q0(x, y)
+end;
+
+procedure q2(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := ((a * (x + y)) * ((z + 9) * 52));
+    z := z;
+    z := ((41 + x) - ((y * 13) + (b - 32)));
+    b := (((84 * z) - (b - a)) * (92 - 34));
+    for i := 1 to 6 do
+    begin
+        y := (b * (y * b))
+    end
+end;
+
+procedure q3(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 4 do
+    begin
+        x := (((x + 86) + (y * 31)) + ((4 + 43) - (32 - a)));
+        a := (59 - ((a * x) - (36 - 52)))
+    end;
+    for i := 1 to 7 do
+    begin
+        x := 34
+    end;
+    z := (((66 + z) + 1) * ((95 * 47) - 43));
+    for i := 1 to 3 do
+    begin
+        writeln(z, x);
+        for j := 1 to 7 do
+        begin
+            for k := 1 to 4 do
+            begin
+                y := (((z + b) - (42 - b)) * ((22 * z) * (b * b)))
+            end;
+            a := a
+        end;
+        z := 64
+    end;
+    b := (99 + (90 * (a - y)))
+end;
+
+procedure q4(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 9 do
+    begin
+        if ((58 + 61) - x) < ((36 - x) + z) then
+        begin
+            b := (y - ((y - 75) * 74))
+        end
+        else
+        begin
+            writeln(x, y)
+        end;
+        if ((70 * 63) + y) < ((b - 80) * z) then
+        begin
+            y := a;
+            x := y;
+            y := a
+        end;
+        x := a
+    end;
+    if (b + 73) < ((x + 96) * 40) then
+    begin
+        for i := 1 to 6 do
+        begin
+            for j := 1 to 8 do
+            begin
+                b := 81;
+                x := ((6 - (9 * 2)) - (82 - (z * z)))
+            end;
+            if ((x + 12) - (y * 49)) < ((y + x) - x) then
+            begin
+                b := 63;
+                b := (((12 - b) - (z * z)) - ((b + 41) + (89 + y)));
+                z := ((b - a) * (71 - (y + 74)))
+            end
+            else
+            begin
+                b := (15 + (7 + x));
+                b := 78
+            end;
+            for j := 1 to 5 do
+            begin
+                y := y;
+                z := 13;
+                b := (b + (z - x))
+            end
+        end
+    end;
+    b := (((26 - b) * b) + 77);
+    if (x * (z - z)) < x then
+    begin
+        a := 74;
+        for i := 1 to 2 do
+        begin
+            if ((z * x) + (y + y)) < ((43 - 37) * (71 + x)) then
+            begin
+                y := ((60 - z) - ((z + 57) * (z + 40)));
+                z := (15 - ((x * 54) - (z + z)))
+            end;
+            if (54 - (a - 76)) < ((58 * x) * (x + 31)) then
+            begin
+                y := 91;
+                y := (((64 + z) - (57 + y)) + ((20 + x) - (a - 69)));
+                x := (((z + x) + (a * 13)) - a)
+            end
+            else
+            begin
+                x := (b + 49)
+            end;
+            for j := 1 to 5 do
+            begin
+                b := 59;
+                a := ((a - (39 * 89)) - ((62 + z) - (38 + 85)))
+            end
+        end;
+        a := (((z * x) + (b * b)) * 6)
+    end
+    else
+    begin
+        x := (y + 47);
+        for i := 1 to 6 do
+        begin
+            y := (15 - (87 * (z - y)))
+        end
+    end;
+    z := x;
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 9 do
+        begin
+            for k := 1 to 7 do
+            begin
+                a := (((15 + a) - (b * y)) - ((54 * 20) - (79 - 36)));
+                x := b;
+                a := (((8 - a) - z) + b)
+            end
+        end
+    end;
+    if 71 < b then
+    begin
+        if ((b + b) + (a - 31)) < (b * (a - x)) then
+        begin
+            for i := 1 to 9 do
+            begin
+                z := 85;
+                y := (52 - ((10 + b) + 75));
+                x := ((y + (z * 56)) - ((52 - 41) - (b * 9)))
+            end;
+            a := x;
+            if ((x * x) * (a - 46)) < b then
+            begin
+                a := ((b - (80 * 72)) + ((4 + x) - (b * 9)));
+                a := y;
+                x := x
+            end
+        end;
+        a := 7
+    end;
+    q3(x, y)
+end;
+
+procedure q5(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        z := x;
+        for j := 1 to 9 do
+        begin
+            for k := 1 to 2 do
+            begin
+                z := b
+            end;
+            if (y * (z * z)) < ((a - a) - (y - a)) then
+            begin
+                z := (((a + y) * 96) - 10);
+                a := (45 * ((a + b) * 10))
+            end
+            else
+            begin
+                z := (((z - 81) - y) * (z + (a - 10)));
+                a := (((a - 74) * 65) + ((44 * b) + y))
+            end;
+            for k := 1 to 4 do
+            begin
+                x := (((x + z) * (z + z)) * y);
+                a := (((86 * 95) * (y * x)) - y)
+            end
+        end
+    end;
+    b := a;
+    for i := 1 to 2 do
+    begin
+        z := b;
+        z := (y - (x * (b - 61)));
+        writeln(b, x)
+    end;
+    for i := 1 to 9 do
+    begin
+        if ((b + 18) - x) < (16 - y) then
+        begin
+            y := 58;
+            if ((x + a) - a) < ((18 + y) * (61 - 11)) then
+            begin
+                b := (((x + a) + (59 + y)) * ((b - z) - a))
+            end;
+            z := (((y + 48) - (a - a)) * ((z - 23) * (81 + 9)))
+        end;
+        writeln(a, x)
+    end;
+    b := (((z - b) - (84 - x)) - ((50 - 64) * (67 - 94)));
+    y := (((a - 40) - (y - x)) * (8 + (z * 4)));
+    q4(x, y)
+end;
+
+procedure q6(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := 47;
+    z := y;
+    writeln(x, y);
+    if ((x + 4) * z) < 91 then
+    begin
+        z := 63;
+        b := (((a * 41) * (z - 21)) * ((x * b) + x))
+    end;
+    z := 9;
+    y := (((x * y) * (z * b)) - ((67 + b) - (z - 33)));
+    q4(x, y)
+end;
+
+procedure q7(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (76 * 93);
+    writeln(x, a);
+    if z < z then
+    begin
+        for i := 1 to 2 do
+        begin
+            if ((b * y) + (y - x)) < ((94 - 17) - (b - y)) then
+            begin
+                a := z
+            end
+            else
+            begin
+                z := (z - ((y * b) + (x - y)))
+            end;
+            a := (((98 - y) + (z - z)) - (88 * 51))
+        end;
+        x := ((52 * x) - (18 - (y * 39)))
+    end;
+    for i := 1 to 9 do
+    begin
+        for j := 1 to 9 do
+        begin
+            a := (((89 * y) - (75 * a)) * ((49 + 32) + (25 + y)))
+        end;
+        b := (((95 * b) * y) * ((z - x) * (36 * x)));
+        if ((y - x) - 49) < ((b - a) - (96 - z)) then
+        begin
+            writeln(x, b);
+            z := z
+        end
+        else
+        begin
+            y := (((z + y) - (37 - a)) + (5 + (5 - 24)))
+        end
+    end;
+    writeln(x, a);
+    q4(x, y)
+end;
+
+procedure q8(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := 70;
+    for i := 1 to 4 do
+    begin
+        b := (((92 + x) - (23 * 52)) - (24 + (1 - y)));
+        if ((2 - 89) + x) < 91 then
+        begin
+            for j := 1 to 6 do
+            begin
+                b := (((48 - 61) * (98 + 77)) + ((z + z) * b));
+                z := (((z - 59) + (a * x)) * a)
+            end;
+            if (a * (9 - y)) < y then
+            begin
+                y := (((z + 45) + z) + (a - (55 * b)));
+                x := a
+            end
+            else
+            begin
+                a := z;
+                z := ((y + (8 + x)) + ((z * 31) - (67 + x)))
+            end
+        end
+        else
+        begin
+            for j := 1 to 8 do
+            begin
+                x := (((y - y) + (b - 19)) - ((72 * b) - 58));
+                a := ((z * z) * (x - (b * y)));
+                z := ((x - (40 - y)) - 61)
+            end
+        end;
+        if (a * (3 - z)) < ((x + b) - (44 - 63)) then
+        begin
+            for j := 1 to 9 do
+            begin
+                x := 63;
+                z := (((10 * a) - 9) * y)
+            end;
+            z := (((3 + y) + 69) - 87);
+            b := b
+        end
+        else
+        begin
+            if x < ((b - 11) * (5 + y)) then
+            begin
+                a := (83 - ((z + z) - 88));
+                z := (41 + ((92 - 39) + (y * 43)));
+                b := ((45 + a) - ((x + 58) - y))
+            end
+            else
+            begin
+                z := a;
+                b := ((x + 57) - (y - (a + z)))
+            end;
+            z := ((a * (32 * y)) + y)
+        end
+    end;
+    b := (((x + 64) * (b - y)) - ((57 - z) + (89 + b)));
+    writeln(x, z);
+    if ((42 - y) - z) < (4 * (57 - 9)) then
+    begin
+        for i := 1 to 4 do
+        begin
+            x := (((z - z) * (54 * x)) * ((11 + 85) * (6 * 87)));
+            for j := 1 to 7 do
+            begin
+                a := z;
+                z := y
+            end;
+            if ((a - y) + 19) < ((67 - a) - (a - a)) then
+            begin
+                a := (32 * z)
+            end
+            else
+            begin
+                y := (51 + ((y - b) + 9));
+                z := y
+            end
+        end;
+        y := (((76 + y) * 39) * ((b - x) * z))
+    end
+    else
+    begin
+        y := (((72 + b) + (a - 63)) + z);
+        for i := 1 to 9 do
+        begin
+            for j := 1 to 8 do
+            begin
+                y := b;
+                x := y;
+                y := (z - ((57 * y) + (32 - 5)))
+            end;
+            x := (16 + 89)
+        end
+    end;
+    z := (b + ((z * x) - (66 * 18)));
+    writeln(y, a)
+end;
+
+procedure q9(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if x < ((63 + x) * (a - x)) then
+    begin
+        writeln(x, y);
+        writeln(x, a);
+        if (82 * (69 - y)) < ((x - b) * (88 + y)) then
+        begin
+            b := (26 * ((x + 33) + (22 + x)))
+        end
+    end;
+    a := (b * 2);
+    x := (((a + a) + (18 - 97)) + ((z + 22) - (b - 57)));
+    if a < ((41 + a) + (78 - 89)) then
+    begin
+        if ((z + 38) * 31) < (z + (47 - z)) then
+        begin
+            b := (((a + a) + (x * 99)) - ((69 * a) - 20));
+            for i := 1 to 8 do
+            begin
+                a := (((b + 15) - (b + b)) * x);
+                x := x;
+                a := (35 * 74)
+            end
+        end
+    end
+    else
+    begin
+        z := a;
+        if (1 + (a - b)) < 5 then
+        begin
+            if ((b - 41) - (a * 7)) < 6 then
+            begin
+                y := (((y + x) * (32 - y)) + ((20 + 4) + (89 + 1)));
+                y := ((b - (b * a)) + ((48 - 11) * y))
+            end
+            else
+            begin
+                b := x
+            end;
+            writeln(y, x);
+            x := 18
+        end
+    end
+end;
+
+procedure q10(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((27 - x) + 39) * (42 + x));
+    a := (4 - ((a - b) + 29));
+    y := (((x + a) + (b + 43)) + b);
+    writeln(y, z);
+    q6(x, y)
+end;
+
+procedure q11(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (b + ((64 - 62) + y));
+    z := 70;
+    if ((z - z) * (a - a)) < ((y * z) + (b - a)) then
+    begin
+        for i := 1 to 8 do
+        begin
+            writeln(b, z);
+            x := (((x * z) + (64 * y)) + b)
+        end
+    end
+    else
+    begin
+        z := b;
+        writeln(x, a)
+    end;
+    z := (z - ((51 * x) - y));
+    if ((z * 79) - b) < ((b * z) - (73 + x)) then
+    begin
+        z := x;
+        if 22 < ((86 * 43) - a) then
+        begin
+            a := (y + ((z - y) * (21 - a)));
+            x := x
+        end
+        else
+        begin
+            a := ((z - (b * 21)) + b);
+            z := ((b + y) + a)
+        end;
+        z := (x + (61 - (z - y)))
+    end
+    else
+    begin
+        y := (a + ((x * z) + (67 - 88)));
+        if ((a - 92) + (74 * 19)) < 23 then
+        begin
+            writeln(b, z)
+        end
+        else
+        begin
+            writeln(y, b)
+        end
+    end;
+    writeln(b, x);
+    q1(x, y)
+end;
+
+procedure q12(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((2 * 67) - z) * ((a * 37) * (34 - 74)));
+    for i := 1 to 2 do
+    begin
+        b := (((x * y) - (x - y)) * ((x * x) - (12 + y)))
+    end;
+    if ((66 + z) - 73) < b then
+    begin
+        y := b
+    end
+    else
+    begin
+        for i := 1 to 3 do
+        begin
+            x := (((z - x) * (a - z)) + ((35 * a) * 83));
+            a := 40;
+            if (45 - z) < ((z * 48) * (39 * a)) then
+            begin
+                x := (84 - b);
+                z := ((y - y) * 74)
+            end
+        end;
+        b := (((46 * b) * (a - x)) * ((x * x) + (x - x)))
+    end;
+    q1(x, y)
+end;
+
+procedure q13(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((a * x) - 18) + ((59 + b) + (23 - 1)));
+    b := (63 + y);
+    y := (x + ((a * b) + (b + z)));
+    a := (z * ((18 - 63) - (y + b)));
+    a := (a - (a * (84 + a)));
+    y := b;
+    q10(x, y)
+end;
+
+procedure q14(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (18 - (16 - b));
+    for i := 1 to 6 do
+    begin
+        writeln(x, y);
+        a := (((b + a) + (20 + 10)) * ((59 - a) + (38 - 41)));
+        a := 6
+    end;
+    b := (y * 48)
+end;
+
+procedure q15(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (y - ((a + z) - (24 * x)));
+    for i := 1 to 4 do
+    begin
+        writeln(a, y);
+        a := z
+    end;
+    if ((86 - z) + (62 - 83)) < ((z + b) * (22 + 42)) then
+    begin
+        x := y
+    end
+    else
+    begin
+        y := (((a - 3) + (z + 78)) * ((y - a) + (z * x)))
+    end;
+    if 29 < x then
+    begin
+        for i := 1 to 3 do
+        begin
+            if ((53 + b) + 28) < ((14 - z) + (z * y)) then
+            begin
+                a := (((23 * b) + (42 * 54)) * ((x - b) + (96 * z)))
+            end
+        end;
+        if ((z * x) * 23) < ((a - z) * (87 * 69)) then
+        begin
+            if (y + x) < (x + (38 + 5)) then
+            begin
+                a := (((z - x) * (50 - 88)) - (26 * (57 + 91)));
+                x := (((25 - a) + (16 - x)) * x)
+            end
+            else
+            begin
+                b := 77;
+                z := (((a * b) + (21 - y)) + ((43 - z) * (a + 58)))
+            end;
+            z := (x - ((z * z) - (y + b)))
+        end
+        else
+        begin
+            writeln(b, a)
+        end;
+        for i := 1 to 5 do
+        begin
+            for j := 1 to 5 do
+            begin
+                a := 95;
+                a := (x + x);
+                z := (((y - y) * z) + ((10 - 14) - (a - 57)))
+            end;
+            a := ((z - (x + z)) + z);
+            z := (((45 + z) + x) + 73)
+        end
+    end
+end;
+
+procedure q16(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := 33;
+    z := ((13 - (41 - z)) * ((x - 22) + (92 * 36)));
+    if 62 < ((z + z) + (18 * a)) then
+    begin
+        a := (((z + 71) - (61 * 47)) - 94);
+        if a < ((79 * z) + (z * 19)) then
+        begin
+            if (30 + b) < ((y + x) + (x * z)) then
+            begin
+                y := (((y + x) - (z + b)) - x);
+                b := 16;
+                y := (((b * y) + z) + z)
+            end
+            else
+            begin
+                b := (((93 * 37) + 61) - 77)
+            end;
+            z := (34 + ((z + y) + z));
+            for i := 1 to 4 do
+            begin
+                y := (((a + b) * (y * a)) * (99 - (98 * y)));
+                y := ((z - a) * ((b * 53) - z));
+                z := ((97 + (62 + z)) - x)
+            end
+        end;
+        b := (((b + y) - (88 * y)) * b)
+    end
+    else
+    begin
+        x := a;
+        if ((37 * 8) + (b * 67)) < z then
+        begin
+            for i := 1 to 5 do
+            begin
+                a := (((x - y) - (a + z)) * ((z + y) * z));
+                a := ((x * (y - b)) - ((z + x) + (29 * 41)));
+                x := (32 - 44)
+            end;
+            b := (((b - 31) * b) + ((a + 87) * (z + 48)));
+            for i := 1 to 9 do
+            begin
+                y := 66;
+                b := (y - (b - (59 - 2)));
+                y := (((z - y) * (y + x)) - (b * (93 - 72)))
+            end
+        end
+        else
+        begin
+            b := (b * ((39 - z) + (8 + 61)));
+            if 34 < ((33 - a) - (26 * z)) then
+            begin
+                x := (((11 - 60) * (82 - z)) * ((x + x) * 35))
+            end
+        end
+    end;
+    if ((y - a) + (96 * 27)) < a then
+    begin
+        for i := 1 to 2 do
+        begin
+            for j := 1 to 3 do
+            begin
+                b := 50
+            end;
+            b := ((b + x) - ((71 - z) + (z - z)))
+        end;
+        x := (x - (z + (a * 97)))
+    end
+    else
+    begin
+        if ((71 - z) - (y - a)) < (79 * (z - a)) then
+        begin
+            a := ((25 - z) + x)
+        end
+        else
+        begin
+            if y < y then
+            begin
+                a := (((y + b) + (y + b)) - ((5 + a) * (y * 42)));
+                a := ((x + (b + y)) - 75)
+            end
+            else
+            begin
+                a := (((a + a) * (98 * x)) * a)
+            end;
+            b := (((y * y) - (a - 72)) - ((z - y) - (z + b)))
+        end
+    end;
+    x := (((b + 47) * 85) * (99 * y));
+    for i := 1 to 3 do
+    begin
+        for j := 1 to 3 do
+        begin
+            if 26 < a then
+            begin
+                y := (((x + 10) + (y + a)) - ((x * z) - (39 + 67)));
+                b := (b * (54 * 46));
+                y := (y * (57 - (x - y)))
+            end
+        end
+    end;
+    b := (96 - ((1 * x) * x));
+    q7(x, y)
+end;
+
+procedure q17(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if 89 < ((z * a) - (x * x)) then
+    begin
+        y := (x - 89);
+        if (5 * (a - y)) < ((30 * 78) + (7 - x)) then
+        begin
+            for i := 1 to 7 do
+            begin
+                b := 51;
+                z := (y + z);
+                z := (b + (z + (68 + x)))
+            end;
+            if ((y - b) - (99 - x)) < ((b - b) + (a + 32)) then
+            begin
+                x := 15;
+                y := z;
+                z := (b * (z + b))
+            end;
+            for i := 1 to 2 do
+            begin
+                a := 85;
+                x := (84 - a)
+            end
+        end
+    end
+    else
+    begin
+        z := (((z - y) * x) - (65 - (50 + 36)))
+    end;
+    x := ((z * (z + x)) * ((b * b) + (68 + b)));
+    for i := 1 to 4 do
+    begin
+        z := (b * y);
+        writeln(x, y)
+    end;
+    if ((20 + b) + (35 * b)) < (a * (z - 48)) then
+    begin
+        if (a - (x - b)) < (57 * (y + a)) then
+        begin
+            if ((96 * z) * (67 + a)) < (a * (7 + y)) then
+            begin
+                x := (((z + y) + (z * y)) - (b - b));
+                a := 82
+            end
+            else
+            begin
+                z := (a + ((20 + 23) * y));
+                b := b
+            end;
+            x := y;
+            for i := 1 to 2 do
+            begin
+                b := 59;
+                a := (36 * ((b + x) + z));
+                x := (b + ((77 * 23) - (a + 42)))
+            end
+        end
+        else
+        begin
+            if ((y + x) - (b * z)) < ((62 * 91) - (34 * z)) then
+            begin
+                z := (((b * x) + a) * ((53 + z) * 89));
+                a := (((x - z) * (25 - 87)) - ((62 + 69) - (96 + 39)))
+            end;
+            for i := 1 to 2 do
+            begin
+                x := (((36 + y) * (z - a)) - ((y + b) - (28 * a)))
+            end
+        end
+    end
+    else
+    begin
+        if ((y * x) - (x + 13)) < ((17 + 59) - (a - 88)) then
+        begin
+            if ((x + x) * (b - x)) < ((b - z) * (x * b)) then
+            begin
+                z := z;
+                z := (a + (z * (58 * x)));
+                z := 98
+            end
+            else
+            begin
+                y := y
+            end;
+            b := 34;
+            writeln(y, b)
+        end
+    end
+end;
+
+procedure q18(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := y;
+    b := z;
+    a := ((a - (y + 71)) + ((z - 56) * (b + 10)));
+    if ((z - a) - 9) < ((y - a) + z) then
+    begin
+        if ((x - 58) + 39) < ((y * 45) + (66 - 38)) then
+        begin
+            z := (x + ((z - 92) - (b * b)))
+        end
+        else
+        begin
+            if ((b + a) + (y + y)) < ((55 * z) - (x + z)) then
+            begin
+                b := (74 - y)
+            end;
+            y := (68 - (12 + (86 + 70)))
+        end;
+        if (a - (74 * x)) < ((a * 96) - (a * b)) then
+        begin
+            x := ((z + (b * x)) + ((95 + 48) + 63));
+            z := ((b - (y + 93)) * x);
+            x := (y - ((69 + y) - y))
+        end
+        else
+        begin
+            x := ((82 - (x - a)) - ((96 + 76) + (24 - a)));
+            if a < ((33 + z) + b) then
+            begin
+                a := 49;
+                z := (b - 10);
+                x := (((33 + 36) + (a - 34)) + ((79 - y) + 28))
+            end
+        end;
+        y := (z * y)
+    end
+    else
+    begin
+        writeln(y, x)
+    end;
+    x := (((63 - a) * y) + ((x - a) - (11 - 38)))
+end;
+
+procedure q19(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        y := (((y * a) + 31) - ((64 * 58) + a));
+        b := (((69 + 30) + a) - ((b + a) - (z + 9)));
+        if z < 55 then
+        begin
+            if ((z * b) + (a - y)) < b then
+            begin
+                z := z;
+                b := a
+            end
+            else
+            begin
+                z := (((89 + x) * (b * 77)) + ((x - z) + 13))
+            end;
+            for j := 1 to 5 do
+            begin
+                b := b;
+                y := (7 * (z - 69))
+            end
+        end
+        else
+        begin
+            a := y
+        end
+    end;
+    for i := 1 to 7 do
+    begin
+        x := b;
+        y := ((y + (z - x)) + (x + (z + a)))
+    end;
+    if (x * 79) < ((b + z) - (y - y)) then
+    begin
+        if b < ((z + a) + (65 + y)) then
+        begin
+            if (a * (53 + x)) < 3 then
+            begin
+                b := (((y - 91) - 81) - (50 * (y - 79)));
+                b := (95 + ((a + y) * z))
+            end;
+            for i := 1 to 5 do
+            begin
+                b := (((90 + 98) + (65 * a)) + ((a - 87) * (x * 9)))
+            end
+        end
+        else
+        begin
+            y := (14 + 64);
+            b := ((70 + (a - a)) + ((z - 42) - (71 - z)))
+        end;
+        x := y;
+        x := (y + (b + (86 + a)))
+    end
+    else
+    begin
+        for i := 1 to 9 do
+        begin
+            b := (x + ((x + 52) - (41 + z)));
+            writeln(x, z)
+        end;
+        x := (((73 * 57) - (6 + 15)) - 29)
+    end;
+    a := ((x + y) * (b - (8 * b)))
+end;
+
+procedure q20(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := x;
+    writeln(z, a);
+    y := (((y * 18) * (x - 68)) - 97);
+    a := (((z + y) - (x * z)) * (x - (61 + 37)));
+    y := ((64 + (y * x)) * ((48 * 3) - x));
+    b := (x + a)
+end;
+
+procedure q21(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if (x * (x + x)) < (x - (21 + z)) then
+    begin
+        if ((68 * 90) + (15 + 62)) < ((y * x) + (a + b)) then
+        begin
+            b := 55;
+            for i := 1 to 3 do
+            begin
+                y := (z * x)
+            end;
+            x := (((27 * 24) * (x * b)) * ((a + 98) + (37 + 69)))
+        end
+        else
+        begin
+            writeln(z, y)
+        end
+    end
+    else
+    begin
+        a := y
+    end;
+    z := x;
+    a := (((a + a) - 40) * ((x - a) - (a * a)));
+    z := (y * (22 + (b * 52)));
+    q13(x, y)
+end;
+
+procedure q22(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((46 - 52) - (y + y)) - 4);
+    a := ((z * (z + 85)) * ((y - z) - (a + 16)));
+    x := ((x * x) * ((y * z) * (b * x)));
+    y := (((a * x) - (x - x)) - (b * (a - b)));
+    x := 55;
+    for i := 1 to 8 do
+    begin
+        y := (((z + 13) * (z * z)) - ((a * x) + b));
+        for j := 1 to 3 do
+        begin
+            if a < ((x + 39) * (z - y)) then
+            begin
+                y := (((67 + b) * (60 - 69)) * ((94 * b) - (x - a)));
+                y := b
+            end
+            else
+            begin
+                a := x
+            end;
+            z := (((x + x) * (6 * a)) + (9 - (12 - 93)));
+            if z < ((68 - a) + (41 - 95)) then
+            begin
+                b := (b - (y * (41 * b)));
+                b := (((z + 85) + (31 - x)) * ((16 * 57) - 33))
+            end
+            else
+            begin
+                b := (((53 + a) - (x * a)) + ((z * 95) - (a * 81)))
+            end
+        end
+    end;
+    q20(x, y)
+end;
+
+procedure q23(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := ((z * (98 + 88)) - ((b - z) - (y - y)));
+    writeln(z, b);
+    a := (((60 + b) + (x + x)) + (56 - (b * x)));
+    y := ((x * (y + x)) + ((y + b) - (b * y)))
+end;
+
+procedure q24(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := b;
+    x := (((a + z) - (x + 72)) + (x - z));
+    x := b;
+    x := ((79 - (b - 63)) + ((57 + a) + b));
+    if ((6 - z) - (b + b)) < (z - (28 * 1)) then
+    begin
+        if 32 < ((4 - 88) + (a - a)) then
+        begin
+            if ((77 * a) * (z + a)) < (96 + (12 - b)) then
+            begin
+                b := 37;
+                b := y
+            end;
+            writeln(z, b)
+        end
+        else
+        begin
+            if ((61 - y) + (79 + y)) < y then
+            begin
+                b := (((y - y) - x) + (a + (y + z)));
+                x := z;
+                y := y
+            end
+            else
+            begin
+                x := (((x - 24) + 78) - (a - y));
+                y := (((z * y) - b) + ((a + b) * 69))
+            end
+        end;
+        x := (a + ((y - y) * y));
+        a := 56
+    end
+end;
+
+procedure q25(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 6 do
+    begin
+        y := (((63 + 68) + (a - 54)) - 83)
+    end;
+    y := b;
+    y := x;
+    writeln(y, b);
+    if ((x - 21) * 12) < (z - y) then
+    begin
+        z := x;
+        b := 65
+    end
+    else
+    begin
+        a := (x - ((72 - 89) * (a - 97)))
+    end;
+    a := (((z + b) * x) + ((64 * 20) * (16 + y)));
+    if 61 < ((x * 47) * (z - 18)) then
+    begin
+        y := (((4 - a) * (11 - b)) - 85);
+        writeln(b, a)
+    end
+end;
+
+procedure q26(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(y, z);
+    if ((41 - x) * (y - 70)) < ((x * b) - y) then
+    begin
+        if ((b + x) * (3 + 70)) < (93 - (a - z)) then
+        begin
+            a := ((b * (z * x)) - ((b * b) + (x - y)));
+            if b < ((z - z) - (y - 63)) then
+            begin
+                b := y;
+                z := (y + ((a * 15) + (z + x)));
+                x := b
+            end
+            else
+            begin
+                x := (63 + a);
+                z := (((z + 65) * (y + 42)) + ((b - a) * (83 + 91)))
+            end
+        end
+        else
+        begin
+            for i := 1 to 3 do
+            begin
+                b := (((67 + 65) + 24) + z);
+                z := ((3 - (z - a)) + ((b - 20) - (8 * 24)));
+                a := b
+            end;
+            x := 16
+        end;
+        b := (((50 + x) - (a - 3)) - ((z * 39) * (z + 19)));
+        b := (((58 + y) * 1) + ((y - 28) * (b * a)))
+    end
+    else
+    begin
+        for i := 1 to 4 do
+        begin
+            for j := 1 to 6 do
+            begin
+                z := (((x * b) * (y * b)) * ((a * z) * (69 + 84)));
+                z := 86
+            end;
+            a := (((b * 16) - (a + 98)) - ((z * b) + (5 - z)));
+            b := ((z - z) * ((b * x) * (94 - a)))
+        end;
+        writeln(z, x)
+    end;
+    for i := 1 to 9 do
+    begin
+        writeln(a, x)
+    end;
+    y := 60;
+    z := ((y * (b - z)) + (10 + a));
+    for i := 1 to 3 do
+    begin
+        a := (((a - x) + (b + 80)) - ((a + 49) - (17 + 57)))
+    end;
+    z := (72 + a)
+end;
+
+procedure q27(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((y * 44) * (59 * b)) + a);
+    for i := 1 to 5 do
+    begin
+        z := z;
+        b := b;
+        y := (((z + x) * (a * b)) + 72)
+    end;
+    if (b + (89 * 77)) < ((x * x) + 6) then
+    begin
+        a := (((y * 43) * (a - x)) + (z - b));
+        b := (((b + x) + 49) * (40 - 85))
+    end
+    else
+    begin
+        if b < (x - (32 + 76)) then
+        begin
+            if b < 17 then
+            begin
+                y := y;
+                z := z;
+                z := (((92 - z) - (84 + b)) - ((y * x) - (a - x)))
+            end
+            else
+            begin
+                z := (((y - a) + (a - 38)) * ((30 + x) + (x - x)))
+            end
+        end
+        else
+        begin
+            writeln(z, x)
+        end;
+        x := y
+    end;
+    writeln(z, a);
+    z := (((b - z) * (60 - 41)) + ((y - 4) - 40));
+    writeln(a, y)
+end;
+
+procedure q28(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((39 - z) + (x * 78)) * ((y + b) - y));
+    for i := 1 to 6 do
+    begin
+        z := 78
+    end;
+    b := 50;
+    b := y;
+    z := y;
+    q3(x, y)
+end;
+
+procedure q29(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 9 do
+    begin
+        b := y;
+        if (x * 59) < b then
+        begin
+            y := (z - ((37 * 59) - (39 - 23)));
+            b := (((24 * y) * (b - 69)) - (28 - (16 - a)))
+        end;
+        if (a - 87) < ((25 - x) + (y - a)) then
+        begin
+            for j := 1 to 9 do
+            begin
+                x := (a + y)
+            end;
+            a := (b * 28);
+            a := (((14 - 57) + (y + 48)) + a)
+        end
+    end;
+    b := (13 * y);
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 5 do
+        begin
+            z := ((x + 2) - x);
+            for k := 1 to 7 do
+            begin
+                b := (((92 * 73) + x) * ((89 + x) * (z * z)))
+            end;
+            for k := 1 to 5 do
+            begin
+                a := 16;
+                y := ((x + a) + ((95 - x) * (y * 97)));
+                x := (b * (67 - 9))
+            end
+        end;
+        if b < (z + y) then
+        begin
+            b := b;
+            z := ((11 - (y - y)) + ((y - 98) - (b - x)))
+        end
+        else
+        begin
+            for j := 1 to 9 do
+            begin
+                y := 1
+            end;
+            z := (((y * y) - (y + 16)) - (33 * (82 * a)))
+        end
+    end;
+    for i := 1 to 8 do
+    begin
+        y := 81;
+        if 19 < b then
+        begin
+            z := ((83 * (z + b)) - x);
+            for j := 1 to 8 do
+            begin
+                y := (((z - 35) * 90) - y);
+                a := (((y + b) * z) + ((a * b) - (57 * 14)));
+                b := a
+            end
+        end
+        else
+        begin
+            b := ((a * (13 + a)) - ((63 - 78) - (44 - 47)));
+            for j := 1 to 8 do
+            begin
+                x := ((52 * (4 * z)) - ((y * 61) * (x + 6)));
+                x := (z + ((61 * 13) * (92 + 74)));
+                z := a
+            end
+        end;
+        z := (((62 * b) + 90) + 4)
+    end;
+    q10(x, y)
+end;
+
+procedure q30(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if y < ((69 * 12) * (z * x)) then
+    begin
+        writeln(y, z);
+        if a < z then
+        begin
+            if x < ((a * y) - (b * 76)) then
+            begin
+                a := ((29 - (x + 90)) + ((16 - 91) * (64 - 49)))
+            end
+            else
+            begin
+                b := ((23 - (b + x)) - ((51 + x) - (z - x)));
+                z := (39 - ((y - 27) + (a - 74)))
+            end
+        end
+        else
+        begin
+            y := (x - z)
+        end
+    end;
+    for i := 1 to 4 do
+    begin
+        if y < ((84 * a) - (36 * 48)) then
+        begin
+            a := 66
+        end
+        else
+        begin
+            a := (y - (z + (51 * 68)));
+            z := (((97 + 16) + (1 * x)) + b)
+        end;
+        x := (65 - ((a + z) - (z - 67)));
+        writeln(x, b)
+    end;
+    for i := 1 to 2 do
+    begin
+        b := 18
+    end;
+    for i := 1 to 5 do
+    begin
+        b := (((b - x) * (69 + x)) * (z * 41));
+        writeln(y, z);
+        z := z
+    end;
+    z := ((35 + (a + b)) - ((z * 76) - z));
+    if ((22 - 50) + (69 * y)) < (z * y) then
+    begin
+        if 48 < (91 - 60) then
+        begin
+            y := (((a - x) + (b + a)) + ((a - 94) + (z * a)));
+            for i := 1 to 2 do
+            begin
+                z := (68 * ((87 * 23) + (x + y)));
+                a := (((16 - x) - 73) - z);
+                a := (((a * x) - b) - (a * (a - x)))
+            end;
+            y := (((x + 85) - y) + ((b - y) - (21 * y)))
+        end;
+        writeln(a, y);
+        y := (((52 * 95) - 3) + b)
+    end
+    else
+    begin
+        z := ((y + (24 + a)) - (26 - (90 * b)));
+        z := (y + b)
+    end;
+    q19(x, y)
+end;
+
+procedure q31(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (((29 - a) * (a - x)) * ((a + x) + z));
+    b := x;
+    a := (((x * 96) * (x + a)) + 16);
+    b := a;
+    q17(x, y)
+end;
+
+procedure q32(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (6 + x);
+    if ((x - a) - z) < (b - b) then
+    begin
+        if ((a + z) - (z - a)) < a then
+        begin
+            z := 38;
+            if (b - x) < (83 + (a + 81)) then
+            begin
+                x := 71;
+                b := (((a - x) + z) + ((33 * 71) + (x + y)));
+                b := ((y + (23 + b)) * b)
+            end;
+            for i := 1 to 5 do
+            begin
+                y := 52
+            end
+        end
+        else
+        begin
+            if ((a + 98) * (a - z)) < 14 then
+            begin
+                x := (z - ((b + x) * (a + a)));
+                y := 4;
+                y := 29
+            end
+        end;
+        for i := 1 to 3 do
+        begin
+            a := 37;
+            z := (((a * y) * (y + 88)) - (35 - (92 + 20)))
+        end;
+        if y < ((a + x) + 24) then
+        begin
+            y := (((43 + 84) + (z * z)) + ((z * 29) * b));
+            writeln(a, x)
+        end
+    end;
+    writeln(a, x);
+    b := z;
+    writeln(y, b);
+    b := b;
+    a := ((z + (b + b)) + y);
+    q11(x, y)
+end;
+
+procedure q33(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((y * a) - a) < (y - (71 * 74)) then
+    begin
+        b := (67 - (z + z));
+        for i := 1 to 3 do
+        begin
+            x := (((x * x) + x) + a);
+            z := 25;
+            for j := 1 to 2 do
+            begin
+                z := (((x + 2) - (65 + y)) * (43 - (z + y)))
+            end
+        end;
+        a := y
+    end
+    else
+    begin
+        writeln(b, z)
+    end;
+    if ((z * 78) * (58 + x)) < ((y + z) * y) then
+    begin
+        if 71 < ((64 + b) - x) then
+        begin
+            b := (((98 - 18) + (x - z)) * z);
+            writeln(x, a)
+        end
+    end;
+    a := (((z + a) - (a + y)) * z);
+    writeln(y, a);
+    a := (((x + z) - 15) - ((19 * z) + (8 - 61)));
+    b := (((b + x) - 58) - ((a + 55) - (b - 62)));
+    q10(x, y)
+end;
+
+procedure q34(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (77 + 79);
+    x := 19;
+    x := 53;
+    a := (((82 * b) * (z + 28)) - z);
+    writeln(x, z);
+    x := (((59 - x) * (43 + 59)) - ((y - y) * 13))
+end;
+
+procedure q35(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (((70 + 65) * (54 + y)) * (a - (53 * 95)));
+    x := ((40 - (y + b)) - ((41 - z) - 25));
+    for i := 1 to 8 do
+    begin
+        if (94 + (b - b)) < ((98 * 71) + (a + z)) then
+        begin
+            z := (b - ((b - b) * (99 - 36)))
+        end
+        else
+        begin
+            for j := 1 to 3 do
+            begin
+                z := x
+            end
+        end
+    end
+end;
+
+procedure q36(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (a - 10);
+    y := (((24 - b) * (5 + 45)) - ((z * a) + (z * 28)));
+    if x < b then
+    begin
+        b := (((y - y) + x) - 76);
+        b := (((x - 78) - (x * 58)) + ((y - 83) * (b - b)))
+    end
+    else
+    begin
+        x := ((a * (x + y)) - ((x * 86) + (88 - x)))
+    end;
+    q3(x, y)
+end;
+
+procedure q37(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (x * ((z + 37) + (z * a)));
+    a := (((x - x) - (y - 16)) - (a + y));
+    a := 48;
+    if (7 - (a - x)) < ((b + a) + (z - 86)) then
+    begin
+        for i := 1 to 5 do
+        begin
+            y := (((x - 46) * (b * y)) + 60);
+            if b < ((x - 84) + (b + 50)) then
+            begin
+                z := a;
+                b := (((y + 31) + (a - 58)) - 11)
+            end
+            else
+            begin
+                z := (((a * y) + z) - ((a * a) + 74))
+            end;
+            a := (90 * ((x - b) - (37 * b)))
+        end
+    end;
+    if ((31 + a) + 19) < ((a + 10) + (77 - 75)) then
+    begin
+        b := (x + (a + (58 - 70)))
+    end
+    else
+    begin
+        y := x;
+        if ((77 - z) * (y + 19)) < (y - y) then
+        begin
+            x := (((z + x) - (x - z)) * ((y * 45) - b));
+            b := (b - (y + 16));
+            x := a
+        end
+        else
+        begin
+            x := (((a * b) - (b + x)) + ((a - 77) - x))
+        end
+    end;
+    if 33 < x then
+    begin
+        z := ((56 + x) * ((y - y) - y));
+        b := ((b * (x + 51)) + (67 - (x * z)))
+    end
+    else
+    begin
+        for i := 1 to 7 do
+        begin
+            z := ((b * (b * 20)) - ((63 * 15) + 16))
+        end;
+        for i := 1 to 5 do
+        begin
+            a := ((y - (70 - 88)) - ((a + b) + (26 - x)))
+        end
+    end
+end;
+
+procedure q38(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := ((y + z) - z);
+    x := (((b - z) + (50 * b)) - ((b - 85) - (y - 78)));
+    for i := 1 to 6 do
+    begin
+        for j := 1 to 7 do
+        begin
+            for k := 1 to 8 do
+            begin
+                b := 64
+            end;
+            writeln(y, x);
+            if ((31 + 23) * (54 + x)) < 10 then
+            begin
+                z := (a * (72 + x));
+                b := (((a * 13) + a) - ((44 + 94) * (b * 65)))
+            end
+            else
+            begin
+                y := ((z - a) * (38 - (b - z)))
+            end
+        end
+    end;
+    z := (((a * x) * x) + ((z * a) + (73 * 98)));
+    if (z + (b - 14)) < x then
+    begin
+        b := b;
+        for i := 1 to 8 do
+        begin
+            for j := 1 to 2 do
+            begin
+                y := (((b + z) - (a + z)) + 69);
+                a := (a + (z * (17 * a)));
+                a := y
+            end;
+            if ((57 * x) * 68) < ((a + y) * (a + 67)) then
+            begin
+                z := b
+            end
+            else
+            begin
+                y := (35 - ((8 - 50) - y))
+            end;
+            b := (((5 * 4) * (x * a)) - ((94 * 14) * (87 - 69)))
+        end
+    end
+    else
+    begin
+        y := ((36 * (b * z)) - x);
+        for i := 1 to 2 do
+        begin
+            x := (((a - x) - (y + a)) - ((57 + x) - (b + 84)))
+        end
+    end;
+    a := (y * ((x - x) * (45 + y)));
+    a := x
+end;
+
+procedure q39(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (x - ((x * x) + z));
+    z := z;
+    if ((z + 20) - (10 + z)) < ((a * 78) - (x - z)) then
+    begin
+        writeln(x, b);
+        if (a * 53) < ((x * b) - (b * y)) then
+        begin
+            for i := 1 to 4 do
+            begin
+                x := (z + ((24 - a) - y));
+                b := ((a + (y - y)) * ((x * 14) * 46));
+                y := (((90 + 93) * (11 + 76)) * ((y + z) - (x - z)))
+            end;
+            for i := 1 to 8 do
+            begin
+                x := ((94 + (z - x)) + y);
+                b := 78
+            end;
+            if ((b * 97) + 70) < (a - 74) then
+            begin
+                z := a;
+                a := ((36 * (11 * 94)) + ((z * 91) * (56 + 67)))
+            end
+            else
+            begin
+                a := b
+            end
+        end
+    end
+    else
+    begin
+        b := (a * ((a - b) * x))
+    end;
+    for i := 1 to 5 do
+    begin
+        z := (b - ((77 - x) + 97));
+        if ((y + x) * 91) < 63 then
+        begin
+            b := b;
+            if (34 * (y - a)) < 44 then
+            begin
+                x := (69 + (79 - a));
+                a := (((9 * b) - (69 - 30)) - ((b * 2) + (68 + y)));
+                x := (32 + y)
+            end;
+            x := (y + 78)
+        end;
+        z := (40 - ((y + z) - (b - y)))
+    end;
+    z := (((48 * 58) + (b - z)) + ((11 + b) - (y * 67)));
+    if (33 - (b + z)) < ((b * 70) - (42 - 66)) then
+    begin
+        if (a - z) < (a + (z - z)) then
+        begin
+            x := 93;
+            writeln(x, z)
+        end;
+        b := b;
+        if ((61 - x) * (18 + y)) < b then
+        begin
+            a := (69 - (b + (b - 25)));
+            y := (((x * b) + (b - z)) + y)
+        end
+        else
+        begin
+            writeln(z, y);
+            a := ((19 + 42) + (y - (z + y)))
+        end
+    end
+    else
+    begin
+        if ((a * 22) * (56 * x)) < ((x + x) - (y + 25)) then
+        begin
+            a := b;
+            x := (((a * x) * (x - 74)) + ((81 - y) * (14 + z)))
+        end;
+        b := (a + ((z - 25) * (x * z)))
+    end
+end;
+
+procedure q40(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        if (65 + (y + b)) < ((1 - x) + (a * 12)) then
+        begin
+            writeln(b, a)
+        end
+        else
+        begin
+            if (a * (b * 17)) < ((x + y) + (b + 34)) then
+            begin
+                a := (((58 * 22) + (b * y)) - ((x * 71) * (b - x)));
+                a := (((x - z) + (x + y)) - ((x - z) + (z - y)));
+                y := (x - ((30 * y) - (a + x)))
+            end
+        end;
+        writeln(z, b)
+    end;
+    writeln(z, b);
+    x := (b - (b + (a + b)));
+    b := x;
+    b := (((61 * y) * 50) + ((x - 94) - (x - 76)));
+    q38(x, y)
+end;
+
+procedure q41(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((79 * 10) * a) < x then
+    begin
+        for i := 1 to 8 do
+        begin
+            y := ((23 + (a - 45)) * ((a + z) * (y * 52)))
+        end;
+        a := (78 - ((69 - b) - (a + z)))
+    end
+    else
+    begin
+        y := y;
+        a := ((x + (x - x)) - ((a * 32) + b))
+    end;
+    for i := 1 to 8 do
+    begin
+        y := (94 * (a + (13 - a)));
+        x := (33 * ((56 + 74) - (70 + 7)))
+    end;
+    y := 36;
+    if (78 - (35 + a)) < ((y * 82) - x) then
+    begin
+        x := (((z - y) * x) - 64)
+    end
+    else
+    begin
+        for i := 1 to 6 do
+        begin
+            z := (((b * 48) - y) + z);
+            y := (((y + z) + (16 + b)) + (y * (54 * x)))
+        end
+    end
+end;
+
+procedure q42(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        if ((58 + 23) - x) < ((13 - y) - (80 + z)) then
+        begin
+            writeln(z, y);
+            writeln(x, b);
+            y := ((84 - (21 - b)) + ((b - a) + (z - 23)))
+        end
+    end;
+    for i := 1 to 3 do
+    begin
+        if ((a + 88) * (y - y)) < ((z * 92) + (8 - 93)) then
+        begin
+            z := (((x * 15) * x) + ((a - 10) - (b - y)))
+        end
+        else
+        begin
+            for j := 1 to 6 do
+            begin
+                b := b;
+                z := (21 * ((x + 89) + y));
+                b := x
+            end;
+            a := 96
+        end;
+        if ((45 * z) - (y * z)) < ((a - b) + 94) then
+        begin
+            for j := 1 to 7 do
+            begin
+                a := (((b * a) - (65 + z)) * (58 * (b * 32)));
+                y := 35
+            end
+        end;
+        b := (((x + b) * (a * 7)) - (y + (z + x)))
+    end;
+    for i := 1 to 8 do
+    begin
+        if ((z - 33) - (b - z)) < 34 then
+        begin
+            x := (((b - z) - (y * y)) - ((a + z) - (a * z)));
+            b := (b + (61 * (x + 61)));
+            writeln(x, z)
+        end
+        else
+        begin
+            if ((z - 1) - b) < ((b + 33) - (y - z)) then
+            begin
+                b := ((b - (76 - 6)) * ((32 - 76) - x));
+                x := (a - ((20 * b) * z));
+                x := (((a * 41) - (b + b)) - (34 - (18 + 55)))
+            end
+            else
+            begin
+                z := 48;
+                y := (((z - x) * a) * ((12 * 79) * (99 * x)))
+            end;
+            b := (44 - ((56 + x) + (a + b)))
+        end
+    end;
+    b := (((26 * 92) * 27) - z);
+    writeln(a, b)
+end;
+
+procedure q43(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := ((x + (x + y)) + ((b - y) - 76));
+    if z < (16 - (x - a)) then
+    begin
+        x := ((y - (x - 56)) * ((y - x) * (b + a)));
+        b := a;
+        b := (((b - z) + (24 - 15)) + y)
+    end;
+    writeln(x, z);
+    q1(x, y)
+end;
+
+procedure q44(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := 53;
+    y := ((x + 15) - ((57 + 82) + (x + z)));
+    z := (z + b);
+    a := ((32 + 39) - ((z * 35) + (b * 5)));
+    if ((24 + a) + z) < ((z - b) - (a * z)) then
+    begin
+        b := 63;
+        if (98 * 55) < ((b - 16) * (x - z)) then
+        begin
+            writeln(z, b)
+        end
+        else
+        begin
+            b := (68 * ((a * b) * (x + b)))
+        end
+    end
+end;
+
+procedure q45(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if (79 - (y - z)) < ((b * 1) + x) then
+    begin
+        writeln(z, a)
+    end
+    else
+    begin
+        y := (((32 - 83) - (x + x)) + (87 + x));
+        if x < ((b * a) * (a * x)) then
+        begin
+            x := z
+        end
+        else
+        begin
+            if z < ((y * 54) + (36 * 33)) then
+            begin
+                y := (a + ((b * x) + (63 * 73)));
+                z := ((a * 31) - ((51 * 45) * (74 * y)));
+                y := (a * (4 * (46 * b)))
+            end
+            else
+            begin
+                x := (z * ((b - 43) - (30 - 13)))
+            end;
+            writeln(a, y)
+        end
+    end;
+    y := ((63 - (x + 42)) + z);
+    if ((y * 26) + y) < (x - x) then
+    begin
+        for i := 1 to 3 do
+        begin
+            writeln(y, a);
+            b := (b + ((19 + a) * (z * 25)))
+        end;
+        z := (((96 - 47) - (b - a)) * 90);
+        z := (65 * ((78 + 92) * (b - a)))
+    end
+    else
+    begin
+        y := 3;
+        for i := 1 to 2 do
+        begin
+            b := x;
+            for j := 1 to 2 do
+            begin
+                y := (((y - x) - 66) - z);
+                a := (76 + (y * z));
+                b := (94 + (y - (x + x)))
+            end
+        end
+    end;
+    y := ((b - (44 - 68)) - 72);
+    q23(x, y)
+end;
+
+procedure q46(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := x;
+    z := (((z - b) - 20) * (b * 4));
+    for i := 1 to 3 do
+    begin
+        writeln(a, x);
+        for j := 1 to 4 do
+        begin
+            z := 44
+        end
+    end
+end;
+
+procedure q47(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((9 - b) + (y + y)) < ((76 + 12) * (73 * 67)) then
+    begin
+        if (b - (y - a)) < ((y - x) * (a + 40)) then
+        begin
+            if (a * 50) < 7 then
+            begin
+                z := (a + 29);
+                a := (((6 - a) - x) + ((y + z) + (y * x)));
+                x := (49 - (33 * 6))
+            end;
+            b := b;
+            writeln(y, a)
+        end
+        else
+        begin
+            x := (((x - 34) + (b + y)) + 61);
+            a := 24
+        end;
+        a := 57
+    end;
+    a := (((93 - a) + (23 - a)) - ((b + 43) * (y + 78)));
+    for i := 1 to 4 do
+    begin
+        for j := 1 to 7 do
+        begin
+            a := (((x - a) * z) + ((b * z) + 61))
+        end
+    end;
+    writeln(y, x);
+    for i := 1 to 8 do
+    begin
+        writeln(b, y);
+        for j := 1 to 7 do
+        begin
+            b := ((b - (48 * x)) + z);
+            if (27 - (y - 60)) < ((z + b) * 85) then
+            begin
+                y := (((28 - a) * (z - b)) - (z - b));
+                b := 73;
+                y := ((b * 41) * ((5 * a) + 7))
+            end
+            else
+            begin
+                x := b
+            end;
+            a := (((61 - 38) - b) + ((21 * y) * (32 + 19)))
+        end
+    end;
+    writeln(a, z);
+    y := (((x - b) - (86 * x)) + (x * (b * a)));
+    q31(x, y)
+end;
+
+procedure q48(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        x := z
+    end;
+    writeln(a, y);
+    b := x;
+    q27(x, y)
+end;
+
+procedure q49(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := ((80 + (y + 49)) - 90);
+    x := (((x + 93) - (x + 86)) + ((15 + 98) + a));
+    b := ((x * y) * ((a + 26) * (a + b)));
+    a := ((91 - (x * 8)) - b);
+    writeln(x, b)
+end;
+
+procedure q50(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(a, z);
+    x := (z - ((y - 95) + (88 - b)));
+    a := ((56 + (58 + 87)) + ((90 * 9) * 58));
+    y := (((b + a) * (y - 52)) - ((y - 18) - (20 - y)));
+    if (b + b) < y then
+    begin
+        z := z;
+        if ((a - 9) - (19 + y)) < ((x * x) * (77 + x)) then
+        begin
+            b := ((y + b) - ((x * x) * x));
+            if ((79 + 32) - (41 * 50)) < ((y - 94) - b) then
+            begin
+                x := (a - ((x - x) * (b * 38)));
+                b := ((a - a) + ((y + y) * x))
+            end
+            else
+            begin
+                b := ((a + y) - 49);
+                y := (((5 * z) * b) - b)
+            end;
+            b := (46 - a)
+        end
+        else
+        begin
+            for i := 1 to 8 do
+            begin
+                a := ((34 + 72) + 29);
+                a := b;
+                b := (((3 * 64) + (71 + z)) + a)
+            end
+        end
+    end
+    else
+    begin
+        for i := 1 to 7 do
+        begin
+            if z < 80 then
+            begin
+                x := (z - ((a * a) - (66 - a)));
+                a := ((x * (39 - b)) * ((a - b) - 50))
+            end;
+            y := (z * 32);
+            a := (((36 + y) * (a - b)) - ((a - 16) - b))
+        end
+    end;
+    a := ((b - (z - z)) - 28);
+    y := y;
+    q0(x, y)
+end;
+
+procedure q51(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((91 - 26) - b) < a then
+    begin
+        z := (((b * 7) - (y - x)) * ((x * 53) + (x - y)));
+        for i := 1 to 8 do
+        begin
+            writeln(a, x);
+            if ((z * a) - (81 + z)) < ((74 + 27) * (15 * z)) then
+            begin
+                x := ((x - 48) * ((29 * y) * (y + 97)))
+            end
+            else
+            begin
+                z := (((40 + 39) + (b + x)) + 88)
+            end
+        end;
+        x := (85 - x)
+    end
+    else
+    begin
+        z := (((y + x) + y) * ((x * a) - a))
+    end;
+    z := a;
+    x := 5;
+    z := ((a * 4) * ((z - 69) * (a * b)));
+    writeln(x, b);
+    z := (a + (b - x));
+    if ((90 + b) + (73 + x)) < ((89 - 14) - (z * a)) then
+    begin
+        x := ((18 + b) * 70)
+    end
+    else
+    begin
+        b := (b + ((x + a) + (z + b)));
+        b := ((y + z) + z)
+    end;
+    q48(x, y)
+end;
+
+procedure q52(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (81 - ((y + 51) + 48));
+    z := (62 * ((b + x) - (a - a)));
+    if ((x - x) - (40 - y)) < ((z * 85) * y) then
+    begin
+        for i := 1 to 3 do
+        begin
+            for j := 1 to 6 do
+            begin
+                b := (((x - x) * (z - 25)) * (38 + (z * y)));
+                b := 38
+            end;
+            for j := 1 to 5 do
+            begin
+                x := 64;
+                y := (z - 33);
+                y := ((x - (75 - y)) + 81)
+            end
+        end;
+        writeln(z, a)
+    end
+    else
+    begin
+        b := a;
+        a := x
+    end;
+    q6(x, y)
+end;
+
+procedure q53(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := z;
+    if b < ((z - 20) + (b + 50)) then
+    begin
+        for i := 1 to 2 do
+        begin
+            z := (a + (b + (a + 56)))
+        end
+    end;
+    for i := 1 to 8 do
+    begin
+        a := (((y * 3) * (y - 68)) - ((57 * b) * 88));
+        y := y
+    end;
+    x := (((88 * a) - (z - a)) - ((y - x) - (b + z)));
+    for i := 1 to 5 do
+    begin
+        writeln(x, a)
+    end;
+    if 12 < ((z - x) + (b + b)) then
+    begin
+        a := (((95 + y) - (b * 9)) + 69);
+        y := ((b + (b - a)) * (a - z));
+        if (b * z) < (a - (87 - y)) then
+        begin
+            z := (((97 - y) + (a + x)) - 49);
+            x := a;
+            b := (((x - a) + (y - 48)) + ((b * 38) - y))
+        end
+    end;
+    q18(x, y)
+end;
+
+procedure q54(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if (62 + (z + a)) < 35 then
+    begin
+        b := (((z - x) - (75 + 98)) - ((71 * 65) + (y - 57)))
+    end;
+    for i := 1 to 4 do
+    begin
+        if 36 < (b + (b - x)) then
+        begin
+            a := y
+        end
+    end;
+    b := ((x * (y - z)) * ((z * 77) + y));
+    z := (((z - 33) + (b + b)) + ((y - x) + 85));
+    x := (y + ((x + y) - (b - b)));
+    q39(x, y)
+end;
+
+procedure q55(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := ((a + (a * 7)) + (x * (46 * a)));
+    x := (a * 22);
+    if ((x * 10) * z) < (66 + (x + x)) then
+    begin
+        y := (((y - 31) - (y + 5)) + 19);
+        y := 37;
+        if ((56 - z) * (27 - 47)) < a then
+        begin
+            x := (((91 - x) * (x * 24)) + (a - (a + z)))
+        end
+        else
+        begin
+            writeln(b, y);
+            a := (((a + z) + z) - ((79 * a) - (x * 59)))
+        end
+    end
+    else
+    begin
+        z := (((60 * x) * a) + ((a * b) - a));
+        writeln(x, y)
+    end;
+    x := (((z * a) + (x + b)) + (62 + 94));
+    q42(x, y)
+end;
+
+procedure q56(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        writeln(b, z)
+    end;
+    x := (((b + 1) + 98) - (a * (60 * z)));
+    a := (b * ((80 + 21) + (z + x)));
+    y := (((52 + z) * (a * y)) * ((26 + b) + (x * a)));
+    writeln(y, a);
+    q6(x, y)
+end;
+
+procedure q57(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 3 do
+    begin
+        y := (((a * x) * (a + 86)) + ((36 - 10) * (x - x)));
+        a := (((47 + x) - (z + a)) + z);
+        if (74 * (85 - y)) < (54 + (a + z)) then
+        begin
+            y := 52
+        end
+    end;
+    z := ((b * (14 * 61)) + (88 * z));
+    if ((64 * y) + (z - y)) < ((x + 16) * (64 + 52)) then
+    begin
+        x := (((b + 30) + (88 - b)) - ((92 + 2) - b));
+        a := (((88 - b) * b) * ((x - a) - (a * x)));
+        a := (y + ((y - b) - 62))
+    end;
+    y := 3;
+    if ((71 * 19) + x) < (40 * (a + 33)) then
+    begin
+        if ((68 + 68) + z) < ((b + 93) - 76) then
+        begin
+            for i := 1 to 7 do
+            begin
+                z := a
+            end
+        end
+    end
+    else
+    begin
+        for i := 1 to 9 do
+        begin
+            z := z
+        end
+    end;
+    if 27 < ((14 * 71) - (b + a)) then
+    begin
+        z := (((27 + b) * 77) * ((y * b) * (63 + 43)));
+        z := ((x - (b + 81)) * b)
+    end;
+    a := (b - ((b + b) - (39 * a)))
+end;
+
+procedure q58(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := b;
+    for i := 1 to 8 do
+    begin
+        b := a
+    end;
+    b := z;
+    if ((z - 21) * (y - y)) < b then
+    begin
+        if (z - (15 * a)) < 15 then
+        begin
+            z := ((b + z) * (x * (x * b)));
+            y := (29 * ((10 - 70) + (b * x)));
+            a := (((93 + b) * (a * a)) - ((z + 46) - (z * x)))
+        end
+        else
+        begin
+            for i := 1 to 4 do
+            begin
+                z := (((b - a) - (y - z)) + b);
+                x := 36;
+                y := (x * a)
+            end
+        end;
+        b := ((81 - y) * ((3 * 68) + a));
+        writeln(y, x)
+    end;
+    q35(x, y)
+end;
+
+procedure q59(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if 83 < 64 then
+    begin
+        for i := 1 to 8 do
+        begin
+            if (b * 80) < ((x - a) + (17 - 68)) then
+            begin
+                x := (a - 50);
+                x := ((b * (b - a)) * y)
+            end;
+            if ((a + 48) + (b - b)) < ((x + a) - 27) then
+            begin
+                z := a;
+                b := ((59 * (16 * b)) + ((b + x) + a))
+            end;
+            writeln(z, y)
+        end
+    end;
+    y := 53;
+    if ((b + 4) * 15) < ((a + 43) - (x * y)) then
+    begin
+        if ((45 + 10) - (68 * 37)) < b then
+        begin
+            for i := 1 to 7 do
+            begin
+                y := 21
+            end;
+            writeln(z, b)
+        end
+        else
+        begin
+            x := (90 * (y * a));
+            if ((y * a) + (a + 8)) < (z + (50 + 10)) then
+            begin
+                b := b;
+                x := (((z + y) - (19 * z)) - 15)
+            end
+            else
+            begin
+                y := ((71 * (a + x)) * (58 * (7 * z)))
+            end
+        end
+    end;
+    x := a;
+    if (52 * (81 - 74)) < ((71 * 77) * (59 + 38)) then
+    begin
+        for i := 1 to 7 do
+        begin
+            z := a;
+            z := (((23 + b) - (56 - a)) - (b - (y + 23)));
+            if ((67 * z) - (67 + 72)) < ((1 - 85) + (73 * a)) then
+            begin
+                b := (((x + 49) * (a + y)) - 19);
+                z := (((b - b) + (66 - 6)) + (1 + (z - 50)));
+                a := 50
+            end
+        end
+    end
+    else
+    begin
+        if ((7 + a) * (z + 42)) < b then
+        begin
+            for i := 1 to 9 do
+            begin
+                b := x;
+                y := (((y + 98) - (x + a)) * ((50 + 73) * (x + z)));
+                x := b
+            end;
+            a := (((22 + y) + (60 + b)) * 1);
+            b := (x + ((49 + y) + (x - b)))
+        end
+    end;
+    b := (a - 31);
+    x := (((60 * 86) * a) + ((76 * 14) * y));
+    q34(x, y)
+end;
+
+procedure q60(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((30 - 30) * z) < 41 then
+    begin
+        b := (((z * 55) - (59 - 52)) - b);
+        if 49 < (24 + (b + 87)) then
+        begin
+            x := ((z + (b + 18)) - ((6 * x) + (37 * 21)));
+            a := (((30 * 56) * (65 - 39)) * ((a * x) - (a * 12)));
+            b := y
+        end
+        else
+        begin
+            for i := 1 to 4 do
+            begin
+                y := 79
+            end
+        end
+    end
+    else
+    begin
+        z := (((y * b) + (y * z)) - (88 * (x + 47)));
+        if ((y * a) + x) < (z - (b - 79)) then
+        begin
+            b := (z - ((b * 74) + (a * 42)));
+            x := ((50 + (z + 29)) - ((b * y) - (63 * y)))
+        end
+    end;
+    for i := 1 to 2 do
+    begin
+        y := (a + ((66 * a) - (b * 43)));
+        for j := 1 to 6 do
+        begin
+            x := x
+        end;
+        a := ((47 * (61 * 68)) + x)
+    end;
+    z := 90;
+    if (12 + (y * a)) < ((z * 97) - b) then
+    begin
+        for i := 1 to 7 do
+        begin
+            b := (((54 + 99) * (58 * x)) + 66);
+            x := (((41 * 37) + (z + 89)) - (1 + 48))
+        end;
+        for i := 1 to 5 do
+        begin
+            writeln(b, a)
+        end;
+        if (x - y) < (x - (y - y)) then
+        begin
+            b := (((38 * a) + (b - a)) * 91)
+        end
+    end;
+    if b < ((81 - 8) - (67 + y)) then
+    begin
+        z := (y - (b - (x * 62)))
+    end
+    else
+    begin
+        if ((66 * 49) * (51 + b)) < ((23 + b) + (28 * 24)) then
+        begin
+            b := 79
+        end
+        else
+        begin
+            if ((85 * x) + (b - 90)) < ((70 + x) - (y * 64)) then
+            begin
+                y := 74
+            end
+            else
+            begin
+                y := ((z - y) + z);
+                z := ((42 + (z + a)) * (51 * (71 + a)))
+            end;
+            z := (((z * 57) - (93 * 86)) * (a + x))
+        end
+    end;
+    q24(x, y)
+end;
+
+procedure q61(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((a - 21) + (a + 83)) < ((76 * a) + (z + b)) then
+    begin
+        for i := 1 to 9 do
+        begin
+            z := ((b * a) * ((b + a) + b))
+        end
+    end;
+    z := (((68 - 26) * (x * y)) - b);
+    x := (37 + z)
+end;
+
+procedure q62(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (((z - a) * 45) * ((95 * b) * (b * a)));
+    if b < x then
+    begin
+        x := ((34 + (4 + 7)) - 62);
+        y := z;
+        a := ((b - (14 - b)) * (37 + z))
+    end
+    else
+    begin
+        writeln(z, y);
+        x := (((45 - b) + 18) - (a + (a + y)))
+    end;
+    for i := 1 to 3 do
+    begin
+        a := ((a * (b * a)) - ((a - b) + (a + 37)));
+        z := ((a * y) + ((58 - 77) - (z + b)))
+    end;
+    for i := 1 to 4 do
+    begin
+        writeln(y, z);
+        b := z
+    end;
+    b := ((52 - (x * a)) + y);
+    x := 34;
+    for i := 1 to 3 do
+    begin
+        for j := 1 to 6 do
+        begin
+            b := (((x * 5) * 64) - ((b * y) * (y - 96)));
+            y := ((a - (b + 56)) + 66);
+            for k := 1 to 6 do
+            begin
+                a := ((34 + (85 + y)) + ((b + a) + (81 * 13)));
+                z := ((97 * (z - 15)) + ((69 * 38) * (10 * 34)));
+                b := x
+            end
+        end;
+        for j := 1 to 5 do
+        begin
+            writeln(z, x);
+            a := (z + ((24 + a) - (a + y)));
+            for k := 1 to 6 do
+            begin
+                y := (((75 * 62) * (z - a)) - (a - (z * y)))
+            end
+        end;
+        z := (((y * 85) * (a * 90)) * 50)
+    end
+end;
+
+procedure q63(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(y, a);
+    z := (z - x);
+    for i := 1 to 5 do
+    begin
+        z := (29 - ((z + 18) - (z - 9)));
+        z := (a * ((z * 27) * (y * a)));
+        b := z
+    end;
+    for i := 1 to 8 do
+    begin
+        if ((x - x) + (a + 36)) < y then
+        begin
+            y := ((x * (81 + a)) - ((a - z) + (80 + 81)))
+        end
+        else
+        begin
+            for j := 1 to 5 do
+            begin
+                y := (((z - 12) - (x * a)) * b);
+                y := (89 + (a + (z - x)));
+                b := x
+            end;
+            a := (z - (33 + 49))
+        end;
+        for j := 1 to 6 do
+        begin
+            if ((x - a) - (63 - a)) < ((x + z) * x) then
+            begin
+                y := ((x + 78) * ((y + 16) + y));
+                y := (((79 + a) + 13) + ((x * 82) - (z + z)))
+            end;
+            y := (23 * ((a - y) - (55 + a)));
+            writeln(a, b)
+        end
+    end;
+    for i := 1 to 5 do
+    begin
+        if (z * (7 - b)) < (x + b) then
+        begin
+            x := (((y - x) - (b + 10)) + y);
+            z := (((80 * 11) - (98 + x)) * ((a + 72) * (a - a)));
+            for j := 1 to 2 do
+            begin
+                y := ((25 + (30 - 65)) + 43)
+            end
+        end;
+        if 90 < ((y - x) * (45 + x)) then
+        begin
+            writeln(x, z);
+            z := x;
+            for j := 1 to 9 do
+            begin
+                y := ((97 * (z + y)) * (y * (z * b)));
+                z := 41;
+                b := (88 + a)
+            end
+        end;
+        writeln(z, y)
+    end
+end;
+
+procedure q64(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (((b + a) + (85 * y)) + ((67 * 92) * (b + a)));
+    b := a;
+    for i := 1 to 8 do
+    begin
+        a := z;
+        for j := 1 to 9 do
+        begin
+            a := ((a - 71) - ((11 * a) - 99));
+            if (z - (5 + a)) < ((1 - 36) - (y + a)) then
+            begin
+                y := (y - a);
+                b := (x + ((35 * z) * 98))
+            end
+            else
+            begin
+                x := (((y + y) + (z * z)) + ((63 * a) - (x - 73)));
+                y := b
+            end;
+            a := 98
+        end
+    end;
+    writeln(y, b);
+    q38(x, y)
+end;
+
+procedure q65(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 2 do
+    begin
+        b := (((a - x) * 63) - (z * (19 - z)));
+        b := (y - (x * (b + 45)));
+        for j := 1 to 7 do
+        begin
+            if z < 19 then
+            begin
+                x := (a + (44 - b))
+            end
+            else
+            begin
+                y := (((93 - a) - (67 + x)) * (10 - (x + a)))
+            end;
+            if ((8 + x) + (14 * b)) < ((x + 57) + (a + y)) then
+            begin
+                a := a;
+                z := (((b * y) * (y - x)) - ((a * 66) + (x * a)));
+                x := z
+            end
+        end
+    end;
+    b := 28;
+    writeln(x, y);
+    q30(x, y)
+end;
+
+procedure q66(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if y < ((y - z) + (39 * z)) then
+    begin
+        writeln(x, b);
+        x := (x + ((a - z) - (y + b)))
+    end;
+    a := (((y * 94) + (30 + 13)) - ((a + x) * (7 * 22)));
+    for i := 1 to 8 do
+    begin
+        for j := 1 to 5 do
+        begin
+            if ((b + 86) + 73) < ((y * 11) - b) then
+            begin
+                z := 80;
+                y := 64
+            end
+            else
+            begin
+                b := (((76 * a) + (7 + 37)) * ((2 + 75) + a));
+                y := 98
+            end;
+            a := (((84 - 79) + (b - 44)) + a)
+        end;
+        y := (((y * z) - (a * 62)) * 92);
+        if x < ((29 + y) - (21 - b)) then
+        begin
+            for j := 1 to 2 do
+            begin
+                y := (x + (b * (20 + 40)))
+            end
+        end
+        else
+        begin
+            a := (((6 - z) * (b + a)) + ((79 + x) - (73 * 70)))
+        end
+    end;
+    z := (z - ((b - 23) + (x - a)));
+    y := ((15 + (29 * 1)) + 22);
+    q21(x, y)
+end;
+
+procedure q67(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((88 - y) + (b * z)) * x);
+    for i := 1 to 9 do
+    begin
+        writeln(b, a);
+        z := x;
+        writeln(y, b)
+    end;
+    y := (62 + (40 + (18 + 62)));
+    q6(x, y)
+end;
+
+procedure q68(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 6 do
+    begin
+        b := 8;
+        x := 84;
+        b := (((x * 26) * a) + a)
+    end;
+    b := y;
+    b := (b + ((y - 53) - (a - 77)));
+    y := (((z + a) * z) + ((96 + y) * 75))
+end;
+
+procedure q69(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := 95;
+    for i := 1 to 6 do
+    begin
+        for j := 1 to 8 do
+        begin
+            a := (y + ((x - 51) - (6 - y)))
+        end
+    end;
+    writeln(a, y);
+    a := (33 - ((b * b) * a));
+    z := ((b - (x + y)) * 44);
+    writeln(z, x);
+    b := z
+end;
+
+procedure q70(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 9 do
+    begin
+        writeln(z, a);
+        if (x * 88) < (b + (37 - 24)) then
+        begin
+            for j := 1 to 7 do
+            begin
+                b := a;
+                b := 47;
+                z := (35 - ((z * x) - (93 - 82)))
+            end;
+            b := (y - ((z - 9) - a))
+        end
+        else
+        begin
+            z := (z - ((y * x) * (y + b)));
+            x := z
+        end;
+        writeln(x, b)
+    end;
+    x := 34;
+    for i := 1 to 5 do
+    begin
+        if a < ((a - b) * (a + a)) then
+        begin
+            writeln(x, b);
+            a := 58
+        end
+        else
+        begin
+            b := ((56 * (y + b)) * ((87 + 53) - (29 - b)));
+            for j := 1 to 8 do
+            begin
+                b := x;
+                a := (((y * x) - (6 + b)) - (x + (25 + z)));
+                z := (98 - ((b + b) - (b * 23)))
+            end
+        end
+    end
+end;
+
+procedure q71(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 4 do
+    begin
+        if ((x * b) + y) < 67 then
+        begin
+            for j := 1 to 2 do
+            begin
+                y := (((x + y) - a) - ((y + y) * (98 * 26)));
+                a := y
+            end;
+            z := 87;
+            for j := 1 to 4 do
+            begin
+                y := (((34 * 52) - x) + 28);
+                b := z;
+                a := (45 * ((b + 46) - z))
+            end
+        end;
+        x := ((93 - (a * y)) * (1 - (z - 84)));
+        for j := 1 to 4 do
+        begin
+            if 23 < (85 - 61) then
+            begin
+                a := (x - b);
+                a := (((z * y) - 12) * ((x - x) + 18));
+                b := (z * (20 - b))
+            end
+        end
+    end;
+    z := (((z * a) + (30 + 99)) + 87);
+    if ((z * 84) * (b * 90)) < (81 - (z * 75)) then
+    begin
+        b := a;
+        for i := 1 to 7 do
+        begin
+            if ((73 * x) - b) < ((x * 56) - (z - 12)) then
+            begin
+                y := (((x + b) - (b + y)) - ((57 + z) * (y + a)));
+                z := (a + ((55 - a) - (80 * 98)))
+            end
+            else
+            begin
+                x := ((x - (x + 40)) * z);
+                z := 34
+            end
+        end;
+        y := x
+    end;
+    q67(x, y)
+end;
+
+procedure q72(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := y;
+    y := (z * ((35 + a) + (58 + b)));
+    y := (((45 + y) - (17 + a)) + ((49 + z) + (19 * 14)));
+    a := 43;
+    if ((b - y) + (a * 9)) < x then
+    begin
+        x := (z * ((b + 21) * (b + x)))
+    end
+    else
+    begin
+        a := y;
+        if ((85 - 70) + 84) < ((x - 7) + (83 * 57)) then
+        begin
+            x := b;
+            if x < (79 - (y - 97)) then
+            begin
+                b := (2 + z)
+            end
+        end
+        else
+        begin
+            b := y
+        end
+    end;
+    a := (((2 - 19) - (x + 8)) + a);
+    b := (((y + b) - (17 + x)) - 75)
+end;
+
+procedure q73(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := ((x + (53 - 70)) - ((61 * 64) - (z * 24)));
+    writeln(a, y);
+    z := 57;
+    q60(x, y)
+end;
+
+procedure q74(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := a;
+    if ((z - 65) * (63 + 58)) < ((13 + a) + (6 + 89)) then
+    begin
+        z := 10;
+        a := (((29 * a) * (89 - x)) * ((b + y) - (z - a)));
+        x := b
+    end
+    else
+    begin
+        for i := 1 to 6 do
+        begin
+            if ((95 * z) + x) < ((z * z) * (y + 2)) then
+            begin
+                y := ((41 + (x * 24)) - ((z * b) - 61));
+                b := b
+            end
+            else
+            begin
+                x := (4 * ((z - x) - x))
+            end;
+            z := (((20 * z) * 24) + (80 * 44));
+            b := (a + b)
+        end;
+        if 11 < b then
+        begin
+            x := ((b - (y - 14)) * z)
+        end
+    end;
+    x := (((y + z) - (b - y)) * ((x * y) * b));
+    b := ((b + (x + 69)) + (66 * (15 + z)));
+    q52(x, y)
+end;
+
+procedure q75(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 6 do
+    begin
+        for j := 1 to 3 do
+        begin
+            b := a;
+            y := (22 * b);
+            if (a + (b - z)) < ((x * 54) * 99) then
+            begin
+                y := ((y + (z + 65)) * ((27 + 53) * a));
+                z := (((y + z) - (a + z)) + z);
+                z := ((60 * (68 - a)) - ((a - 93) - (z * x)))
+            end
+            else
+            begin
+                y := ((89 + (z * 70)) * 23)
+            end
+        end;
+        if 94 < x then
+        begin
+            writeln(y, z);
+            if ((18 - x) * (b - z)) < a then
+            begin
+                b := (((19 * z) - z) - ((z - y) - (74 - a)));
+                b := (((y + y) * (y * z)) + (a - z))
+            end
+            else
+            begin
+                x := (5 + ((y - a) + (z - a)));
+                a := (((6 - z) * y) - ((x - 31) + 48))
+            end;
+            writeln(a, z)
+        end
+        else
+        begin
+            if ((z - 3) - (x * y)) < ((38 - a) * (3 * y)) then
+            begin
+                a := 27
+            end
+            else
+            begin
+                x := (((z + x) * (y - a)) - 15)
+            end;
+            x := (((y + b) + (b * 38)) - (y - (42 - z)))
+        end;
+        b := 30
+    end;
+    for i := 1 to 7 do
+    begin
+        a := (28 + 77)
+    end;
+    b := (((9 * 31) * 64) + (94 + (x * b)));
+    for i := 1 to 6 do
+    begin
+        for j := 1 to 7 do
+        begin
+            if ((42 - a) - a) < ((z + y) - x) then
+            begin
+                b := 94;
+                x := 60;
+                z := (((x * x) + (b + b)) - 89)
+            end
+            else
+            begin
+                a := (((72 + b) - (x * x)) * y)
+            end
+        end
+    end;
+    for i := 1 to 8 do
+    begin
+        if b < ((a * a) - (x - 64)) then
+        begin
+            if ((y * 40) + z) < (y - (z * a)) then
+            begin
+                a := (((z + 88) * (a * z)) - (x * (39 * 86)));
+                y := (((63 - 74) - (z * z)) + z);
+                z := (((18 - b) * (11 - x)) * ((x + 27) - (67 - 14)))
+            end
+            else
+            begin
+                b := (((a * y) * 44) * 95)
+            end
+        end;
+        for j := 1 to 4 do
+        begin
+            z := z
+        end
+    end;
+    if ((x + 85) - (a * a)) < ((y + 16) + (11 + z)) then
+    begin
+        if ((41 - y) + (42 * 65)) < (b - y) then
+        begin
+            writeln(z, y)
+        end
+        else
+        begin
+            y := 66;
+            if (z + (70 - 97)) < ((x - 12) * (y + z)) then
+            begin
+                a := y
+            end
+        end
+    end;
+    for i := 1 to 5 do
+    begin
+        y := z;
+        y := ((a - (y + a)) * ((82 + x) - (x + z)))
+    end
+end;
+
+procedure q76(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := y;
+    b := ((87 - (z + b)) + ((y - z) * (73 + z)));
+    if 59 < ((45 + 31) - (18 - x)) then
+    begin
+        y := (((97 - 35) * (x + z)) + (x * y))
+    end
+    else
+    begin
+        x := 78;
+        a := (((54 + b) - b) + (30 + (46 - a)))
+    end;
+    x := y
+end;
+
+procedure q77(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := b;
+    if (z - 19) < y then
+    begin
+        for i := 1 to 9 do
+        begin
+            if ((b + a) - (24 - b)) < z then
+            begin
+                b := ((a - y) * (5 + (31 - 54)));
+                a := (75 + z);
+                a := x
+            end
+        end
+    end;
+    y := b;
+    if b < y then
+    begin
+        z := (b + 33);
+        x := (((b * 9) - (x + b)) + (17 + (y + b)));
+        z := a
+    end;
+    y := ((27 * 46) - 61);
+    q59(x, y)
+end;
+
+procedure q78(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if (18 - (46 * a)) < (a - (a + 70)) then
+    begin
+        writeln(x, y);
+        z := (((17 + a) + (y - b)) - ((z + y) - (a - a)))
+    end
+    else
+    begin
+        b := (((x * y) + (z * x)) - 2)
+    end;
+    b := 88;
+    writeln(b, a);
+    x := b;
+    a := b;
+    if ((z + 1) * (73 + a)) < (a - (20 + y)) then
+    begin
+        writeln(z, y)
+    end;
+    for i := 1 to 8 do
+    begin
+        for j := 1 to 7 do
+        begin
+            for k := 1 to 3 do
+            begin
+                x := (z * ((a + 32) - a));
+                z := ((z - x) * x);
+                x := (z * (35 - (a + b)))
+            end;
+            a := (((z + 84) + (x + y)) + a)
+        end
+    end;
+    q41(x, y)
+end;
+
+procedure q79(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (b - (b * 18));
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 8 do
+        begin
+            for k := 1 to 7 do
+            begin
+                x := ((y * y) - z);
+                b := (96 + 73)
+            end
+        end
+    end;
+    if ((b + 34) * (y - 29)) < ((97 - a) - (57 - 82)) then
+    begin
+        a := b;
+        y := (((40 - 34) + (11 - 69)) + a)
+    end;
+    y := (a * ((45 * 20) + z))
+end;
+
+procedure q80(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((z - a) * b) < (14 * (x + x)) then
+    begin
+        if ((y * a) + 56) < ((21 - b) + (36 - 12)) then
+        begin
+            z := (z + (30 - 37))
+        end;
+        if ((x * 69) + (a - 13)) < (x - 11) then
+        begin
+            a := x;
+            for i := 1 to 8 do
+            begin
+                b := (65 - b)
+            end;
+            b := z
+        end
+    end;
+    a := (x - (64 * 98));
+    for i := 1 to 8 do
+    begin
+        if 50 < (46 * (7 * a)) then
+        begin
+            for j := 1 to 9 do
+            begin
+                x := ((44 + (a + b)) * ((a - y) * (60 + 14)));
+                z := (20 + ((76 * 33) - (b - b)));
+                y := (24 - ((47 - z) + 86))
+            end;
+            if 28 < ((a - y) * (x - y)) then
+            begin
+                y := (((32 * 47) * (19 + a)) - ((a - 28) + (84 * 21)))
+            end
+            else
+            begin
+                a := (((x * a) + (y * 10)) + (x + (98 * y)))
+            end;
+            for j := 1 to 8 do
+            begin
+                b := (((z + x) + (36 - b)) - ((16 - z) - (15 + a)));
+                y := (x * (b - (98 * 60)));
+                y := x
+            end
+        end
+        else
+        begin
+            if ((x + a) - 60) < x then
+            begin
+                b := ((x + (57 - 39)) * ((50 + b) - 88));
+                b := (x + ((y * 88) + 91));
+                x := y
+            end
+            else
+            begin
+                b := z
+            end;
+            if ((4 - z) - (a * x)) < (a * (99 + z)) then
+            begin
+                x := (((41 + 95) - (y * y)) - ((a * 4) + (b + y)));
+                b := (b + (a - (63 - 63)))
+            end
+            else
+            begin
+                x := 48
+            end
+        end
+    end;
+    x := (((b + 75) + 23) + y);
+    writeln(z, a);
+    x := y
+end;
+
+procedure q81(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (((28 + b) - (x * a)) - (y + z));
+    a := (((56 + 1) * y) - x);
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 5 do
+        begin
+            for k := 1 to 4 do
+            begin
+                y := 21;
+                a := (39 * (92 - (22 - 71)))
+            end;
+            for k := 1 to 7 do
+            begin
+                x := (((a * 56) - (y - 3)) + a)
+            end;
+            for k := 1 to 4 do
+            begin
+                b := (((31 * x) * (b + 45)) + b);
+                a := 84;
+                x := (94 + (88 + z))
+            end
+        end
+    end
+end;
+
+procedure q82(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := ((38 + (y + z)) + ((b + x) - 8));
+    x := (((79 + 16) + b) + ((b + 50) + (83 + y)));
+    a := (b + (y - (z * 33)));
+    b := (((b + z) + (35 - 35)) + 9);
+    b := (((b + a) - 67) - ((34 - 17) - (b + 65)));
+    for i := 1 to 6 do
+    begin
+        if ((76 + 1) - (a - y)) < (b + (56 - z)) then
+        begin
+            y := (((z - 46) * (z + 42)) * ((b + 35) - (22 - b)))
+        end;
+        for j := 1 to 7 do
+        begin
+            z := ((2 + (y + 39)) - z);
+            if ((b + x) + z) < y then
+            begin
+                y := a;
+                x := (y + x)
+            end;
+            b := (74 + 69)
+        end;
+        for j := 1 to 4 do
+        begin
+            y := 29
+        end
+    end;
+    a := ((y - (x - y)) + ((x + 92) - b));
+    q25(x, y)
+end;
+
+procedure q83(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((27 + 15) + (34 - 56)) - a);
+    x := (26 - y);
+    for i := 1 to 9 do
+    begin
+        if ((33 * z) + (9 - x)) < a then
+        begin
+            if ((x * b) - (x - y)) < y then
+            begin
+                z := (((2 + x) * (b - a)) - (x + (1 * z)));
+                x := ((x + (a + b)) - (x - (95 + y)))
+            end
+        end;
+        b := (((y * 45) - y) + ((z + x) * z))
+    end;
+    if ((y * a) + (a * z)) < (y - 30) then
+    begin
+        x := ((y * (y - 16)) * (y - (11 * z)));
+        z := (87 * (b * (b * z)));
+        if ((x * a) * (b + 8)) < 55 then
+        begin
+            if ((4 - b) + (b * 87)) < (z * 79) then
+            begin
+                z := (((y * b) + (a * x)) * x)
+            end
+            else
+            begin
+                z := ((87 + (z * x)) - ((a - a) * (b + z)))
+            end;
+            for i := 1 to 6 do
+            begin
+                z := (7 * 87)
+            end;
+            if 15 < ((50 * x) * z) then
+            begin
+                a := 33;
+                z := (((12 - y) + z) + (a + 5));
+                a := (((54 * x) - (a * 59)) + ((73 + 60) * z))
+            end
+            else
+            begin
+                y := (y + b)
+            end
+        end
+    end
+    else
+    begin
+        b := (((36 - z) - (x - 88)) - (x * (b * 28)))
+    end;
+    a := ((x + x) * ((8 + 84) - 38));
+    q40(x, y)
+end;
+
+procedure q84(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((b * 33) * (57 - 36)) < ((90 - 66) * z) then
+    begin
+        writeln(b, x);
+        y := (((a - y) * (53 - b)) - ((b + 33) + (b - b)))
+    end
+    else
+    begin
+        y := (((x - 76) * (z * b)) - ((52 * y) - (y + b)));
+        b := 33
+    end;
+    if (z * 11) < a then
+    begin
+        a := y
+    end;
+    z := (((b + 94) * a) + ((z - z) * (86 - b)));
+    a := (((b + b) + (y - 14)) * ((17 * 70) + (52 * a)));
+    q46(x, y)
+end;
+
+procedure q85(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 2 do
+    begin
+        for j := 1 to 8 do
+        begin
+            writeln(y, x)
+        end;
+        writeln(b, x)
+    end;
+    if x < (b + (z - 13)) then
+    begin
+        y := ((45 + z) * x)
+    end;
+    if ((z - y) + 38) < ((37 * 35) - (z - 29)) then
+    begin
+        writeln(a, y);
+        a := (((89 * 46) + (b * a)) - (z + (a - a)))
+    end;
+    if ((z - 32) * (7 * y)) < z then
+    begin
+        if ((x + a) + (70 + z)) < y then
+        begin
+            if ((z - 70) * (81 * 85)) < ((x + 44) + (y * 27)) then
+            begin
+                y := b;
+                y := 65;
+                a := (((z * a) * 92) + ((x + b) * (y - x)))
+            end;
+            for i := 1 to 2 do
+            begin
+                y := 15;
+                y := 88
+            end
+        end
+    end
+    else
+    begin
+        z := (((47 * y) * (69 * 99)) + ((a - a) * (74 - y)))
+    end
+end;
+
+procedure q86(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := z;
+    a := ((z - z) - 67);
+    x := (y - 48);
+    z := (35 + ((b * a) + 82));
+    x := 44;
+    b := (((z - a) * (y + z)) - 60);
+    q63(x, y)
+end;
+
+procedure q87(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 6 do
+    begin
+        writeln(z, b);
+        x := ((x + (a * z)) * ((x - 51) - x))
+    end;
+    y := (49 + 14);
+    if ((y + b) - (b + a)) < ((b * y) + (12 - a)) then
+    begin
+        x := (((x + z) - (a * x)) * (41 * (75 + y)));
+        a := (((y * 92) - (y + b)) - ((72 - a) - (b + 89)))
+    end
+    else
+    begin
+        if a < (a * (b + 19)) then
+        begin
+            if (27 * (x + z)) < ((51 - z) * y) then
+            begin
+                b := x
+            end;
+            b := (a + (23 * x));
+            a := (((y - 11) - (17 - y)) - ((26 * 16) + 37))
+        end;
+        b := 81
+    end;
+    if y < (54 * (51 - 94)) then
+    begin
+        y := a;
+        a := (((18 * a) * (94 + y)) - 56)
+    end
+    else
+    begin
+        for i := 1 to 8 do
+        begin
+            x := (21 + (z * (52 - 94)));
+            z := (((a * 76) * (96 * 91)) - ((z * a) * (41 + 77)))
+        end;
+        if (y - b) < (b + z) then
+        begin
+            a := (30 - 24);
+            for i := 1 to 8 do
+            begin
+                b := z;
+                x := (((21 - y) * (z * b)) + ((8 - 38) + (a * x)));
+                x := (((x - x) * (x * 50)) + ((80 - y) + z))
+            end;
+            if ((a - x) * (x - z)) < ((46 - b) - (a + y)) then
+            begin
+                y := ((a - (a + x)) - 76);
+                x := 26
+            end
+            else
+            begin
+                y := 41;
+                a := (((a * x) + (y + x)) * 69)
+            end
+        end
+        else
+        begin
+            if 2 < ((z - z) - b) then
+            begin
+                b := (((a - y) * (2 * b)) * x);
+                z := 56;
+                z := a
+            end;
+            writeln(x, b)
+        end
+    end;
+    x := (((20 + z) * (x * x)) * ((9 * 95) - (93 + z)))
+end;
+
+procedure q88(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((90 * 36) + (b + 55)) < 93 then
+    begin
+        z := (y - (57 + (b * a)));
+        z := ((b - (47 - y)) * ((20 + b) + (z * 4)));
+        writeln(b, z)
+    end
+    else
+    begin
+        y := (70 * (36 - (x + 57)))
+    end;
+    x := ((70 * (y * z)) + (a * (z * 22)));
+    z := z;
+    b := (((52 + z) - (z + 43)) * 70);
+    q72(x, y)
+end;
+
+procedure q89(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        if 4 < ((50 * 77) + (z + b)) then
+        begin
+            for j := 1 to 8 do
+            begin
+                b := 66;
+                y := (((x + x) - (z * 25)) - ((57 + 99) + (28 + x)));
+                x := (((68 - 87) * x) - z)
+            end;
+            for j := 1 to 3 do
+            begin
+                x := (((97 + 83) - (z - y)) * ((y - 69) + (x * y)))
+            end;
+            for j := 1 to 6 do
+            begin
+                z := (30 - ((a + b) * (y * 16)));
+                y := ((86 + (z - 96)) + (43 * (39 * b)))
+            end
+        end
+        else
+        begin
+            x := x;
+            for j := 1 to 8 do
+            begin
+                y := (61 * a);
+                z := (y - ((55 + x) + (10 * 52)))
+            end
+        end;
+        for j := 1 to 3 do
+        begin
+            if 30 < (y - (z - 27)) then
+            begin
+                y := 17;
+                b := (31 + (x * 75));
+                b := 54
+            end
+            else
+            begin
+                y := (((x * b) - 5) + ((b - 70) + 93));
+                y := (((3 + y) * x) - (z + 45))
+            end;
+            x := (((y + y) + (b + x)) * ((43 - b) * 49));
+            if z < z then
+            begin
+                b := ((27 - (33 * b)) + ((x - 30) + y));
+                a := (((x + z) - (x + a)) - b)
+            end
+            else
+            begin
+                z := 48;
+                a := 62
+            end
+        end;
+        writeln(a, x)
+    end;
+    a := ((z - a) - (a * (41 - x)));
+    if ((a + 75) * 93) < 23 then
+    begin
+        if b < z then
+        begin
+            if ((a * b) + x) < (a + (z * a)) then
+            begin
+                b := 19;
+                b := x
+            end
+            else
+            begin
+                b := a
+            end;
+            z := ((z - b) + ((a + z) - (87 - b)))
+        end
+        else
+        begin
+            x := ((z - (a * 46)) + ((81 + z) * (z - 46)));
+            a := (y - ((y - 48) + (z - a)))
+        end;
+        x := z;
+        for i := 1 to 4 do
+        begin
+            if ((51 - 86) + (y + 99)) < ((20 - y) - (a - b)) then
+            begin
+                y := (((x + 37) - (y + 4)) - ((x * b) * (70 * a)));
+                b := ((66 * a) + 61);
+                a := (1 + 62)
+            end;
+            writeln(a, b)
+        end
+    end
+    else
+    begin
+        for i := 1 to 3 do
+        begin
+            writeln(x, y)
+        end;
+        if (51 + (b * b)) < ((y + 25) * z) then
+        begin
+            for i := 1 to 6 do
+            begin
+                z := 11
+            end;
+            writeln(a, b);
+            for i := 1 to 8 do
+            begin
+                y := a;
+                z := z;
+                a := (z + 32)
+            end
+        end
+    end;
+    z := 25;
+    x := (54 - (69 + 70));
+    if 10 < ((a - 12) + (75 * 85)) then
+    begin
+        a := b;
+        if y < ((z + 10) * (b + 99)) then
+        begin
+            x := (a + (y * (z + z)))
+        end
+        else
+        begin
+            y := 12
+        end;
+        if 91 < 3 then
+        begin
+            y := (67 * (b * (41 + 90)))
+        end
+        else
+        begin
+            writeln(y, x)
+        end
+    end
+    else
+    begin
+        if z < (64 - (y + 37)) then
+        begin
+            b := a
+        end
+        else
+        begin
+            x := z
+        end;
+        for i := 1 to 4 do
+        begin
+            z := b;
+            writeln(b, y)
+        end
+    end;
+    if (37 - (y * z)) < x then
+    begin
+        x := (((4 - x) - (52 + z)) - ((a - y) + (x + a)));
+        a := 84
+    end;
+    q28(x, y)
+end;
+
+procedure q90(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(y, z);
+    if 66 < ((1 * 53) - (x + z)) then
+    begin
+        y := a
+    end
+    else
+    begin
+        b := (x + ((68 + z) * (x + z)))
+    end;
+    z := (14 * a)
+end;
+
+procedure q91(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (76 + (38 + (47 - a)));
+    for i := 1 to 9 do
+    begin
+        b := (x + ((43 + z) - (z + 34)));
+        z := (((71 + z) * (3 - x)) - ((4 * 60) * (b + z)));
+        if (31 * (x - x)) < ((x * 70) - 1) then
+        begin
+            for j := 1 to 8 do
+            begin
+                x := (70 - a);
+                y := (48 - (y - z));
+                z := (a * y)
+            end;
+            for j := 1 to 4 do
+            begin
+                y := y;
+                b := ((b + (23 + a)) + b);
+                x := (((z - x) * (y * 2)) + a)
+            end
+        end
+        else
+        begin
+            b := (((b + z) + (x + 18)) * (80 * y))
+        end
+    end;
+    b := ((y * (a - 76)) + ((a - b) - (16 + z)));
+    z := ((y + (z + 28)) - ((z + a) + (56 + b)));
+    if ((y + x) - (y * 19)) < x then
+    begin
+        if 11 < ((z + y) - (b - a)) then
+        begin
+            x := 14;
+            writeln(y, z);
+            y := (((83 - a) * x) - ((z + b) + (z * 4)))
+        end
+        else
+        begin
+            for i := 1 to 5 do
+            begin
+                b := z;
+                b := z
+            end;
+            if ((y + b) * (a * x)) < (73 * a) then
+            begin
+                y := (((z + y) * (z + 64)) - (27 * x))
+            end
+        end;
+        y := (x + ((48 + 63) + (x + 32)));
+        x := (((53 - z) - (x * x)) + b)
+    end
+    else
+    begin
+        for i := 1 to 8 do
+        begin
+            x := (54 + ((23 * 95) - (75 + x)));
+            if x < ((a + b) - (a - 64)) then
+            begin
+                b := ((59 + 68) + b);
+                b := ((z * (y - y)) + ((b * a) + b));
+                a := (((x + x) * 28) - ((z + 89) * (a * a)))
+            end
+        end;
+        for i := 1 to 6 do
+        begin
+            writeln(y, b);
+            x := (7 + (98 + (48 + 1)));
+            x := x
+        end
+    end
+end;
+
+procedure q92(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((a + 94) * (95 + a)) < b then
+    begin
+        y := (((25 * 14) - (x - z)) + 2)
+    end
+    else
+    begin
+        for i := 1 to 7 do
+        begin
+            a := (((z + y) * 68) * ((a - x) * (z - z)));
+            for j := 1 to 8 do
+            begin
+                z := y;
+                a := (((27 - x) * (y - b)) * ((b * 99) * y))
+            end
+        end;
+        for i := 1 to 3 do
+        begin
+            writeln(y, x);
+            for j := 1 to 3 do
+            begin
+                x := (((1 + z) - 60) + ((b - x) * (b * x)));
+                b := b;
+                a := (((2 * b) * (62 - a)) + ((b * 84) * (z + a)))
+            end
+        end
+    end;
+    a := ((x - 7) - ((85 - 13) * (55 + 75)));
+    for i := 1 to 3 do
+    begin
+        z := (((x + 93) * (25 - 3)) + ((x + 49) * (y * b)));
+        a := ((2 - 62) * a)
+    end;
+    z := 43;
+    a := b;
+    a := (z * y);
+    writeln(z, y)
+end;
+
+procedure q93(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (((77 + z) - (x - z)) - ((b + b) + (89 + 53)));
+    b := (x - ((y * a) + (95 * 3)));
+    for i := 1 to 2 do
+    begin
+        y := (((x - b) - (b * b)) + ((28 - b) + a))
+    end;
+    for i := 1 to 5 do
+    begin
+        for j := 1 to 3 do
+        begin
+            x := ((b - (x * 77)) + (7 - (54 - y)));
+            z := (11 + ((a - 98) * (x - 45)));
+            writeln(b, a)
+        end
+    end
+end;
+
+procedure q94(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (((2 * b) * (b + a)) * ((61 - 46) * 52));
+    if ((y - b) * (28 - 56)) < ((4 + 51) * 23) then
+    begin
+        y := (((z * 58) * (42 + z)) * ((60 - b) - (x - 62)));
+        y := (((z + 48) * (a * 38)) + (50 - (z + 18)));
+        for i := 1 to 7 do
+        begin
+            a := (((40 * a) * (z + z)) * ((y - 7) * b));
+            for j := 1 to 2 do
+            begin
+                b := (51 * z)
+            end
+        end
+    end;
+    z := ((53 * z) + ((y * b) - (84 * x)))
+end;
+
+procedure q95(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (((90 - a) * (z - 87)) - 70);
+    writeln(b, x);
+    for i := 1 to 6 do
+    begin
+        x := (71 * ((66 + 35) * b));
+        for j := 1 to 7 do
+        begin
+            for k := 1 to 8 do
+            begin
+                y := (39 * (59 - (z * b)));
+                y := ((33 - 56) * ((a * 41) + (77 + y)));
+                a := b
+            end;
+            writeln(z, b);
+            for k := 1 to 9 do
+            begin
+                y := (((x * 88) + 9) - x);
+                a := (((x + 72) + (a + 77)) - ((29 - 98) - 93))
+            end
+        end
+    end;
+    writeln(a, b);
+    x := (52 - x);
+    y := ((15 * b) * 45);
+    x := (6 * ((x + x) - (b * a)))
+end;
+
+procedure q96(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (b - b);
+    if ((y * 96) + (a + 4)) < ((y - z) * (b + 56)) then
+    begin
+        b := (((y + a) * (76 * b)) * ((a + 28) - (68 * a)))
+    end
+    else
+    begin
+        if b < b then
+        begin
+            a := (b + x);
+            if ((9 + 38) * x) < b then
+            begin
+                y := (((a * 21) * (a * 42)) + ((y * x) + (b * y)));
+                z := z;
+                z := z
+            end
+            else
+            begin
+                y := y
+            end
+        end
+        else
+        begin
+            z := ((45 * (11 - 8)) - b)
+        end;
+        y := (((a + 40) * (z - y)) - 7)
+    end;
+    z := ((59 * (69 * 31)) - (b * (a + 41)));
+    b := z;
+    b := z;
+    b := 95;
+    q93(x, y)
+end;
+
+procedure q97(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((82 - a) + (88 + 90)) < (a - (x * y)) then
+    begin
+        a := (13 + ((y + x) + (78 - b)))
+    end
+    else
+    begin
+        a := ((x - z) - x);
+        a := (((y * 15) * (y + 31)) * (98 - (b + y)))
+    end;
+    a := 68;
+    x := (28 * ((86 - 39) - (23 - b)));
+    q87(x, y)
+end;
+
+procedure q98(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (a - a);
+    for i := 1 to 8 do
+    begin
+        if ((50 - z) - (3 + z)) < (z + (83 + b)) then
+        begin
+            if ((b * 77) + (a - b)) < x then
+            begin
+                b := (b * z)
+            end
+            else
+            begin
+                y := (((62 - 68) * (67 * z)) - ((z + b) + (z - 54)))
+            end;
+            a := ((2 - x) - (a + (47 - b)));
+            if (z - 65) < b then
+            begin
+                z := ((b * 83) + ((b * 15) - 25));
+                a := (z - a);
+                z := (77 - ((65 + y) + (71 + x)))
+            end
+        end
+        else
+        begin
+            x := ((9 * (z + 33)) - ((14 * 91) + (z - z)))
+        end
+    end;
+    x := z;
+    q29(x, y)
+end;
+
+procedure q99(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := ((61 * (44 * z)) - ((75 * x) * 79));
+    for i := 1 to 4 do
+    begin
+        y := (((12 - a) + (z - y)) - 16);
+        b := (((b * b) * (z * 93)) + (32 + (x + z)));
+        x := z
+    end;
+    if 86 < 32 then
+    begin
+        z := (((16 * 55) * x) + ((y - z) * (60 + b)));
+        x := (((b - 86) + y) - (b + (y - 56)))
+    end
+end;
+
+procedure q100(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 4 do
+    begin
+        b := (a * ((a * 40) + 20));
+        y := (35 - 87);
+        for j := 1 to 5 do
+        begin
+            y := (((z - 65) - (x + z)) + ((x - x) + (74 - z)))
+        end
+    end;
+    for i := 1 to 7 do
+    begin
+        y := ((z - z) + ((x - z) * z));
+        if (y + (95 * 52)) < ((y * z) - (a - 83)) then
+        begin
+            if ((x * a) + 68) < 92 then
+            begin
+                y := (((x + z) - (50 - 34)) * ((b - 82) - (x - 3)));
+                y := (((x - x) + (y * b)) - (17 - 31))
+            end
+        end;
+        writeln(y, b)
+    end;
+    if ((10 * b) * (y * 86)) < ((a * 3) + (z * x)) then
+    begin
+        writeln(z, b)
+    end
+    else
+    begin
+        for i := 1 to 7 do
+        begin
+            writeln(y, z)
+        end;
+        y := (x - 96)
+    end;
+    x := (34 - ((92 + z) + (b - y)));
+    a := (y - y);
+    if b < ((x * z) * (64 - 99)) then
+    begin
+        for i := 1 to 6 do
+        begin
+            x := ((b - (4 + y)) - (b + (y - z)));
+            b := y;
+            if (8 + (x * y)) < ((b * x) - 43) then
+            begin
+                x := 26;
+                b := ((86 + (y + 74)) * b);
+                z := (((z * 65) * (x + a)) * ((58 - a) - (y + y)))
+            end
+        end;
+        for i := 1 to 6 do
+        begin
+            z := (((71 + 3) * (y - 76)) - 9);
+            b := ((b - (a - y)) * b);
+            writeln(a, x)
+        end
+    end
+    else
+    begin
+        a := (((b + a) - (44 + x)) - (x - 96))
+    end
+end;
+
+procedure q101(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(b, y);
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 8 do
+        begin
+            y := (b - 2);
+            z := (54 - (z * (b * z)))
+        end
+    end;
+    for i := 1 to 7 do
+    begin
+        if x < ((22 * 43) - (15 - z)) then
+        begin
+            b := (z * 98)
+        end
+        else
+        begin
+            writeln(z, a)
+        end;
+        if (z + (z - b)) < ((95 + z) - 38) then
+        begin
+            writeln(x, y)
+        end
+        else
+        begin
+            x := (((a + x) - a) * ((95 - z) - (y - 91)))
+        end;
+        x := ((b * (z * b)) + ((94 + a) * (49 * 3)))
+    end;
+    z := (a - ((b + 82) - (22 * 80)))
+end;
+
+procedure q102(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(a, b);
+    for i := 1 to 9 do
+    begin
+        if ((z + x) - y) < b then
+        begin
+            y := (y * 72)
+        end
+        else
+        begin
+            x := a
+        end;
+        z := ((81 * (6 - b)) + x);
+        if (52 * (6 * x)) < ((75 * y) * y) then
+        begin
+            for j := 1 to 7 do
+            begin
+                b := (((y - z) * (y * 54)) * 76);
+                a := (((a - z) - (a * 28)) * x)
+            end;
+            if ((94 + z) - (a - z)) < ((y + z) - (53 - a)) then
+            begin
+                b := 64;
+                z := z;
+                z := (((b * 48) * (b + b)) * (68 + a))
+            end
+            else
+            begin
+                x := (((y * y) - (y - 74)) - ((b - 11) - (x * 65)));
+                y := 36
+            end
+        end
+        else
+        begin
+            if b < ((a * 55) - (y - 10)) then
+            begin
+                y := (z * ((a * 45) * (a - 5)));
+                x := ((19 + (96 + z)) + ((z - a) + (5 - b)))
+            end
+            else
+            begin
+                a := ((48 * (63 + 42)) - 45);
+                b := (63 - ((b - x) * 39))
+            end
+        end
+    end;
+    for i := 1 to 3 do
+    begin
+        for j := 1 to 4 do
+        begin
+            for k := 1 to 7 do
+            begin
+                b := ((46 - (84 * b)) + ((71 + b) - z));
+                y := (1 - ((y - z) * (z + x)))
+            end;
+            b := ((78 + (55 - 23)) * ((x * x) - (x * 62)));
+            x := (((82 - y) * (x - 23)) + ((z + b) - (x * a)))
+        end
+    end;
+    writeln(a, z);
+    x := (((79 - a) * b) + ((44 - b) - 82));
+    a := (((z * b) + (45 * z)) - ((47 * y) - 68))
+end;
+
+procedure q103(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 3 do
+    begin
+        b := 82
+    end;
+    a := ((57 * (y * b)) - x);
+    for i := 1 to 2 do
+    begin
+        if (52 + z) < (x * (6 + a)) then
+        begin
+            x := (((z - a) - (x * 31)) * ((y - 46) + (b - 46)));
+            if (b + (a + x)) < ((10 - z) - (y * z)) then
+            begin
+                b := (((a * a) + (86 + 59)) * ((56 - b) - (x + 86)))
+            end
+            else
+            begin
+                x := ((z - (a + 26)) + 22);
+                b := (y * ((x * 51) - (x - 90)))
+            end
+        end
+        else
+        begin
+            for j := 1 to 7 do
+            begin
+                a := z;
+                x := y
+            end;
+            a := (z + (93 - (69 - 11)))
+        end;
+        b := 34;
+        for j := 1 to 5 do
+        begin
+            x := ((z + (a * y)) - ((2 - 62) - y))
+        end
+    end;
+    z := (((9 * a) - z) * (z - (b * x)));
+    for i := 1 to 8 do
+    begin
+        for j := 1 to 9 do
+        begin
+            z := b;
+            for k := 1 to 2 do
+            begin
+                x := (((97 - 30) - 15) * ((z + 48) * (z + y)));
+                y := x
+            end
+        end;
+        writeln(a, b)
+    end
+end;
+
+procedure q104(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((a + y) * (71 * x)) < ((z + x) * x) then
+    begin
+        for i := 1 to 3 do
+        begin
+            y := 11
+        end
+    end
+    else
+    begin
+        writeln(y, b);
+        if (95 + (98 + z)) < x then
+        begin
+            for i := 1 to 9 do
+            begin
+                b := (((y + 90) + z) - ((b - 90) - y));
+                b := (((y - a) * (59 - 56)) + x);
+                z := (((11 * 98) + x) * ((58 - 64) - (a - z)))
+            end;
+            if ((93 + 70) + (x - a)) < ((x * 39) - (a + z)) then
+            begin
+                y := (((b * y) + 27) - (4 + (34 * x)));
+                a := (((y + b) - (z - 59)) - ((27 * y) + (z + 98)))
+            end
+        end
+        else
+        begin
+            y := ((y + 53) * ((b + b) + (z + y)))
+        end
+    end;
+    y := (((49 * 34) * 52) * (z - (x + x)));
+    a := x;
+    z := (((a + 81) * (x - 19)) * ((53 - 47) - (y * y)));
+    for i := 1 to 2 do
+    begin
+        b := ((a - 80) * ((27 * 85) + (z - z)));
+        a := x;
+        for j := 1 to 8 do
+        begin
+            for k := 1 to 3 do
+            begin
+                z := (((b * a) - a) + ((20 + b) * (11 * 47)));
+                x := y
+            end
+        end
+    end;
+    for i := 1 to 3 do
+    begin
+        if y < ((46 + z) - a) then
+        begin
+            if ((44 - 25) + 65) < (z + (2 - a)) then
+            begin
+                z := y;
+                z := (((a - a) * (62 * z)) + ((z + x) + 73))
+            end
+            else
+            begin
+                z := (x * 44)
+            end
+        end
+    end
+end;
+
+procedure q105(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(a, z);
+    b := ((3 - (39 * 40)) + 31);
+    for i := 1 to 4 do
+    begin
+        z := 31;
+        for j := 1 to 4 do
+        begin
+            for k := 1 to 9 do
+            begin
+                y := ((39 + (x - 60)) * ((47 - y) * (z * 21)));
+                z := 35;
+                a := (y + ((a * x) - x))
+            end;
+            if ((18 + z) + (z + a)) < (8 + (b + 15)) then
+            begin
+                b := ((43 - (2 * x)) + ((x * x) - (z * 98)));
+                x := (((y + 32) * y) + ((52 - b) + (a * 8)))
+            end
+            else
+            begin
+                x := (((91 - a) * (b + y)) * 8);
+                y := ((z + (z - x)) - ((24 * z) - (y + z)))
+            end
+        end
+    end;
+    b := 30;
+    b := ((b - (20 - 33)) + ((y + b) - 52));
+    q31(x, y)
+end;
+
+procedure q106(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (42 * (x * (b + 88)));
+    for i := 1 to 7 do
+    begin
+        a := (12 + ((63 * a) + (45 + b)));
+        if ((9 * 61) + (x - a)) < ((23 * 17) - (y + 18)) then
+        begin
+            for j := 1 to 7 do
+            begin
+                x := 1;
+                a := (z * ((y * a) - y));
+                z := 5
+            end
+        end
+        else
+        begin
+            writeln(y, a)
+        end
+    end;
+    if ((z * a) * (y * b)) < (61 * (z * y)) then
+    begin
+        x := (((98 * b) - (a - 92)) - z);
+        x := (((x + b) * (69 + y)) * ((75 * 48) + (x * y)));
+        a := z
+    end
+    else
+    begin
+        z := ((y + y) + ((y + 32) + (84 - b)));
+        a := x
+    end;
+    b := y;
+    q30(x, y)
+end;
+
+procedure q107(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 3 do
+    begin
+        z := ((x - (2 + a)) + ((x + 44) - (a * z)));
+        if ((31 * b) - (a + 99)) < a then
+        begin
+            a := z
+        end
+        else
+        begin
+            writeln(y, x)
+        end
+    end;
+    z := (((y + y) * z) - y);
+    if (b + 37) < y then
+    begin
+        if (x * (x + 81)) < 2 then
+        begin
+            y := (((28 * z) * z) + ((a - y) * (x - a)));
+            x := (y + (y + (a + 5)))
+        end;
+        y := (((78 + 53) + (y + 73)) * z)
+    end
+end;
+
+procedure q108(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((x * z) * (a + a)) < a then
+    begin
+        z := (((a * 21) - (z * x)) - a);
+        for i := 1 to 6 do
+        begin
+            if ((z - a) + x) < ((b + y) * x) then
+            begin
+                y := 75
+            end
+        end;
+        writeln(y, a)
+    end;
+    z := z;
+    b := (((y + y) - (90 * x)) - ((a + z) * (y + b)));
+    y := (x * ((49 * 67) * a));
+    b := (59 - y)
+end;
+
+procedure q109(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 7 do
+    begin
+        writeln(z, b);
+        if ((a + 10) - 55) < ((a + 35) - 46) then
+        begin
+            if (z - (90 - b)) < 62 then
+            begin
+                b := (((97 + z) * 45) + ((79 - 59) + z));
+                y := (b + ((68 - 85) + (y * 71)));
+                a := b
+            end
+            else
+            begin
+                y := (((x - a) - (60 * a)) - z)
+            end;
+            for j := 1 to 5 do
+            begin
+                y := (z - 85);
+                x := (77 * 61)
+            end
+        end;
+        writeln(z, y)
+    end;
+    z := ((84 + (23 - 1)) + ((15 * 8) + (y + 59)));
+    x := (((11 + 30) + 66) + (86 - (98 * 91)));
+    if ((b + x) * 60) < (47 - (b + 99)) then
+    begin
+        for i := 1 to 4 do
+        begin
+            a := (((y + 81) * b) - y)
+        end;
+        for i := 1 to 8 do
+        begin
+            z := (((b + z) * b) * z);
+            y := ((31 - (80 * b)) + ((x - z) - (y * 56)));
+            for j := 1 to 3 do
+            begin
+                b := a
+            end
+        end;
+        for i := 1 to 2 do
+        begin
+            for j := 1 to 9 do
+            begin
+                x := (((99 * 90) + (z + x)) * x)
+            end;
+            writeln(b, y)
+        end
+    end
+    else
+    begin
+        y := (x * a);
+        x := (((b * z) + (y * x)) + ((y - 10) + (y - z)))
+    end;
+    q45(x, y)
+end;
+
+procedure q110(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(y, z);
+    b := (((b + 70) + (5 * 90)) + (z + (b + y)));
+    for i := 1 to 5 do
+    begin
+        y := x
+    end;
+    if b < a then
+    begin
+        a := (a - (56 + (b * 42)));
+        a := (11 + ((99 - 17) - (a + a)));
+        writeln(b, z)
+    end
+    else
+    begin
+        z := 25
+    end;
+    for i := 1 to 4 do
+    begin
+        y := (y * 4);
+        if y < y then
+        begin
+            z := ((a - (9 + y)) - a);
+            for j := 1 to 6 do
+            begin
+                x := (13 - (89 + (x + a)));
+                a := (((y + 99) + 91) - ((18 * 71) + (25 - 82)))
+            end;
+            x := (((40 - 23) - (77 - a)) + b)
+        end;
+        y := (((b - a) - b) + 69)
+    end;
+    if ((a * x) + 29) < ((99 - 47) * (x * x)) then
+    begin
+        z := (58 * (98 - (57 - a)));
+        y := x
+    end
+end;
+
+procedure q111(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if b < 26 then
+    begin
+        if ((z + y) * (z * z)) < ((y - a) * z) then
+        begin
+            if ((17 - x) * (b + y)) < ((19 * z) * (a * 34)) then
+            begin
+                y := (73 + ((x * z) * (x - x)))
+            end;
+            a := (b * ((44 - 39) - (14 * x)));
+            z := (((z * z) * (47 * 58)) * ((y * 71) + (b - 63)))
+        end;
+        for i := 1 to 2 do
+        begin
+            for j := 1 to 3 do
+            begin
+                y := (82 + (63 * (b + z)));
+                a := z;
+                x := a
+            end;
+            if 18 < ((b + x) * (a - 20)) then
+            begin
+                a := 32;
+                y := z
+            end
+            else
+            begin
+                x := (((20 + a) - x) - ((y - b) + (z + 19)))
+            end
+        end
+    end
+    else
+    begin
+        if ((b + 70) * 4) < (x + (48 - x)) then
+        begin
+            b := (a - ((87 - 28) + (b * 8)));
+            y := b;
+            y := (((55 * b) + x) * z)
+        end
+        else
+        begin
+            a := ((z + 59) - ((49 + 71) * b));
+            for i := 1 to 3 do
+            begin
+                z := (((x + a) + a) * b);
+                y := (41 - ((69 - 71) + b));
+                z := ((b - (x - y)) - ((35 - z) - (83 - 34)))
+            end
+        end
+    end;
+    x := ((y * (y * 34)) + ((35 - y) - (y + z)));
+    for i := 1 to 9 do
+    begin
+        for j := 1 to 4 do
+        begin
+            for k := 1 to 4 do
+            begin
+                b := ((49 - x) + (y + (51 * b)));
+                y := (((x * y) * (23 - x)) + ((y + z) + (x * y)));
+                a := (((63 + a) - (a - 8)) - z)
+            end;
+            for k := 1 to 9 do
+            begin
+                b := (a - (74 + a));
+                x := x;
+                x := ((81 + (5 + b)) * ((78 - y) * (43 * z)))
+            end
+        end
+    end;
+    q76(x, y)
+end;
+
+procedure q112(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if 45 < 88 then
+    begin
+        if 8 < a then
+        begin
+            if x < 25 then
+            begin
+                z := (((51 * z) - (y + 41)) - (39 * (67 - 51)))
+            end;
+            x := (x * (x - z))
+        end;
+        for i := 1 to 5 do
+        begin
+            b := (((a + 8) * (10 * y)) * ((77 + 10) + (a * 7)))
+        end;
+        if ((89 * a) + 34) < 64 then
+        begin
+            writeln(a, x);
+            if 74 < ((z + 19) + (61 * z)) then
+            begin
+                y := b;
+                a := ((b + b) - (b * (y - 65)))
+            end;
+            for i := 1 to 9 do
+            begin
+                x := (x + z);
+                b := (((a * z) - a) * (67 * x))
+            end
+        end
+    end;
+    if (86 - (9 - y)) < b then
+    begin
+        writeln(y, a)
+    end;
+    x := (((a + 58) * (a + 87)) + ((63 + b) - 46));
+    a := (27 * ((72 - a) - (x - 66)));
+    y := (((11 * 22) * (23 - b)) * ((a - 79) - (78 * 23)));
+    for i := 1 to 4 do
+    begin
+        if ((b + b) * 72) < ((97 + b) + y) then
+        begin
+            x := y;
+            for j := 1 to 4 do
+            begin
+                x := y;
+                a := (y - ((a * b) * (35 * 97)))
+            end;
+            if ((x - b) - (5 + b)) < ((b + 60) + (17 + y)) then
+            begin
+                b := (20 - (z * (75 - 59)))
+            end
+        end
+        else
+        begin
+            z := (((x - 59) + (44 - 39)) - ((y - 27) + (10 * z)))
+        end;
+        for j := 1 to 7 do
+        begin
+            y := 55;
+            if 41 < ((21 - y) - x) then
+            begin
+                b := (32 * ((z - y) + (y * 42)))
+            end;
+            for k := 1 to 3 do
+            begin
+                a := ((b - (y - y)) + ((y * 60) * (38 - 44)))
+            end
+        end;
+        for j := 1 to 7 do
+        begin
+            x := (((z * 57) + (x + z)) - ((x + 8) - (83 * a)));
+            x := b
+        end
+    end;
+    q106(x, y)
+end;
+
+procedure q113(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := (b - ((60 + z) + (x * 23)));
+    if x < (23 * 30) then
+    begin
+        for i := 1 to 2 do
+        begin
+            b := (a - ((z - a) * 62));
+            for j := 1 to 6 do
+            begin
+                b := (((z + 15) + (94 + z)) * (z - (55 * b)))
+            end;
+            x := (a + ((65 + 6) + 72))
+        end;
+        z := (((92 + y) - (a * z)) * b)
+    end
+    else
+    begin
+        writeln(b, a);
+        b := y
+    end;
+    x := (((y + b) * (z + 98)) - a);
+    b := (32 - (a - 61));
+    if ((x * y) + 97) < (b * (94 + a)) then
+    begin
+        if ((4 + 74) * (8 - y)) < z then
+        begin
+            z := (((92 + 32) + (y + 41)) * ((a - 72) - x));
+            a := (((38 - 70) * (b + z)) * b)
+        end
+        else
+        begin
+            writeln(b, x);
+            for i := 1 to 7 do
+            begin
+                x := (15 * ((40 * 97) + (b * 26)));
+                z := (69 + 53);
+                x := (((y * x) + (a + b)) + ((y - a) - (z + x)))
+            end
+        end;
+        a := (x * a)
+    end
+    else
+    begin
+        x := (y + 52);
+        if x < (34 + (b - x)) then
+        begin
+            a := ((87 - (x * y)) - a)
+        end
+    end;
+    q52(x, y)
+end;
+
+procedure q114(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (((x * a) * (57 * 27)) - (a * (58 + 75)));
+    a := ((47 + (y * 97)) + 81);
+    x := 61;
+    if 23 < ((z - 16) - (x - y)) then
+    begin
+        for i := 1 to 6 do
+        begin
+            if ((x - x) + (15 - 96)) < ((9 * 27) - (x * 75)) then
+            begin
+                a := (((55 - 66) * (a + a)) - ((z - 44) - (b + 73)))
+            end
+            else
+            begin
+                x := 82;
+                b := ((70 + (z - 52)) * ((b + 54) - (92 - a)))
+            end
+        end;
+        z := 9
+    end
+end;
+
+procedure q115(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(z, x);
+    a := ((a - (y * 14)) * (59 - (x - z)));
+    writeln(x, b);
+    y := (((59 + z) * (44 + a)) + 99);
+    for i := 1 to 2 do
+    begin
+        writeln(b, y);
+        z := y;
+        a := b
+    end;
+    for i := 1 to 5 do
+    begin
+        for j := 1 to 7 do
+        begin
+            x := (((99 * a) + (2 * a)) - z);
+            if ((92 * 97) * a) < ((x * b) * (x * y)) then
+            begin
+                y := (((35 - y) + (x + 66)) + ((y - a) + b));
+                a := 51;
+                b := y
+            end
+        end;
+        writeln(x, b);
+        writeln(x, y)
+    end;
+    q1(x, y)
+end;
+
+procedure q116(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(a, y);
+    if ((y + y) * (35 - y)) < (26 - (a + 46)) then
+    begin
+        y := (y + b)
+    end;
+    y := 67;
+    b := (((b + z) + b) * ((7 + z) - a));
+    y := b;
+    if z < ((x - 11) + (z * 35)) then
+    begin
+        a := (((a - 74) * (y - x)) - ((x - 70) + (56 - b)));
+        if ((78 - x) * 17) < ((74 + y) * (z + 11)) then
+        begin
+            b := x;
+            if ((x + 94) + y) < ((52 * 5) - (x - a)) then
+            begin
+                z := ((z + (z - b)) - (z - 38));
+                y := 79
+            end
+            else
+            begin
+                z := (((y * 26) + (b + a)) + ((27 - 29) * (y * 27)));
+                b := 37
+            end;
+            writeln(y, x)
+        end
+    end;
+    y := a;
+    q1(x, y)
+end;
+
+procedure q117(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 8 do
+    begin
+        if ((b - y) * (26 * x)) < ((y - 79) * a) then
+        begin
+            x := ((y + (z - y)) + ((z + 92) - 4));
+            for j := 1 to 8 do
+            begin
+                a := (((y - z) * (36 + 46)) + ((b * b) * (a * 83)));
+                y := 82
+            end
+        end
+        else
+        begin
+            b := (((a + 88) - (65 - z)) * x)
+        end;
+        x := (a + (y * (a - b)))
+    end;
+    x := 94;
+    for i := 1 to 8 do
+    begin
+        x := (((9 * a) + (x * 28)) + ((y + b) * (99 + x)));
+        if ((a + x) - (z + 72)) < 84 then
+        begin
+            for j := 1 to 3 do
+            begin
+                x := a
+            end
+        end;
+        for j := 1 to 5 do
+        begin
+            y := y;
+            a := (((b * z) * (47 + a)) * (b + z));
+            b := 99
+        end
+    end;
+    if b < ((61 - z) - (33 * y)) then
+    begin
+        b := (((84 + 50) * (a - a)) + a)
+    end;
+    a := ((83 + (78 + b)) - ((y * 18) + (a - 44)))
+end;
+
+procedure q118(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 3 do
+    begin
+        if ((y * x) - a) < b then
+        begin
+            a := (z + 53);
+            if ((64 + z) + x) < 4 then
+            begin
+                x := ((89 - z) * 70);
+                x := (z - z)
+            end
+        end
+        else
+        begin
+            y := (87 * ((78 + 45) + x));
+            z := (((y * a) + (50 + 58)) - 50)
+        end
+    end;
+    z := (z * 52);
+    if ((53 - 16) - (y * x)) < x then
+    begin
+        writeln(b, a);
+        if b < ((y + x) * (40 * a)) then
+        begin
+            x := (2 * ((b + a) * 3));
+            z := 32
+        end
+        else
+        begin
+            a := (((96 + 36) * (a * 63)) * 26)
+        end
+    end;
+    for i := 1 to 9 do
+    begin
+        if 6 < (z + z) then
+        begin
+            if ((a + 73) - y) < ((97 - 87) - (x - 54)) then
+            begin
+                x := ((64 * b) + (y * (71 + b)))
+            end
+            else
+            begin
+                z := 21;
+                x := (((a * z) - 65) - 8)
+            end;
+            for j := 1 to 7 do
+            begin
+                b := (((x * b) + (x * 11)) - (a + (x - z)))
+            end;
+            x := ((a * (13 + 47)) + x)
+        end;
+        writeln(b, y);
+        if (96 + (x - y)) < ((71 * a) * (y * b)) then
+        begin
+            z := 28
+        end
+        else
+        begin
+            for j := 1 to 9 do
+            begin
+                a := (b + 34);
+                y := a
+            end
+        end
+    end;
+    writeln(z, b);
+    if ((y - a) + (x - y)) < ((z + b) * (z + 65)) then
+    begin
+        if ((98 - x) * (b + 93)) < ((56 * a) - (5 - b)) then
+        begin
+            x := (67 * 72)
+        end
+        else
+        begin
+            writeln(y, x);
+            x := y
+        end;
+        if ((a - b) - 13) < x then
+        begin
+            x := (((74 - z) + (14 + 53)) + ((b - y) * (z + z)));
+            b := (((10 * z) + (39 + y)) + 2);
+            for i := 1 to 9 do
+            begin
+                a := b;
+                x := (((b - 64) * z) * z)
+            end
+        end
+    end
+    else
+    begin
+        if (z + (85 * a)) < ((a - z) - (y + 75)) then
+        begin
+            a := (((b * x) * (y + 47)) * (83 - (80 + y)));
+            a := z;
+            y := (94 - 55)
+        end;
+        z := (((a + 68) - (x * y)) * b)
+    end;
+    writeln(y, x);
+    q63(x, y)
+end;
+
+procedure q119(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := y;
+    for i := 1 to 7 do
+    begin
+        x := (((z - 82) - (45 - 95)) + x);
+        if ((a - y) + (x * 68)) < ((z - a) + (36 * 5)) then
+        begin
+            for j := 1 to 7 do
+            begin
+                b := (((z + z) - (6 * 4)) - x)
+            end;
+            a := ((33 + (b - b)) * ((x - y) - (51 - 32)))
+        end
+        else
+        begin
+            writeln(b, y)
+        end;
+        x := (((37 + a) + a) - (42 + (34 * 61)))
+    end;
+    for i := 1 to 9 do
+    begin
+        for j := 1 to 5 do
+        begin
+            x := 58
+        end
+    end
+end;
+
+procedure q120(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (x * ((a + 4) * (x - 8)));
+    z := (b + ((b * b) - (z * 87)));
+    b := (z - 65);
+    if a < ((47 + 55) - y) then
+    begin
+        z := (((b + z) - (x * a)) - ((z + 25) + (z + 50)));
+        if 11 < ((z * 34) - (z - 76)) then
+        begin
+            b := (48 - 44)
+        end
+        else
+        begin
+            x := 84
+        end;
+        b := (((b + 22) + (46 - 32)) + ((x - 8) + (b + z)))
+    end
+    else
+    begin
+        for i := 1 to 7 do
+        begin
+            b := 69
+        end
+    end;
+    a := (((a - a) * a) - y);
+    q66(x, y)
+end;
+
+procedure q121(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((b - 43) * (a - 69)) + ((z + x) + (13 * x)));
+    y := (((11 - 76) + 16) * ((43 - z) - (44 + 98)));
+    z := 92;
+    if ((x - x) + y) < ((45 - 27) - (a + b)) then
+    begin
+        y := (((y - z) + (16 + y)) + ((32 - z) + x));
+        if ((x * 54) - (14 - b)) < ((y + x) * 22) then
+        begin
+            x := (((b + y) - (37 - 89)) * a);
+            x := ((x * (47 - 16)) - ((27 - 85) - (54 - z)))
+        end;
+        for i := 1 to 2 do
+        begin
+            writeln(z, a);
+            y := (y + ((x + z) - (z - 79)))
+        end
+    end;
+    a := (((67 * a) + z) + (b + a));
+    q90(x, y)
+end;
+
+procedure q122(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 5 do
+    begin
+        z := ((86 * (y * a)) * (y * 99));
+        y := 18;
+        if (24 - 56) < y then
+        begin
+            a := 25;
+            if ((y - z) * (z - x)) < x then
+            begin
+                a := (((73 * 32) + (y - b)) + (y * (73 - z)));
+                y := ((85 * b) + ((83 + z) - 29))
+            end
+            else
+            begin
+                z := (a + ((z - b) + (42 * x)))
+            end
+        end
+    end;
+    y := (((y * a) + (b - 62)) * ((34 + 29) + (a - 46)));
+    x := (b + ((y * x) + z));
+    z := ((x * z) - x)
+end;
+
+procedure q123(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((55 - 27) + (89 * x)) < a then
+    begin
+        z := (6 + (x - (38 * 53)))
+    end
+    else
+    begin
+        b := (((13 + 28) - (b + a)) * ((47 + y) + 18))
+    end;
+    z := (26 - 31);
+    writeln(b, a);
+    a := ((y - (a + y)) + ((a - 33) - (y - 7)))
+end;
+
+procedure q124(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 9 do
+    begin
+        y := (x * ((71 - z) + (99 + 11)));
+        for j := 1 to 3 do
+        begin
+            z := b;
+            b := (30 + ((z * a) - (57 * b)))
+        end;
+        if (b - (z - 88)) < (a - 9) then
+        begin
+            if (a * x) < (b + (48 * y)) then
+            begin
+                a := ((x + (b + 2)) * b);
+                z := 29;
+                z := (70 - (y - 64))
+            end;
+            z := 9
+        end
+    end;
+    for i := 1 to 7 do
+    begin
+        y := ((63 * 37) * ((33 * y) - (38 - 95)));
+        b := ((y - b) + ((b * 24) - 21));
+        b := (((9 + z) + (z + a)) * ((1 * y) + b))
+    end;
+    y := (((86 * 60) - (7 + z)) - b);
+    if y < ((y - y) - z) then
+    begin
+        z := (((x + 48) - 73) * ((86 * a) + (y * z)));
+        y := z
+    end
+    else
+    begin
+        y := x
+    end;
+    z := 79;
+    writeln(x, z);
+    q30(x, y)
+end;
+
+procedure q125(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := ((a + (y - z)) + 15);
+    for i := 1 to 8 do
+    begin
+        for j := 1 to 5 do
+        begin
+            a := z;
+            b := 68
+        end;
+        y := (23 - (x * (z + z)));
+        z := ((y + (b + a)) - ((a + x) * (48 * 41)))
+    end;
+    y := (((11 - a) + (x + z)) * 64);
+    z := 21;
+    x := ((x - (24 * b)) * y)
+end;
+
+procedure q126(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 7 do
+    begin
+        x := 83
+    end;
+    writeln(x, a);
+    a := y;
+    if (x * 1) < a then
+    begin
+        for i := 1 to 8 do
+        begin
+            if (98 * (x + z)) < (y + (x - a)) then
+            begin
+                b := (((37 - 1) + (44 * y)) * (73 - 11));
+                b := (a * ((a * 54) + (z * 10)))
+            end
+            else
+            begin
+                b := (95 + (x * a));
+                a := ((68 * (a + b)) - ((z - 77) + (x * z)))
+            end;
+            x := (((23 * 76) + 15) * ((z * a) - a));
+            z := (((b * b) - (a + 4)) + ((z * 90) - (66 * x)))
+        end;
+        for i := 1 to 3 do
+        begin
+            for j := 1 to 9 do
+            begin
+                z := 59
+            end;
+            if ((y - 89) * (41 + 93)) < 13 then
+            begin
+                z := (y * ((b * a) * 95))
+            end;
+            y := (b + ((97 - z) - (y - x)))
+        end;
+        if ((82 * 97) * (55 * y)) < ((64 - 10) + (x * b)) then
+        begin
+            for i := 1 to 7 do
+            begin
+                z := (((y + b) - (56 * 69)) * ((y * 91) * b))
+            end
+        end
+        else
+        begin
+            if 74 < b then
+            begin
+                y := ((95 + 30) - ((11 * 48) * 93));
+                z := (((x * a) - a) - (x * z));
+                y := y
+            end
+        end
+    end;
+    a := 42;
+    writeln(x, a);
+    for i := 1 to 6 do
+    begin
+        x := x;
+        for j := 1 to 7 do
+        begin
+            b := (((a * x) + (13 + y)) - ((55 + x) * (43 * a)))
+        end;
+        y := ((y * (y + 26)) * 70)
+    end;
+    q66(x, y)
+end;
+
+procedure q127(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((x * x) + (b - 75)) - 28);
+    x := ((3 * (b + 94)) - ((a + z) + (y - x)));
+    if ((z + x) + (b * y)) < 61 then
+    begin
+        b := z;
+        for i := 1 to 9 do
+        begin
+            b := (86 - 40)
+        end;
+        a := a
+    end;
+    q50(x, y)
+end;
+
+procedure q128(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := x;
+    y := (98 + (x - (60 + 63)));
+    a := (((75 * z) - (y - 28)) * ((b * z) * b));
+    q121(x, y)
+end;
+
+procedure q129(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := x;
+    if ((83 * 93) + a) < ((40 * 32) * (y - z)) then
+    begin
+        writeln(a, x)
+    end
+    else
+    begin
+        if 40 < ((y + 41) - z) then
+        begin
+            if (95 - (x + x)) < 45 then
+            begin
+                x := (((a - 67) * (y * 68)) * ((83 * 18) + (a - 87)));
+                x := 40
+            end
+            else
+            begin
+                b := y
+            end;
+            y := (13 + ((y - y) - (y + 39)))
+        end;
+        writeln(a, x)
+    end;
+    for i := 1 to 8 do
+    begin
+        a := (((b + a) * a) - y);
+        for j := 1 to 9 do
+        begin
+            if ((b * 34) + (y - 95)) < ((y * y) + a) then
+            begin
+                a := ((a - (48 + a)) + ((61 + x) + (b * 46)));
+                y := 89;
+                y := b
+            end
+            else
+            begin
+                x := z
+            end;
+            if ((a - y) * (a - 23)) < 34 then
+            begin
+                y := (((x + b) - (y + 41)) * ((35 * a) * 41))
+            end
+            else
+            begin
+                b := (48 + (85 - (b + z)));
+                b := (((95 * b) * (y - y)) * (81 - (x + x)))
+            end;
+            if ((x * z) + a) < z then
+            begin
+                b := ((59 - (64 - z)) - ((49 + b) + 4));
+                x := 94;
+                y := 8
+            end
+        end
+    end;
+    writeln(b, z)
+end;
+
+procedure q130(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := ((14 * (y + x)) + (89 * 77));
+    for i := 1 to 6 do
+    begin
+        writeln(y, x);
+        b := (((73 - 44) - (46 * 59)) * (b * 37))
+    end;
+    for i := 1 to 4 do
+    begin
+        if (x + b) < ((y + x) * 6) then
+        begin
+            if ((b * z) + (45 + 91)) < (21 + (87 * x)) then
+            begin
+                z := (((54 - x) + x) + (59 + (y * 78)))
+            end
+            else
+            begin
+                x := y
+            end;
+            y := (x * ((y - y) + (b + 46)))
+        end
+        else
+        begin
+            y := 73
+        end;
+        writeln(a, y)
+    end;
+    for i := 1 to 5 do
+    begin
+        b := y;
+        writeln(x, a)
+    end;
+    if (21 * (48 * 90)) < z then
+    begin
+        z := a;
+        for i := 1 to 9 do
+        begin
+            if (x - x) < ((b + 80) * (x + y)) then
+            begin
+                b := 71;
+                a := (((a - b) * 4) + ((x * 63) - (a * a)));
+                a := 57
+            end
+            else
+            begin
+                z := y
+            end
+        end;
+        y := (37 * b)
+    end;
+    q82(x, y)
+end;
+
+procedure q131(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 6 do
+    begin
+        y := (x * ((14 - 92) - (57 * 72)));
+        for j := 1 to 8 do
+        begin
+            for k := 1 to 7 do
+            begin
+                x := ((y - (38 + z)) + ((41 + a) + (b + x)));
+                z := (32 - (a - (x + 58)));
+                z := z
+            end;
+            a := (((b - 44) - y) + (a * (z * z)));
+            b := x
+        end
+    end;
+    if (a - (28 - 6)) < (x + (82 - b)) then
+    begin
+        for i := 1 to 7 do
+        begin
+            if ((57 * 4) * (a + y)) < b then
+            begin
+                a := (((y - 37) + (y + y)) - x)
+            end;
+            if ((33 - 56) - z) < ((y * b) * z) then
+            begin
+                b := (((b + b) * (68 + z)) + 16);
+                b := (66 - ((y + x) + (y - x)));
+                z := (((x - y) - (58 - 61)) * ((y + b) + (44 * y)))
+            end
+            else
+            begin
+                a := (z * (y + (x + y)));
+                z := (22 * ((83 * x) + 18))
+            end
+        end
+    end
+    else
+    begin
+        a := 12;
+        a := b
+    end;
+    writeln(b, z)
+end;
+
+procedure q132(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := (((x * x) * (x - y)) + (y - (67 + y)));
+    writeln(z, b);
+    for i := 1 to 9 do
+    begin
+        writeln(b, x);
+        y := (((85 + 70) * (z - 9)) - ((y + 77) * (95 - y)));
+        writeln(x, y)
+    end;
+    q43(x, y)
+end;
+
+procedure q133(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := x;
+    if ((y * 78) + 17) < ((10 * 87) * (87 + 25)) then
+    begin
+        writeln(y, b);
+        b := 47;
+        for i := 1 to 2 do
+        begin
+            x := (((93 - b) + y) - 78);
+            x := b;
+            if ((12 - a) * (z * 9)) < ((x * x) + (z + 32)) then
+            begin
+                z := (((b - x) + 2) - ((x * 17) - (63 - x)))
+            end
+            else
+            begin
+                y := (((a - a) + (a - 32)) * 96)
+            end
+        end
+    end;
+    for i := 1 to 4 do
+    begin
+        if ((a + 29) * b) < ((z * 65) + (61 + z)) then
+        begin
+            if ((y + 15) + (b * 47)) < ((x + a) - (b + 91)) then
+            begin
+                x := (33 + ((x - b) * (54 * b)));
+                a := ((57 - (b - z)) - ((a * 25) * (a + a)))
+            end
+        end
+        else
+        begin
+            y := (((y - a) - 60) * y)
+        end;
+        for j := 1 to 5 do
+        begin
+            if ((98 * z) - (43 - 95)) < x then
+            begin
+                a := ((64 - (z - 53)) - (82 + (x + y)));
+                z := a
+            end
+        end
+    end;
+    b := (((z * b) - (y - a)) - b);
+    z := (y + a);
+    b := (((25 * z) * (x * b)) * y);
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 9 do
+        begin
+            writeln(x, y);
+            z := 57;
+            for k := 1 to 6 do
+            begin
+                y := (((a * 82) - b) * ((x - x) * (b - b)));
+                b := ((x * (z * 22)) - ((b + 88) + y))
+            end
+        end
+    end;
+    q26(x, y)
+end;
+
+procedure q134(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := ((y * (z - 96)) * ((79 + x) * (a + 98)));
+    for i := 1 to 7 do
+    begin
+        for j := 1 to 8 do
+        begin
+            if (35 + (30 * 13)) < ((z * y) - (83 + y)) then
+            begin
+                b := (((b + 4) + (x + b)) + ((b + 51) * (a - 76)));
+                a := b;
+                z := ((z - (32 + 59)) - ((a + 89) + (97 * y)))
+            end
+            else
+            begin
+                b := (x * 66);
+                y := 41
+            end;
+            y := ((8 * (b - b)) + (85 * (z * z)));
+            for k := 1 to 4 do
+            begin
+                y := (z * a)
+            end
+        end
+    end;
+    for i := 1 to 4 do
+    begin
+        if ((x + 6) + y) < ((z * y) - (a - a)) then
+        begin
+            if ((69 - 77) + b) < ((56 - a) + 39) then
+            begin
+                x := 37
+            end
+        end
+        else
+        begin
+            z := x
+        end;
+        x := (x + ((a + 65) - (7 * b)));
+        writeln(y, z)
+    end;
+    q75(x, y)
+end;
+
+procedure q135(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := a;
+    b := (((b * a) + (b + a)) + (a - (69 + z)));
+    for i := 1 to 7 do
+    begin
+        a := (82 * ((a * a) * (y * z)))
+    end
+end;
+
+procedure q136(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 3 do
+    begin
+        if (z + (a + z)) < a then
+        begin
+            writeln(x, z)
+        end
+    end;
+    y := ((17 - (13 - b)) + ((y - 6) + (72 + x)));
+    writeln(x, y);
+    for i := 1 to 4 do
+    begin
+        b := (z - ((x * y) + (b - 80)));
+        for j := 1 to 5 do
+        begin
+            for k := 1 to 7 do
+            begin
+                a := 4;
+                z := y;
+                z := (((x + 32) * (y * b)) * 54)
+            end
+        end
+    end
+end;
+
+procedure q137(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (((b - 50) * 53) - a);
+    b := b;
+    x := 28;
+    z := (x - x);
+    a := (((x + a) - (34 - 43)) - (81 * (x - a)));
+    if 16 < ((83 * x) * (z * 23)) then
+    begin
+        b := (((y - 73) + (8 - a)) - ((z + 62) * 31));
+        y := ((10 + (x - 31)) * ((50 + a) * y))
+    end
+    else
+    begin
+        if (z * (40 * b)) < ((y * 81) + (a - x)) then
+        begin
+            a := ((11 - 98) + 22);
+            for i := 1 to 8 do
+            begin
+                b := z;
+                a := 71;
+                x := y
+            end;
+            if ((58 * 21) + (37 + x)) < y then
+            begin
+                b := 55
+            end
+            else
+            begin
+                b := (((z - x) * (y * 65)) + (y * (83 * 27)));
+                y := a
+            end
+        end
+        else
+        begin
+            for i := 1 to 3 do
+            begin
+                x := (b - ((b * z) * (50 - 80)));
+                x := (((y - 22) + b) - x)
+            end
+        end;
+        if a < (z - z) then
+        begin
+            y := (((61 - 76) - y) * ((b - 33) * (46 * 20)));
+            b := z;
+            if ((7 + 42) + (76 * 80)) < 55 then
+            begin
+                b := ((73 * b) * (a * z));
+                b := x
+            end
+            else
+            begin
+                z := ((62 - (z - x)) + ((a * a) - (y + z)));
+                y := b
+            end
+        end
+    end
+end;
+
+procedure q138(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if z < z then
+    begin
+        y := b
+    end
+    else
+    begin
+        a := (((56 + 87) + (12 + z)) * a);
+        b := (((64 - 59) + (y - x)) - ((z + 90) - 93))
+    end;
+    a := 74;
+    b := z;
+    if 25 < ((a - 67) - (60 + x)) then
+    begin
+        y := a
+    end
+    else
+    begin
+        if 62 < (54 - (x * z)) then
+        begin
+            b := (y + ((x * 59) - (z + z)));
+            writeln(z, a)
+        end
+    end;
+    if ((z - 50) * (9 * 75)) < 51 then
+    begin
+        writeln(x, y);
+        x := 1;
+        a := (95 * ((y + 65) * (x + x)))
+    end
+    else
+    begin
+        if ((b * 6) * a) < 86 then
+        begin
+            a := ((6 * b) * 76)
+        end
+    end;
+    if ((y - 63) - z) < ((b * 63) * (a - 55)) then
+    begin
+        for i := 1 to 3 do
+        begin
+            y := y;
+            for j := 1 to 3 do
+            begin
+                z := (((b - a) - (a * a)) + b);
+                x := (((z - b) + (55 * x)) * ((y * y) * (z - 11)))
+            end
+        end;
+        for i := 1 to 5 do
+        begin
+            y := (z + z)
+        end
+    end;
+    b := 18;
+    q103(x, y)
+end;
+
+procedure q139(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(a, z);
+    b := ((55 + (3 * x)) + (23 + y));
+    x := (((z * a) + (91 + b)) - b);
+    z := y;
+    x := 44;
+    if b < z then
+    begin
+        for i := 1 to 8 do
+        begin
+            if ((18 * x) + (9 * b)) < (z + (y - b)) then
+            begin
+                z := (b + ((x - b) * (b * 36)));
+                a := ((26 * (20 * x)) + ((54 - 75) * (94 + y)))
+            end;
+            for j := 1 to 9 do
+            begin
+                y := (38 * ((z * z) + (10 - z)))
+            end;
+            y := ((53 - (18 * 22)) + ((z * x) * (4 + z)))
+        end
+    end;
+    for i := 1 to 6 do
+    begin
+        for j := 1 to 6 do
+        begin
+            if ((51 + 31) * (x + 5)) < ((x * y) * (b * 95)) then
+            begin
+                z := ((x + y) - 86);
+                a := ((18 + (b * 71)) * a)
+            end;
+            for k := 1 to 8 do
+            begin
+                y := (((y + x) * 47) - ((a - x) - (25 * y)));
+                x := (((x * z) * (y * 64)) * ((x * 55) * 43))
+            end;
+            a := b
+        end
+    end;
+    q107(x, y)
+end;
+
+procedure q140(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((z + a) - (78 - 2)) + 86);
+    a := (((y * x) * (y * z)) * ((b + x) * (b + a)));
+    b := ((23 - (z * x)) * ((b * a) + (z * 5)));
+    if 32 < ((60 - 5) * (z * 10)) then
+    begin
+        if (z - (x - 84)) < z then
+        begin
+            b := ((88 - (y + a)) - 72)
+        end
+        else
+        begin
+            b := (66 - y);
+            y := (((86 * b) + (b * 57)) - (z + 27))
+        end
+    end
+    else
+    begin
+        z := (((z - 23) - (60 + y)) - ((90 - x) - b));
+        x := (67 * 18)
+    end
+end;
+
+procedure q141(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 2 do
+    begin
+        z := (15 - ((b * 10) - (y - 84)));
+        y := (((70 + b) + (y - 23)) - ((x * 45) - b));
+        if (47 + a) < ((44 * z) * z) then
+        begin
+            if x < ((60 + z) * (92 * y)) then
+            begin
+                x := ((28 * (z - 36)) - ((24 - z) + (20 + 36)));
+                b := ((1 - z) - (x - (z * z)));
+                b := 7
+            end
+        end
+        else
+        begin
+            b := ((79 + (z - a)) - ((84 + b) * (y + 53)))
+        end
+    end;
+    writeln(x, y);
+    b := z;
+    if (b - (z * 51)) < ((b + b) + (a + y)) then
+    begin
+        for i := 1 to 2 do
+        begin
+            writeln(y, x)
+        end
+    end;
+    for i := 1 to 6 do
+    begin
+        z := b;
+        b := ((a - (56 + 19)) * 40);
+        a := (((49 + z) - 82) + ((y * 54) * 8))
+    end;
+    y := (a - 26);
+    for i := 1 to 3 do
+    begin
+        b := (54 - ((y + 19) + (b * b)));
+        if ((2 - a) * (97 + 48)) < a then
+        begin
+            for j := 1 to 2 do
+            begin
+                a := b;
+                a := (x - 22)
+            end;
+            for j := 1 to 4 do
+            begin
+                z := b;
+                z := 24
+            end
+        end
+        else
+        begin
+            y := ((54 * (a - 62)) * 36);
+            if (31 + 97) < b then
+            begin
+                y := ((x - 87) + ((z * b) * (z + a)));
+                x := (b + (a - (35 * y)))
+            end
+        end;
+        a := (b - (62 - b))
+    end
+end;
+
+procedure q142(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := ((x - (65 * z)) - ((62 - 77) - (57 + y)));
+    if ((34 + z) + (z * b)) < ((87 * 1) - x) then
+    begin
+        b := (((48 + 56) - (7 + 13)) - a)
+    end
+    else
+    begin
+        z := y
+    end;
+    x := 66;
+    q56(x, y)
+end;
+
+procedure q143(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := (((y + z) - 72) - (12 + 63));
+    if ((y + 84) - (z * y)) < (y - (30 * a)) then
+    begin
+        x := y;
+        for i := 1 to 3 do
+        begin
+            for j := 1 to 2 do
+            begin
+                y := (((b + b) + (z - 9)) * ((a - y) + a));
+                x := (((54 - 15) + (89 + a)) * ((a + 98) * (66 - 22)))
+            end
+        end;
+        z := 4
+    end;
+    x := (((y * x) + (a * z)) - (56 * (a - 1)));
+    q69(x, y)
+end;
+
+procedure q144(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if (a + (a - 78)) < ((b + 65) * (40 + b)) then
+    begin
+        z := (((x + 83) * (y - 42)) - ((y * 86) * 9));
+        writeln(x, b);
+        writeln(b, x)
+    end;
+    for i := 1 to 8 do
+    begin
+        if ((y + 14) - a) < 21 then
+        begin
+            a := a;
+            y := ((1 - y) * ((y - x) + (38 + 59)))
+        end
+        else
+        begin
+            for j := 1 to 5 do
+            begin
+                a := (((b - x) - b) * y);
+                y := x;
+                y := (((b - 51) * (x + 24)) - (z - 20))
+            end
+        end;
+        if ((50 - x) - (b - a)) < ((b - b) * (60 * 47)) then
+        begin
+            if 5 < ((b - 57) * (72 - x)) then
+            begin
+                a := (x * ((b * 5) * (x - b)));
+                z := (((b - z) + (y + b)) - (z - (z + z)))
+            end
+            else
+            begin
+                b := (33 - (y - (x - 51)));
+                y := y
+            end;
+            if 17 < ((58 + 66) + (x * 22)) then
+            begin
+                a := ((77 * x) * ((94 + 52) * 77));
+                a := (z * ((66 + x) + a));
+                a := (((44 - 91) + (93 * z)) * a)
+            end;
+            writeln(a, y)
+        end;
+        for j := 1 to 8 do
+        begin
+            if (38 - (34 + b)) < ((z + b) + (80 * 34)) then
+            begin
+                x := (((20 + a) * (48 - 46)) - ((51 - z) * z));
+                a := (((38 * x) - z) - 99);
+                b := 35
+            end
+        end
+    end;
+    writeln(z, y);
+    q24(x, y)
+end;
+
+procedure q145(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := (((47 - z) - 89) - (a * x));
+    if ((z * 16) * y) < ((z - 59) - (y * b)) then
+    begin
+        x := z;
+        if ((61 * 5) + (18 * y)) < ((b * a) + (74 - b)) then
+        begin
+            for i := 1 to 6 do
+            begin
+                x := ((b * (56 * 60)) * ((y * y) * (92 + a)))
+            end;
+            z := y
+        end
+    end
+    else
+    begin
+        if ((80 - 25) * (x + z)) < x then
+        begin
+            b := (x + z);
+            for i := 1 to 7 do
+            begin
+                x := ((25 * 92) * ((23 + 86) - (81 * 99)))
+            end
+        end
+    end;
+    z := (((y * 93) + (x + a)) + ((a - 91) * (53 * 83)));
+    a := (((y * 29) * (82 - 75)) + (43 * (x * z)));
+    q54(x, y)
+end;
+
+procedure q146(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := 65;
+    writeln(z, y);
+    if ((z - 73) + (b + z)) < (13 * y) then
+    begin
+        a := (((x + z) + (a * 86)) + (81 - (b - b)));
+        x := (((x * 80) - (a - a)) * ((b - b) - x));
+        for i := 1 to 9 do
+        begin
+            x := ((99 - (a + 2)) - ((x + y) + (24 * y)));
+            z := ((y * (35 - a)) - 38)
+        end
+    end;
+    y := (((28 + b) - (74 - 47)) - ((63 + a) - (96 + 23)));
+    for i := 1 to 5 do
+    begin
+        for j := 1 to 9 do
+        begin
+            y := ((12 - (78 + 86)) + b);
+            if ((33 + a) * (44 - 52)) < y then
+            begin
+                a := (50 - a)
+            end
+        end;
+        if (47 + (61 * 86)) < ((b - 21) * (51 - a)) then
+        begin
+            z := ((b * (78 * 42)) - (62 + b));
+            a := z
+        end;
+        x := (z * y)
+    end;
+    b := (((x + 46) - (x - b)) + b)
+end;
+
+procedure q147(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 2 do
+    begin
+        b := (((b + b) * (y + b)) - ((y + x) * (x - b)));
+        if 16 < ((7 * z) - (45 + 44)) then
+        begin
+            a := (z * ((x - a) * z));
+            writeln(y, b);
+            if (32 + 57) < b then
+            begin
+                z := (89 - (a - x))
+            end
+            else
+            begin
+                x := 15;
+                a := ((y + (83 * z)) + 63)
+            end
+        end
+        else
+        begin
+            z := (((z + x) - (y - y)) * ((x * 88) * (47 - a)));
+            if (z - z) < ((y - y) * z) then
+            begin
+                y := ((80 + (67 - y)) * ((17 * z) + (a - x)));
+                a := (((x * z) + 38) - 61)
+            end
+            else
+            begin
+                b := 8
+            end
+        end
+    end;
+    if ((b * y) - (86 * y)) < (a * (y * x)) then
+    begin
+        z := 61;
+        writeln(y, z);
+        z := (((93 + 50) - z) - ((a + 38) - (57 * y)))
+    end
+    else
+    begin
+        for i := 1 to 2 do
+        begin
+            for j := 1 to 4 do
+            begin
+                y := ((b + (a * y)) + b);
+                y := 41;
+                z := (((z * a) - (b * a)) - z)
+            end;
+            for j := 1 to 4 do
+            begin
+                z := (a - a);
+                y := (a - (a + (43 + z)))
+            end
+        end
+    end;
+    if 93 < ((a - y) * z) then
+    begin
+        for i := 1 to 2 do
+        begin
+            for j := 1 to 5 do
+            begin
+                z := ((y - (y - x)) * ((97 - a) - (86 - b)));
+                a := z
+            end;
+            for j := 1 to 3 do
+            begin
+                x := ((z - (81 + a)) + x)
+            end
+        end;
+        a := (((b + a) * (a + x)) * ((x + 57) * (a - x)))
+    end
+    else
+    begin
+        y := 74
+    end;
+    for i := 1 to 2 do
+    begin
+        z := (((95 * 84) * (29 * z)) + ((39 - z) * b));
+        a := (((34 - 79) * (b * 99)) + (z + 93));
+        for j := 1 to 8 do
+        begin
+            for k := 1 to 7 do
+            begin
+                z := ((y + 76) * ((69 * a) + (y * b)))
+            end;
+            for k := 1 to 7 do
+            begin
+                x := (((y + x) + (y * y)) + (75 - (82 * 63)))
+            end
+        end
+    end;
+    a := (((58 + b) * 64) + (y + 33));
+    q106(x, y)
+end;
+
+procedure q148(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := b;
+    x := (((77 - 37) * (z + 94)) - (y + z));
+    if ((95 + b) - (y - 16)) < (35 + (a + x)) then
+    begin
+        x := ((93 + (x + 47)) - x)
+    end
+    else
+    begin
+        if ((44 + z) * (x * 23)) < ((b - x) + (z + a)) then
+        begin
+            if y < y then
+            begin
+                y := (((66 + x) - (y - b)) * 25)
+            end;
+            y := ((94 - (z + 43)) + ((z + 5) + b));
+            if ((x + 71) * (a * a)) < (z + z) then
+            begin
+                z := z
+            end
+        end
+        else
+        begin
+            x := 31
+        end
+    end;
+    for i := 1 to 3 do
+    begin
+        x := (((y - y) + a) - ((b + y) * (x + 71)));
+        writeln(b, y)
+    end;
+    writeln(a, b);
+    q106(x, y)
+end;
+
+procedure q149(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    z := y;
+    if ((51 + 68) + 62) < (68 - (z + a)) then
+    begin
+        for i := 1 to 4 do
+        begin
+            y := ((y + (75 + a)) * (44 * (a - b)))
+        end;
+        writeln(x, y)
+    end
+    else
+    begin
+        if ((z * b) + (x + b)) < b then
+        begin
+            a := 87;
+            x := ((65 * (z - a)) + ((23 * 97) - z))
+        end;
+        x := (((x * y) - 64) * (b + (a + 76)))
+    end;
+    if b < 87 then
+    begin
+        for i := 1 to 6 do
+        begin
+            a := (87 + ((a - b) - a))
+        end;
+        writeln(x, b)
+    end;
+    b := x;
+    q140(x, y)
+end;
+
+procedure q150(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := y;
+    z := x;
+    a := (((z * x) - (30 * y)) + ((y + x) + 20));
+    if ((49 - 7) - (3 + b)) < ((y - x) * y) then
+    begin
+        b := (((64 * 99) - 41) * ((68 * 15) - (b + a)));
+        a := x
+    end
+    else
+    begin
+        if ((54 - b) - 92) < a then
+        begin
+            z := (((x - 1) + 84) + ((60 + b) * (b - b)));
+            if ((12 - b) - (y - a)) < ((95 - b) - (57 * 20)) then
+            begin
+                y := (23 - ((16 - 61) - (56 + z)));
+                b := (x + ((z - b) * (45 + 44)))
+            end;
+            y := (64 - ((30 + 97) - (y + 83)))
+        end;
+        b := (((83 * y) * (a * y)) * ((69 - x) - (z * a)))
+    end;
+    q82(x, y)
+end;
+
+procedure q151(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 9 do
+    begin
+        if b < ((78 - z) - 65) then
+        begin
+            x := (90 - ((a * a) + (x * z)));
+            for j := 1 to 6 do
+            begin
+                z := (((46 + y) * x) - ((y + 78) * (a - 13)));
+                x := (93 * ((y * 79) + (a - b)));
+                a := 16
+            end
+        end
+        else
+        begin
+            for j := 1 to 4 do
+            begin
+                a := y
+            end;
+            a := ((97 - y) * 12)
+        end;
+        b := ((y + (24 + 40)) * 24)
+    end;
+    z := a;
+    z := (((a * z) + (43 + 83)) + ((z - z) + (24 - z)));
+    b := 13;
+    a := b;
+    q26(x, y)
+end;
+
+procedure q152(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    b := x;
+    a := z;
+    z := (((22 + b) + a) * (91 - 98))
+end;
+
+procedure q153(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    a := z;
+    writeln(z, y);
+    writeln(b, y);
+    for i := 1 to 3 do
+    begin
+        writeln(a, y)
+    end;
+    if (a * 77) < a then
+    begin
+        y := (((b * y) * 95) + (58 + (y + x)));
+        a := (((b - z) * x) * ((4 * b) * (x + 18)));
+        if ((z + 66) - (a - x)) < 31 then
+        begin
+            if (y + (52 + 30)) < a then
+            begin
+                a := (((b + y) + (33 * y)) - ((b - b) + (75 + 2)));
+                x := (a - x);
+                y := ((x + (18 * 4)) - (57 * (y + 96)))
+            end
+        end
+    end
+    else
+    begin
+        if ((z + y) * (96 - y)) < ((96 * 11) * (b + 34)) then
+        begin
+            writeln(x, a)
+        end
+    end
+end;
+
+procedure q154(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    x := 7;
+    y := (((b + 4) + a) - ((7 - 3) * x));
+    writeln(x, z);
+    for i := 1 to 2 do
+    begin
+        x := y
+    end;
+    x := z
+end;
+
+procedure q155(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((y + z) * (51 - y)) < (a * (a + 15)) then
+    begin
+        for i := 1 to 3 do
+        begin
+            x := 48;
+            for j := 1 to 2 do
+            begin
+                x := (((64 - y) * 62) * ((13 * b) + (y - b)));
+                y := x
+            end
+        end
+    end
+    else
+    begin
+        z := ((z + 9) + ((81 + x) - (b * x)));
+        writeln(a, x)
+    end;
+    writeln(x, z);
+    a := (((70 - 31) * 72) * ((y + y) - (61 + a)));
+    x := (((59 + z) * (y - y)) + (b - 17));
+    z := z;
+    q3(x, y)
+end;
+
+procedure q156(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    if ((a + 84) - (z * 54)) < ((58 - 15) - 60) then
+    begin
+        x := (((x - 5) * (80 * x)) + ((x - 71) - (91 * 50)))
+    end;
+    writeln(y, b);
+    x := ((43 + (28 + 21)) - ((b - x) * (a * x)));
+    if ((55 - y) - (b - x)) < z then
+    begin
+        x := 78;
+        if ((y - 33) + x) < (b * (y + b)) then
+        begin
+            y := (((y * b) + (z + x)) * (62 - 56));
+            for i := 1 to 4 do
+            begin
+                a := (z * ((b * 54) - a));
+                z := ((x * (84 + b)) + ((48 * 56) * (b + x)))
+            end
+        end
+    end;
+    y := (((21 * y) + (x * x)) + (23 - (a - a)));
+    x := 46;
+    y := ((82 - (32 * y)) * ((b * z) * (11 + 56)));
+    q129(x, y)
+end;
+
+procedure q157(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    y := (((a - b) * (49 - x)) + ((z + x) + 2));
+    a := (36 + (b - (a - 29)));
+    if (b + (a * x)) < ((a + a) * (y - a)) then
+    begin
+        a := ((91 * (57 + b)) * ((a + 38) * z));
+        for i := 1 to 4 do
+        begin
+            writeln(x, a)
+        end
+    end;
+    b := (((y + x) + (x * 36)) - 92);
+    if (a + (9 * x)) < ((81 - b) - (90 - 97)) then
+    begin
+        writeln(z, y);
+        x := x
+    end
+    else
+    begin
+        a := (x + ((89 * a) * (x + 21)));
+        y := z
+    end;
+    for i := 1 to 3 do
+    begin
+        z := y;
+        for j := 1 to 7 do
+        begin
+            writeln(a, b);
+            z := (((x + 36) * 34) + ((68 * x) + 30))
+        end
+    end;
+    q131(x, y)
+end;
+
+procedure q158(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    writeln(b, y);
+    for i := 1 to 9 do
+    begin
+        x := 86
+    end;
+    for i := 1 to 6 do
+    begin
+        if ((z + a) + (x + z)) < ((y - a) * y) then
+        begin
+            a := ((59 - (z + y)) - (x - (y - a)))
+        end
+        else
+        begin
+            a := (71 + 34);
+            z := (b * ((y - 36) * z))
+        end
+    end;
+    a := ((y * (z * b)) * ((b + y) + (70 + y)));
+    if y < (y * x) then
+    begin
+        for i := 1 to 3 do
+        begin
+            y := (((z - 45) * (96 + a)) + (66 - a));
+            for j := 1 to 4 do
+            begin
+                x := a;
+                x := y
+            end
+        end;
+        if ((64 + 69) + (a + 82)) < z then
+        begin
+            for i := 1 to 5 do
+            begin
+                z := a;
+                a := 84;
+                a := (((5 - b) - (37 - z)) + ((32 + a) + (a + 55)))
+            end;
+            a := (7 - ((16 * x) - (z * 70)))
+        end
+        else
+        begin
+            y := x;
+            if ((a - 69) - 8) < x then
+            begin
+                y := (((2 * b) * (z * z)) + (b + (1 - a)));
+                x := z
+            end
+        end
+    end
+    else
+    begin
+        z := 72
+    end;
+    for i := 1 to 6 do
+    begin
+        y := (b * ((49 + b) - (b - 16)));
+        b := (x * (y - (56 - y)))
+    end;
+    q49(x, y)
+end;
+
+procedure q159(a : integer; b : integer);
+var x, y, z, i, j, k : integer;
+begin
+    x := a;
+    y := b;
+    z := 0;
+    for i := 1 to 7 do
+    begin
+        writeln(x, z);
+        writeln(z, a);
+        z := (((b * 14) * (y - 31)) * (b + z))
+    end;
+    for i := 1 to 5 do
+    begin
+        for j := 1 to 8 do
+        begin
+            if ((20 - a) + (z - 55)) < ((84 + b) - (78 - 26)) then
+            begin
+                x := 25;
+                z := ((a * (z * y)) - 47)
+            end
+            else
+            begin
+                a := (((53 + z) * 9) - ((y - 65) * (b - x)));
+                b := ((a - (y * x)) + ((z - a) + (x * 80)))
+            end
+        end
+    end;
+    for i := 1 to 7 do
+    begin
+        z := ((35 * x) * ((82 + b) + 65));
+        for j := 1 to 8 do
+        begin
+            y := z;
+            if ((a * z) + (z + 83)) < ((57 + z) * (a - 41)) then
+            begin
+                a := 26;
+                x := ((x - (z * x)) + z)
+            end
+            else
+            begin
+                a := (((a * a) - (52 - 98)) + ((y + z) * (55 - 41)))
+            end;
+            writeln(x, b)
+        end;
+        z := ((z + (y - 6)) - (34 + b))
+    end
+end;
+
+var n : integer;
+begin
+    n := 7;
+    q0(n, 0);
+    q4(n, 4);
+    q8(n, 8);
+    q12(n, 12);
+    q16(n, 16);
+    q20(n, 20);
+    q24(n, 24);
+    q28(n, 28);
+    q32(n, 32);
+    q36(n, 36);
+    q40(n, 40);
+    q44(n, 44);
+    q48(n, 48);
+    q52(n, 52);
+    q56(n, 56);
+    q60(n, 60);
+    q64(n, 64);
+    q68(n, 68);
+    q72(n, 72);
+    q76(n, 76);
+    q80(n, 80);
+    q84(n, 84);
+    q88(n, 88);
+    q92(n, 92);
+    q96(n, 96);
+    q100(n, 100);
+    q104(n, 104);
+    q108(n, 108);
+    q112(n, 112);
+    q116(n, 116);
+    q120(n, 120);
+    q124(n, 124);
+    q128(n, 128);
+    q132(n, 132);
+    q136(n, 136);
+    q140(n, 140);
+    q144(n, 144);
+    q148(n, 148);
+    q152(n, 152);
+    q156(n, 156)
+end.
@@ -0,0 +1,61 @@
+program loops;
+var i, j, k, l, n, sum, prod, acc, t : integer;
+    r, s : real;
+begin
+    n := 200;
+    sum := 0;
+    prod := 1;
+    acc := 0;
+    r := 0.0;
+    for i := 1 to n do
+    begin
+        sum := sum + i
+    end;
+    for i := 1 to n do
+    begin
+        for j := 1 to n do
+        begin
+            acc := acc + i * j - (i - j)
+        end
+    end;
+    for i := 1 to 20 do
+    begin
+        for j := 1 to 20 do
+        begin
+            for k := 1 to 20 do
+            begin
+                for l := 1 to 20 do
+                begin
+                    t := i * 8000 + j * 400 + k * 20 + l;
+                    acc := acc + t - sum
+                end
+            end
+        end
+    end;
+    for i := 1 to n do
+    begin
+        r := r + 0.5 * i;
+        s := r * 2.0 - 1.0
+    end;
+    for i := 1 to 30 do
+    begin
+        prod := prod * 2;
+        if 1000000 < prod then
+            prod := 1
+    end;
+    parallel for i := 1 to n * n reduce(+: sum) do
+    begin
+        sum := sum + i * 3
+    end;
+    for i := 1 to n do
+    begin
+        for j := i to n do
+        begin
+            if i < j then
+                acc := acc + 1
+            else
+                acc := acc - 1
+        end
+    end;
+    writeln(sum, ' ', prod, ' ', acc, ' ', r, ' ', s)
+end.
@@ -0,0 +1,81 @@
+program medium;
+
+procedure fib(n : integer);
+var a, b, t, k : integer;
+begin
+    a := 0;
+    b := 1;
+    for k := 1 to n do
+    begin
+        t := a + b;
+        a := b;
+        b := t
+    end;
+    writeln('fib ', n, ': ', a)
+end;
+
+procedure triangle(n : integer);
+var i, j, sum : integer;
+begin
+    sum := 0;
+    for i := 1 to n do
+    begin
+        for j := 1 to i do
+        begin
+            sum := sum + j
+        end
+    end;
+    writeln('triangle ', n, ': ', sum)
+end;
+
+procedure mean(a, b, c : real);
+var m : real;
+begin
+    m := (a + b + c) * 0.3333333;
+    writeln('mean: ', m)
+end;
+
+procedure classify(x : integer);
+begin
+    if x < 0 then
+        writeln(x, ' is negative')
+    else if x < 10 then
+        writeln(x, ' is small')
+    else if x < 100 then
+        writeln(x, ' is medium')
+    else
+        writeln(x, ' is large')
+end;
+
+procedure powers(base : integer; n : integer);
+var i, p : integer;
+begin
+    p := 1;
+    for i := 1 to n do
+    begin
+        p := p * base;
+        write(p, ' ')
+    end;
+    writeln()
+end;
+
+var i, total : integer;
+    ok : boolean;
+    r : real;
+begin
+    total := 0;
+    ok := true;
+    r := 1.5;
+    for i := 1 to 20 do
+    begin
+        total := total + i * i - i;
+        r := r * 1.01;
+        classify(total - 500)
+    end;
+    fib(40);
+    triangle(100);
+    mean(1.0, 2.5, r);
+    powers(3, 10);
+    if ok then
+        writeln('total: ', total)
+end.
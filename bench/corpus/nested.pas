@@ -0,0 +1,135 @@
+program nested;
+var v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, acc : integer;
+begin
+    acc := 0;
+    for v0 := 1 to 2 do
+    begin
+        if acc < 999999 then
+        begin
+            for v2 := 1 to 2 do
+            begin
+                if acc < 999997 then
+                begin
+                    for v4 := 1 to 2 do
+                    begin
+                        if acc < 999995 then
+                        begin
+                            for v6 := 1 to 2 do
+                            begin
+                                if acc < 999993 then
+                                begin
+                                    for v8 := 1 to 2 do
+                                    begin
+                                        if acc < 999991 then
+                                        begin
+                                            for v10 := 1 to 2 do
+                                            begin
+                                                if acc < 999989 then
+                                                begin
+                                                    for v12 := 1 to 2 do
+                                                    begin
+                                                        if acc < 999987 then
+                                                        begin
+                                                            for v14 := 1 to 2 do
+                                                            begin
+                                                                if acc < 999985 then
+                                                                begin
+                                                                    for v16 := 1 to 2 do
+                                                                    begin
+                                                                        if acc < 999983 then
+                                                                        begin
+                                                                            for v18 := 1 to 2 do
+                                                                            begin
+                                                                                if acc < 999981 then
+                                                                                begin
+                                                                                    for v20 := 1 to 2 do
+                                                                                    begin
+                                                                                        if acc < 999979 then
+                                                                                        begin
+                                                                                            for v22 := 1 to 2 do
+                                                                                            begin
+                                                                                                if acc < 999977 then
+                                                                                                begin
+                                                                                                    acc := acc + 1
+                                                                                                end
+                                                                                                else
+                                                                                                begin
+                                                                                                    acc := acc - 23
+                                                                                                end
+                                                                                            end
+                                                                                        end
+                                                                                        else
+                                                                                        begin
+                                                                                            acc := acc - 21
+                                                                                        end
+                                                                                    end
+                                                                                end
+                                                                                else
+                                                                                begin
+                                                                                    acc := acc - 19
+                                                                                end
+                                                                            end
+                                                                        end
+                                                                        else
+                                                                        begin
+                                                                            acc := acc - 17
+                                                                        end
+                                                                    end
+                                                                end
+                                                                else
+                                                                begin
+                                                                    acc := acc - 15
+                                                                end
+                                                            end
+                                                        end
+                                                        else
+                                                        begin
+                                                            acc := acc - 13
+                                                        end
+                                                    end
+                                                end
+                                                else
+                                                begin
+                                                    acc := acc - 11
+                                                end
+                                            end
+                                        end
+                                        else
+                                        begin
+                                            acc := acc - 9
+                                        end
+                                    end
+                                end
+                                else
+                                begin
+                                    acc := acc - 7
+                                end
+                            end
+                        end
+                        else
+                        begin
+                            acc := acc - 5
+                        end
+                    end
+                end
+                else
+                begin
+                    acc := acc - 3
+                end
+            end
+        end
+        else
+        begin
+            acc := acc - 1
+        end
+    end;
+    acc := ((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20);
+    acc := (((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25);
+    acc := ((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30);
+    acc := (((((((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30) - 31) * 32) + 33) - 34) * 35);
+    acc := ((((((((((((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30) - 31) * 32) + 33) - 34) * 35) + 36) - 37) * 38) + 39) - 40);
+    acc := (((((((((((((((((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30) - 31) * 32) + 33) - 34) * 35) + 36) - 37) * 38) + 39) - 40) * 41) + 42) - 43) * 44) + 45);
+    acc := ((((((((((((((((((((((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30) - 31) * 32) + 33) - 34) * 35) + 36) - 37) * 38) + 39) - 40) * 41) + 42) - 43) * 44) + 45) - 46) * 47) + 48) - 49) * 50);
+    acc := (((((((((((((((((((((((((((((((((((((((((((((((((((((((acc - 1) * 2) + 3) - 4) * 5) + 6) - 7) * 8) + 9) - 10) * 11) + 12) - 13) * 14) + 15) - 16) * 17) + 18) - 19) * 20) + 21) - 22) * 23) + 24) - 25) * 26) + 27) - 28) * 29) + 30) - 31) * 32) + 33) - 34) * 35) + 36) - 37) * 38) + 39) - 40) * 41) + 42) - 43) * 44) + 45) - 46) * 47) + 48) - 49) * 50) + 51) - 52) * 53) + 54) - 55);
+    writeln('nested: ', acc)
+end.
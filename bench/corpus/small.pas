@@ -0,0 +1,11 @@
+program small;
+var a, b, c : integer;
+begin
+    a := 6;
+    b := 7;
+    c := a * b;
+    if c < 50 then
+        writeln('small: ', c)
+    else
+        writeln('too big')
+end.
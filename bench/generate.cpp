@@ -0,0 +1,240 @@
+// Writes a random but valid program to stdout, for measuring how compile time
+// and memory grow with the size of the input:
+//
+//   mpgen [--seed=N] [--procedures=N] [--statements=N] [--depth=N]
+//         [--expr-length=N] [--vars=N]
+//
+// --statements is per procedure body, --depth the deepest nesting of if and
+// for statements in each body, --expr-length the number of operands in each
+// expression and --vars the number of variables declared in each scope. The
+// same options always produce the same program, on any platform. Programs
+// are meant to be compiled rather than run: calls in loops can make them run
+// for a very long time, and their arithmetic may overflow.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+struct GeneratorOptions {
+    uint64_t Seed = 1;
+    unsigned Procedures = 10;
+    unsigned Statements = 10;
+    unsigned Depth = 2;
+    unsigned ExprLength = 4;
+    unsigned Vars = 4;
+};
+
+// splitmix64, rather than <random>, whose distributions differ between
+// standard libraries
+class Random {
+    uint64_t State;
+
+   public:
+    Random(uint64_t Seed) : State(Seed) {}
+
+    uint64_t Next() {
+        uint64_t Z = (State += 0x9e3779b97f4a7c15);
+        Z = (Z ^ (Z >> 30)) * 0xbf58476d1ce4e5b9;
+        Z = (Z ^ (Z >> 27)) * 0x94d049bb133111eb;
+        return Z ^ (Z >> 31);
+    }
+
+    /**
+     * Uniform enough in [0, N) for N > 0
+     */
+    unsigned Below(unsigned N) { return Next() % N; }
+
+    bool OneIn(unsigned N) { return Below(N) == 0; }
+};
+
+class Generator {
+    const GeneratorOptions &Opts;
+    Random R;
+    std::string Out;
+    // Procedures generated so far, which the current one may call
+    unsigned Defined = 0;
+
+    void Line(unsigned Indent, const std::string &Text) {
+        Out.append(Indent * 4, ' ');
+        Out += Text;
+        Out += '\n';
+    }
+
+    std::string Var() { return "v" + std::to_string(R.Below(Opts.Vars)); }
+
+    std::string Operand() {
+        return R.OneIn(3) ? std::to_string(R.Below(100)) : Var();
+    }
+
+    // Every draw from R is a statement of its own below, as the operands of
+    // + may be evaluated in any order
+
+    std::string Expr(unsigned Length) {
+        // Split now and then, so that parenthesized subexpressions take the
+        // recursive path through the parser
+        if (Length > 2 && R.OneIn(4)) {
+            unsigned Left = 1 + R.Below(Length - 1);
+            std::string E = "(" + Expr(Left) + ") ";
+            E += Op();
+            return E + " (" + Expr(Length - Left) + ")";
+        }
+        std::string E = Operand();
+        for (unsigned i = 1; i < Length; i++) {
+            E += " " + Op();
+            E += " " + Operand();
+        }
+        return E;
+    }
+
+    std::string Op() {
+        static const char *Ops[] = {"+", "-", "*"};
+        return Ops[R.Below(3)];
+    }
+
+    std::string Cond() {
+        unsigned Half = (Opts.ExprLength + 1) / 2;
+        std::string C = Expr(Half) + " < ";
+        return C + Expr(Half);
+    }
+
+    /**
+     * Writes Count statements at nesting level Level, the first of which
+     * reaches Depth if Deepest is set
+     */
+    void Statements(unsigned Count, unsigned Level, unsigned Indent,
+                    bool Deepest) {
+        for (unsigned i = 0; i < Count; i++) {
+            bool Last = i + 1 == Count;
+            Statement(Level, Indent, Deepest && i == 0);
+            if (!Last) {
+                Out.insert(Out.size() - 1, ";");
+            }
+        }
+    }
+
+    void Statement(unsigned Level, unsigned Indent, bool Deepest) {
+        bool CanNest = Level < Opts.Depth;
+        unsigned Kind = Deepest && CanNest ? R.Below(2) : R.Below(10);
+        // Nested blocks are short, so that the size of a program grows with
+        // the number of statements rather than exponentially with its depth
+        unsigned Inner = 1 + R.Below(2);
+
+        if (Kind == 0 && CanNest) {
+            Line(Indent, "for l" + std::to_string(Level) + " := 1 to 2 do");
+            Line(Indent, "begin");
+            Statements(Inner, Level + 1, Indent + 1, Deepest);
+            Line(Indent, "end");
+        } else if (Kind == 1 && CanNest) {
+            Line(Indent, "if " + Cond() + " then");
+            Line(Indent, "begin");
+            Statements(Inner, Level + 1, Indent + 1, Deepest);
+            Line(Indent, "end");
+            if (R.OneIn(2)) {
+                Line(Indent, "else");
+                Line(Indent, "begin");
+                Statements(Inner, Level + 1, Indent + 1, false);
+                Line(Indent, "end");
+            }
+        } else if (Kind == 2 && Defined > 0) {
+            std::string Call = "p" + std::to_string(R.Below(Defined)) + "(";
+            Call += Expr(Opts.ExprLength) + ", ";
+            Line(Indent, Call + Expr(Opts.ExprLength) + ")");
+        } else if (Kind == 3) {
+            Line(Indent, "writeln(" + Var() + ")");
+        } else {
+            std::string Target = Var();
+            Line(Indent, Target + " := " + Expr(Opts.ExprLength));
+        }
+    }
+
+    void Declarations() {
+        std::string Names;
+        for (unsigned i = 0; i < Opts.Vars; i++) {
+            Names += (i ? ", v" : "v") + std::to_string(i);
+        }
+        for (unsigned i = 0; i < Opts.Depth; i++) {
+            Names += ", l" + std::to_string(i);
+        }
+        Line(0, "var " + Names + " : integer;");
+    }
+
+    void Body() {
+        Line(0, "begin");
+        // Variables start out defined
+        for (unsigned i = 0; i < Opts.Vars; i++) {
+            Line(1, "v" + std::to_string(i) + " := " +
+                        std::to_string(R.Below(100)) + ";");
+        }
+        Statements(Opts.Statements, 0, 1, true);
+    }
+
+   public:
+    Generator(const GeneratorOptions &Opts) : Opts(Opts), R(Opts.Seed) {}
+
+    std::string Program() {
+        Line(0, "program gen" + std::to_string(Opts.Seed) + ";");
+        for (unsigned i = 0; i < Opts.Procedures; i++) {
+            Line(0, "");
+            Line(0, "procedure p" + std::to_string(i) +
+                        "(a : integer; b : integer);");
+            Declarations();
+            Body();
+            Line(0, "end;");
+            Defined++;
+        }
+        Line(0, "");
+        Declarations();
+        Body();
+        Line(0, "end.");
+        return Out;
+    }
+};
+
+static bool ParseOption(const char *Arg, const char *Name, uint64_t &Value) {
+    size_t Len = std::strlen(Name);
+    if (std::strncmp(Arg, Name, Len) || Arg[Len] != '=') {
+        return false;
+    }
+    char *End;
+    Value = std::strtoull(Arg + Len + 1, &End, 10);
+    if (*End != '\0') {
+        std::cerr << "mpgen: " << Name << " expects a number\n";
+        std::exit(1);
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    GeneratorOptions Opts;
+    for (int i = 1; i < argc; i++) {
+        uint64_t Value;
+        if (ParseOption(argv[i], "--seed", Value)) {
+            Opts.Seed = Value;
+        } else if (ParseOption(argv[i], "--procedures", Value)) {
+            Opts.Procedures = Value;
+        } else if (ParseOption(argv[i], "--statements", Value)) {
+            Opts.Statements = Value;
+        } else if (ParseOption(argv[i], "--depth", Value)) {
+            Opts.Depth = Value;
+        } else if (ParseOption(argv[i], "--expr-length", Value)) {
+            Opts.ExprLength = Value;
+        } else if (ParseOption(argv[i], "--vars", Value)) {
+            Opts.Vars = Value;
+        } else {
+            std::cerr << "usage: mpgen [--seed=N] [--procedures=N] "
+                         "[--statements=N] [--depth=N] [--expr-length=N] "
+                         "[--vars=N]\n";
+            return 1;
+        }
+    }
+    if (Opts.Statements == 0 || Opts.ExprLength == 0 || Opts.Vars == 0) {
+        std::cerr << "mpgen: --statements, --expr-length and --vars must be "
+                     "at least 1\n";
+        return 1;
+    }
+
+    std::cout << Generator(Opts).Program();
+    return 0;
+}
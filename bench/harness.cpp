@@ -0,0 +1,80 @@
+#include "harness.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "lexer/lexer.h"
+#include "parser/parser.h"
+
+double Since(Clock::time_point Start) {
+    return std::chrono::duration<double>(Clock::now() - Start).count();
+}
+
+Stats Summarize(std::vector<double> Samples) {
+    std::sort(Samples.begin(), Samples.end());
+    size_t N = Samples.size();
+    Stats S;
+    S.Min = Samples.front();
+    S.Max = Samples.back();
+    S.Median = N % 2 ? Samples[N / 2]
+                     : (Samples[N / 2 - 1] + Samples[N / 2]) / 2;
+    double Sum = 0;
+    for (double X : Samples) {
+        Sum += X;
+    }
+    S.Mean = Sum / N;
+    double Squares = 0;
+    for (double X : Samples) {
+        Squares += (X - S.Mean) * (X - S.Mean);
+    }
+    S.StdDev = N > 1 ? std::sqrt(Squares / (N - 1)) : 0;
+    return S;
+}
+
+std::string ReadSource(const std::string &Path) {
+    std::ifstream File(Path);
+    if (!File) {
+        std::cerr << "cannot read " << Path << "\n";
+        std::exit(1);
+    }
+    std::ostringstream Contents;
+    Contents << File.rdbuf();
+    // Ends the last token even if the file does not
+    return Contents.str() + "\n";
+}
+
+void ResetLexer(std::string &Source) {
+    static thread_local std::FILE *In = nullptr;
+    if (In) {
+        std::fclose(In);
+    }
+    In = fmemopen(Source.data(), Source.size(), "r");
+    if (!In) {
+        std::perror("fmemopen");
+        std::exit(1);
+    }
+    SetLexerInput(In);
+}
+
+std::vector<std::unique_ptr<ProgramAST>> Parse(std::string &Source) {
+    std::vector<std::unique_ptr<ProgramAST>> Programs;
+    ResetLexer(Source);
+    getNextToken();
+    while (CurTok != tok_eof) {
+        if (CurTok != tok_program) {
+            getNextToken();
+            continue;
+        }
+        if (auto P = ParseProgram()) {
+            Programs.push_back(std::move(P));
+        } else {
+            getNextToken();
+        }
+    }
+    return Programs;
+}
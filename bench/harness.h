@@ -0,0 +1,44 @@
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ast/ast.h"
+
+/**
+ * Helpers shared by the benchmark executables
+ */
+
+using Clock = std::chrono::steady_clock;
+
+double Since(Clock::time_point Start);
+
+struct Stats {
+    double Min, Median, Mean, StdDev, Max;
+};
+
+/**
+ * Samples must not be empty
+ */
+Stats Summarize(std::vector<double> Samples);
+
+/**
+ * Reads the file at Path, or exits if it cannot be read
+ */
+std::string ReadSource(const std::string &Path);
+
+/**
+ * Points the calling thread's lexer at Source, from the start. Source must
+ * stay alive until the next call.
+ */
+void ResetLexer(std::string &Source);
+
+/**
+ * Parses every program in Source
+ */
+std::vector<std::unique_ptr<ProgramAST>> Parse(std::string &Source);
+
+#endif
@@ -0,0 +1,232 @@
+// Compares the code the compiler generates with C compiled by clang -O2:
+//
+//   mpkernels [--reps=N] [--warmup=N] [--kernel-dir=dir] [-o results.tsv]
+//             [kernel...]
+//
+// Each kernel is a program in kernels/<name>.pas that prints a single result,
+// and a C function mpk_<name> in kernels/<name>.c that computes the same one
+// the same way. Both are run once to check that they agree, then timed. The
+// programs' micropascal_main is timed on its own, without compilation. The
+// results file is tab separated, one line per kernel, with columns that will
+// only ever be appended to.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+#include "codegen/codegen.h"
+#include "harness.h"
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/TargetSelect.h"
+#include "logger/logger.h"
+#include "parser/parser.h"
+#include "runtime/runtime.h"
+#include "symbols/symbols.h"
+
+extern "C" {
+int64_t mpk_loops();
+int64_t mpk_lcg();
+int64_t mpk_primes();
+double mpk_logistic();
+double mpk_poly();
+}
+
+static llvm::cl::list<std::string> Selected(
+    llvm::cl::Positional, llvm::cl::desc("[kernel...] (default: all)"));
+static llvm::cl::opt<unsigned> Reps(
+    "reps", llvm::cl::desc("Measured runs of every kernel"),
+    llvm::cl::init(5));
+static llvm::cl::opt<unsigned> Warmup(
+    "warmup", llvm::cl::desc("Unmeasured runs before the measured ones"),
+    llvm::cl::init(1));
+static llvm::cl::opt<std::string> KernelDir(
+    "kernel-dir", llvm::cl::desc("Where the kernels' programs are"),
+    llvm::cl::init(MICROPASCAL_KERNEL_DIR));
+static llvm::cl::opt<std::string> OutputFilename(
+    "o", llvm::cl::desc("Where to write the results"),
+    llvm::cl::value_desc("filename"), llvm::cl::init("kernel-results.tsv"));
+
+static llvm::ExitOnError ExitOnErr;
+
+// Bumped when a column changes meaning, never when one is appended
+static const int FormatVersion = 1;
+
+// Results as the programs print them
+static std::string Format(int64_t V) { return std::to_string(V); }
+
+static std::string Format(double V) {
+    char Buffer[32];
+    auto Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), V);
+    return std::string(Buffer, Result.ptr);
+}
+
+struct Kernel {
+    const char *Name;
+    std::function<std::string()> RunC;
+};
+
+static const Kernel Kernels[] = {
+    {"loops", [] { return Format(mpk_loops()); }},
+    {"lcg", [] { return Format(mpk_lcg()); }},
+    {"primes", [] { return Format(mpk_primes()); }},
+    {"logistic", [] { return Format(mpk_logistic()); }},
+    {"poly", [] { return Format(mpk_poly()); }},
+};
+
+struct KernelResult {
+    std::string Name;
+    Stats Pascal, C;
+};
+
+/**
+ * Runs Main with its output going to a temporary file and returns the output
+ * without the trailing newline
+ */
+static std::string RunCaptured(void (*Main)()) {
+    std::FILE *Out = std::tmpfile();
+    if (!Out) {
+        std::perror("mpkernels: tmpfile");
+        std::exit(1);
+    }
+    int Previous = mp_set_output_fd(fileno(Out));
+    Main();
+    mp_flush();
+    mp_set_output_fd(Previous);
+
+    std::string Output;
+    std::rewind(Out);
+    char Buffer[4096];
+    size_t Read;
+    while ((Read = std::fread(Buffer, 1, sizeof(Buffer), Out)) > 0) {
+        Output.append(Buffer, Read);
+    }
+    std::fclose(Out);
+    while (!Output.empty() && Output.back() == '\n') {
+        Output.pop_back();
+    }
+    return Output;
+}
+
+static void WriteResults(std::ostream &OS,
+                         const std::vector<KernelResult> &Rs,
+                         const std::string &Target) {
+    OS << "# micropascal-kernels " << FormatVersion << "\n"
+       << "# target " << Target << "\n"
+       << "# reps " << Reps << " warmup " << Warmup << "\n"
+       << "kernel\tmp_min_s\tmp_median_s\tmp_stddev_s\tc_min_s\tc_median_s"
+          "\tc_stddev_s\tratio\n";
+    OS << std::setprecision(6);
+    for (auto &R : Rs) {
+        OS << R.Name << "\t" << R.Pascal.Min << "\t" << R.Pascal.Median << "\t"
+           << R.Pascal.StdDev << "\t" << R.C.Min << "\t" << R.C.Median << "\t"
+           << R.C.StdDev << "\t"
+           << (R.C.Median > 0 ? R.Pascal.Median / R.C.Median : 0) << "\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    llvm::cl::ParseCommandLineOptions(
+        argc, argv, "micropascal generated code vs. C benchmarks\n");
+    if (Reps == 0) {
+        std::cerr << "mpkernels: --reps must be at least 1\n";
+        return 1;
+    }
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    InstantiateBinopPrecendence();
+
+    auto TheJIT = ExitOnErr(llvm::orc::KaleidoscopeJIT::Create());
+    ExitOnErr(DefineRuntimeSymbols(*TheJIT));
+    auto TM = ExitOnErr(TheJIT->createTargetMachine());
+
+    // Timed runs write their output nowhere
+    int Null = open("/dev/null", O_WRONLY);
+    if (Null < 0) {
+        std::perror("mpkernels: /dev/null");
+        return 1;
+    }
+
+    std::vector<KernelResult> Results;
+    bool Mismatch = false;
+    for (auto &K : Kernels) {
+        if (!Selected.empty() &&
+            std::find(Selected.begin(), Selected.end(), K.Name) ==
+                Selected.end()) {
+            continue;
+        }
+
+        std::string Path = KernelDir + "/" + K.Name + ".pas";
+        std::string Source = ReadSource(Path);
+        unsigned ErrorsBefore = GetErrorCount();
+        auto Programs = Parse(Source);
+        if (GetErrorCount() != ErrorsBefore || Programs.size() != 1) {
+            std::cerr << "mpkernels: " << Path
+                      << " must contain exactly one program\n";
+            return 1;
+        }
+
+        CodeGen CG;
+        CG.SetVerbose(false);
+        CG.Generate(std::move(Programs.front()), TheJIT->getDataLayout(), true,
+                    TM.get());
+        auto &JD = ExitOnErr(TheJIT->createProgramJITDylib(K.Name));
+        ExitOnErr(TheJIT->addModule(CG.TakeModule(),
+                                    JD.getDefaultResourceTracker()));
+        void (*Main)() = ExitOnErr(TheJIT->lookup(JD, "micropascal_main"))
+                             .getAddress()
+                             .toPtr<void (*)()>();
+
+        std::cerr << "mpkernels: " << K.Name << "\n";
+        std::string Expected = K.RunC();
+        std::string Actual = RunCaptured(Main);
+        if (Actual != Expected) {
+            std::cerr << "mpkernels: " << K.Name << " printed " << Actual
+                      << ", C computed " << Expected << "\n";
+            Mismatch = true;
+        }
+
+        std::vector<double> PascalTimes, CTimes;
+        int Previous = mp_set_output_fd(Null);
+        for (unsigned i = 0; i < Warmup + Reps; i++) {
+            Clock::time_point Start = Clock::now();
+            Main();
+            mp_flush();
+            double PascalTime = Since(Start);
+
+            Start = Clock::now();
+            K.RunC();
+            double CTime = Since(Start);
+
+            if (i >= Warmup) {
+                PascalTimes.push_back(PascalTime);
+                CTimes.push_back(CTime);
+            }
+        }
+        mp_set_output_fd(Previous);
+        ExitOnErr(TheJIT->removeJITDylib(JD));
+
+        Results.push_back(
+            {K.Name, Summarize(PascalTimes), Summarize(CTimes)});
+    }
+    close(Null);
+
+    std::ofstream Out(OutputFilename);
+    if (!Out) {
+        std::cerr << "mpkernels: cannot write " << OutputFilename << "\n";
+        return 1;
+    }
+    WriteResults(Out, Results, TheJIT->getTargetFingerprint());
+    WriteResults(std::cout, Results, TheJIT->getTargetFingerprint());
+    return Mismatch ? 1 : 0;
+}
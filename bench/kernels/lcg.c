@@ -0,0 +1,19 @@
+#include <stdint.h>
+
+// x = (75 * x + 74) mod 65537, with the remainder taken by subtracting 65537
+// times each power of two below 75, as micropascal has no mod
+int64_t mpk_lcg(void) {
+    int64_t x = 1, sum = 0;
+    for (int64_t i = 1; i <= 20000000; i++) {
+        x = 75 * x + 74;
+        if (4194367 < x) x = x - 4194368;
+        if (2097183 < x) x = x - 2097184;
+        if (1048591 < x) x = x - 1048592;
+        if (524295 < x) x = x - 524296;
+        if (262147 < x) x = x - 262148;
+        if (131073 < x) x = x - 131074;
+        if (65536 < x) x = x - 65537;
+        sum = sum + x;
+    }
+    return sum;
+}
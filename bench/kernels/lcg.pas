@@ -0,0 +1,19 @@
+program lcg;
+var i, x, sum : integer;
+begin
+    x := 1;
+    sum := 0;
+    for i := 1 to 20000000 do
+    begin
+        x := 75 * x + 74;
+        if 4194367 < x then x := x - 4194368;
+        if 2097183 < x then x := x - 2097184;
+        if 1048591 < x then x := x - 1048592;
+        if 524295 < x then x := x - 524296;
+        if 262147 < x then x := x - 262148;
+        if 131073 < x then x := x - 131074;
+        if 65536 < x then x := x - 65537;
+        sum := sum + x
+    end;
+    writeln(sum)
+end.
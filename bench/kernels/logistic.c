@@ -0,0 +1,10 @@
+#include <stdint.h>
+
+double mpk_logistic(void) {
+    double x = 0.5, sum = 0.0;
+    for (int64_t i = 1; i <= 20000000; i++) {
+        x = 3.7 * x * (1.0 - x);
+        sum = sum + x;
+    }
+    return sum;
+}
@@ -0,0 +1,13 @@
+program logistic;
+var i : integer;
+    x, sum : real;
+begin
+    x := 0.5;
+    sum := 0.0;
+    for i := 1 to 20000000 do
+    begin
+        x := 3.7 * x * (1.0 - x);
+        sum := sum + x
+    end;
+    writeln(sum)
+end.
@@ -0,0 +1,15 @@
+#include <stdint.h>
+
+int64_t mpk_loops(void) {
+    int64_t acc = 0;
+    for (int64_t i = 1; i <= 4000; i++) {
+        for (int64_t j = 1; j <= 4000; j++) {
+            if (j < i) {
+                acc = acc + i * j - j;
+            } else {
+                acc = acc - i;
+            }
+        }
+    }
+    return acc;
+}
@@ -0,0 +1,16 @@
+program loops;
+var i, j, acc : integer;
+begin
+    acc := 0;
+    for i := 1 to 4000 do
+    begin
+        for j := 1 to 4000 do
+        begin
+            if j < i then
+                acc := acc + i * j - j
+            else
+                acc := acc - i
+        end
+    end;
+    writeln(acc)
+end.
@@ -0,0 +1,11 @@
+#include <stdint.h>
+
+double mpk_poly(void) {
+    double sum = 0.0;
+    for (int64_t i = 1; i <= 20000000; i++) {
+        double x = i * 0.0000001;
+        double y = (((0.5 * x - 1.25) * x + 2.0) * x - 0.75) * x + 3.5;
+        sum = sum + y;
+    }
+    return sum;
+}
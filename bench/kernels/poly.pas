@@ -0,0 +1,13 @@
+program poly;
+var i : integer;
+    x, y, sum : real;
+begin
+    sum := 0.0;
+    for i := 1 to 20000000 do
+    begin
+        x := i * 0.0000001;
+        y := (((0.5 * x - 1.25) * x + 2.0) * x - 0.75) * x + 3.5;
+        sum := sum + y
+    end;
+    writeln(sum)
+end.
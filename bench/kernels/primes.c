@@ -0,0 +1,25 @@
+#include <stdint.h>
+
+// Counts the primes up to 600 by trial division, taking remainders by repeated
+// subtraction
+int64_t mpk_primes(void) {
+    int64_t count = 0;
+    for (int64_t n = 3; n <= 600; n++) {
+        int64_t composite = 0;
+        for (int64_t d = 2; d <= n - 1; d++) {
+            int64_t r = n;
+            for (int64_t k = 1; k <= n; k++) {
+                if (d - 1 < r) {
+                    r = r - d;
+                }
+            }
+            if (r < 1) {
+                composite = 1;
+            }
+        }
+        if (composite < 1) {
+            count = count + 1;
+        }
+    }
+    return count;
+}
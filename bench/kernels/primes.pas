@@ -0,0 +1,23 @@
+program primes;
+var n, d, k, r, composite, count : integer;
+begin
+    count := 0;
+    for n := 3 to 600 do
+    begin
+        composite := 0;
+        for d := 2 to n - 1 do
+        begin
+            r := n;
+            for k := 1 to n do
+            begin
+                if d - 1 < r then
+                    r := r - d
+            end;
+            if r < 1 then
+                composite := 1
+        end;
+        if composite < 1 then
+            count := count + 1
+    end;
+    writeln(count)
+end.
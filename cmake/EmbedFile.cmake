@@ -0,0 +1,9 @@
+# Writes the contents of INPUT to OUTPUT as a C array named NAME.
+#
+#   cmake -DINPUT=<file> -DOUTPUT=<file.inc> -DNAME=<identifier> \
+#         -P EmbedFile.cmake
+
+file(READ "${INPUT}" Contents HEX)
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," Contents "${Contents}")
+file(WRITE "${OUTPUT}"
+     "static const unsigned char ${NAME}[] = {${Contents}};\n")
@@ -0,0 +1,133 @@
+#include "aot/aot.h"
+
+#include <optional>
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/LegacyPassManager.h"
+#include "llvm/MC/TargetRegistry.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Program.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Target/TargetOptions.h"
+#include "llvm/TargetParser/Host.h"
+
+using namespace llvm;
+
+static cl::opt<std::string> Linker(
+    "aot-linker", cl::desc("Compiler driver used to link executables"),
+    cl::init("c++"));
+static cl::opt<std::string> RuntimeDir(
+    "runtime-dir",
+    cl::desc("Directory containing libmpruntime.a and libmpstart.a"),
+    cl::init(MICROPASCAL_RUNTIME_DIR));
+
+Expected<std::unique_ptr<TargetMachine>> CreateHostTargetMachine(
+    const std::string &CPU, const std::vector<std::string> &Features) {
+    std::string TT = sys::getDefaultTargetTriple();
+    std::string Err;
+    const Target *T = TargetRegistry::lookupTarget(TT, Err);
+    if (!T) {
+        return createStringError(inconvertibleErrorCode(), Err.c_str());
+    }
+
+    std::string CPUName = CPU.empty() ? "generic" : CPU;
+    std::vector<std::string> AllFeatures;
+    if (CPU == "native") {
+        CPUName = sys::getHostCPUName().str();
+        StringMap<bool> HostFeatures;
+        if (sys::getHostCPUFeatures(HostFeatures)) {
+            for (auto &Feature : HostFeatures) {
+                AllFeatures.push_back((Feature.second ? "+" : "-") +
+                                      Feature.first().str());
+            }
+        }
+    }
+    AllFeatures.insert(AllFeatures.end(), Features.begin(), Features.end());
+
+    TargetOptions Options;
+    return std::unique_ptr<TargetMachine>(
+        T->createTargetMachine(TT, CPUName, join(AllFeatures, ","), Options,
+                               Reloc::PIC_));
+}
+
+static Error EmitObject(Module &M, TargetMachine &TM,
+                        const std::string &Path) {
+    std::error_code EC;
+    raw_fd_ostream Dest(Path, EC, sys::fs::OF_None);
+    if (EC) {
+        return createStringError(EC, "could not open '%s'", Path.c_str());
+    }
+
+    legacy::PassManager PM;
+    if (TM.addPassesToEmitFile(PM, Dest, nullptr, CGFT_ObjectFile)) {
+        return createStringError(inconvertibleErrorCode(),
+                                 "target cannot emit object files");
+    }
+    PM.run(M);
+    Dest.flush();
+    return Error::success();
+}
+
+static Error EmitBitcode(Module &M, const std::string &Path) {
+    std::error_code EC;
+    raw_fd_ostream Dest(Path, EC, sys::fs::OF_None);
+    if (EC) {
+        return createStringError(EC, "could not open '%s'", Path.c_str());
+    }
+    WriteBitcodeToFile(M, Dest);
+    return Error::success();
+}
+
+static Error LinkExecutable(const std::string &ObjectPath,
+                            const std::string &Path) {
+    auto Driver = sys::findProgramByName(Linker);
+    if (!Driver) {
+        return createStringError(Driver.getError(), "could not find '%s'",
+                                 Linker.c_str());
+    }
+
+    std::string Start = RuntimeDir + "/libmpstart.a";
+    std::string Runtime = RuntimeDir + "/libmpruntime.a";
+    SmallVector<StringRef, 8> Args = {*Driver,  ObjectPath, Start, Runtime,
+                                      "-pthread", "-o",     Path};
+
+    std::string ErrMsg;
+    int RC = sys::ExecuteAndWait(*Driver, Args, std::nullopt, {}, 0, 0,
+                                 &ErrMsg);
+    if (RC != 0) {
+        return createStringError(inconvertibleErrorCode(),
+                                 "linking '%s' failed: %s", Path.c_str(),
+                                 ErrMsg.empty() ? "linker returned an error"
+                                                : ErrMsg.c_str());
+    }
+    return Error::success();
+}
+
+Error EmitModule(Module &M, TargetMachine &TM, EmitKind Kind,
+                 const std::string &Path) {
+    switch (Kind) {
+        case EMIT_BITCODE:
+            return EmitBitcode(M, Path);
+        case EMIT_OBJECT:
+            return EmitObject(M, TM, Path);
+        case EMIT_EXECUTABLE:
+            break;
+    }
+
+    SmallString<128> ObjectPath;
+    if (auto EC = sys::fs::createTemporaryFile("micropascal", "o",
+                                               ObjectPath)) {
+        return createStringError(EC, "could not create temporary object");
+    }
+    std::string Obj = ObjectPath.str().str();
+
+    Error Err = EmitObject(M, TM, Obj);
+    if (!Err) {
+        Err = LinkExecutable(Obj, Path);
+    }
+    sys::fs::remove(Obj);
+    return Err;
+}
@@ -0,0 +1,35 @@
+#ifndef AOT_H
+#define AOT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Target/TargetMachine.h"
+
+enum EmitKind {
+    EMIT_EXECUTABLE,
+    EMIT_OBJECT,
+    EMIT_BITCODE,
+};
+
+/**
+ * Creates a TargetMachine for the host triple, suitable for emitting objects
+ * that are linked into position-independent executables. CPU defaults to a
+ * generic one so executables stay portable; "native" selects the host CPU
+ * and its features. Features are added on top, e.g. "+avx2".
+ */
+llvm::Expected<std::unique_ptr<llvm::TargetMachine>> CreateHostTargetMachine(
+    const std::string &CPU, const std::vector<std::string> &Features);
+
+/**
+ * Writes M to Path as a native object file, a linked executable or bitcode.
+ * Executables are linked against the static runtime in libmpruntime.a and the
+ * entry point in libmpstart.a, which calls micropascal_main.
+ */
+llvm::Error EmitModule(llvm::Module &M, llvm::TargetMachine &TM,
+                       EmitKind Kind, const std::string &Path);
+
+#endif
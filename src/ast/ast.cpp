@@ -16,6 +16,11 @@ void ConcreteBoolExprAST::PrintAST(int NumIndents) {
     std::cerr << (Val ? "true" : "false") << '\n';
 }
 
+void StringExprAST::PrintAST(int NumIndents) {
+    PrintIndents(NumIndents);
+    std::cerr << "'" << Val << "'\n";
+}
+
 void VariableExprAST::PrintAST(int NumIndents) {
     PrintIndents(NumIndents);
     std::cerr << Name << '\n';
@@ -68,11 +73,25 @@ void IfStatementAST::PrintAST(int NumIndents) {
 
 void ForStatementAST::PrintAST(int NumIndents) {
     PrintIndents(NumIndents);
-    std::cerr << "For Statement\n";
+    std::cerr << (Parallel ? "Parallel For Statement\n" : "For Statement\n");
 
     PrintIndents(NumIndents + 1);
     std::cerr << "Var Name: " << VarName << "\n";
 
+    static const char *OpNames[] = {"+", "*", "min", "max"};
+    for (auto &R : Reductions) {
+        PrintIndents(NumIndents + 1);
+        std::cerr << "Reduce " << OpNames[R.Op] << ": " << R.VarName << "\n";
+    }
+    for (auto &Name : Privates) {
+        PrintIndents(NumIndents + 1);
+        std::cerr << "Private: " << Name << "\n";
+    }
+    if (MinTrips > 0) {
+        PrintIndents(NumIndents + 1);
+        std::cerr << "Min Trips: " << MinTrips << "\n";
+    }
+
     PrintIndents(NumIndents + 1);
     std::cerr << "Start:\n";
     Start->PrintAST(NumIndents + 2);
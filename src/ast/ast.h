@@ -1,19 +1,38 @@
 #ifndef AST_H
 #define AST_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 enum VarType {
     TYPE_INTEGER,
     TYPE_BOOLEAN,
+    TYPE_REAL,
+};
+
+enum ReductionOp {
+    REDUCE_ADD,
+    REDUCE_MUL,
+    REDUCE_MIN,
+    REDUCE_MAX,
+};
+
+/**
+ * A scalar that the iterations of a parallel for combine with Op
+ */
+struct Reduction {
+    ReductionOp Op;
+    std::string VarName;
 };
 
 class AST;
 class ExprAST;
 class NumberExprAST;
 class ConcreteBoolExprAST;
+class StringExprAST;
 class VariableExprAST;
 class BinaryExprAST;
 class CallExprAST;
@@ -35,6 +54,7 @@ class ASTVisitor {
     virtual void Visit(ExprAST &) {};
     virtual void Visit(NumberExprAST &) = 0;
     virtual void Visit(ConcreteBoolExprAST &) = 0;
+    virtual void Visit(StringExprAST &) = 0;
     virtual void Visit(VariableExprAST &) = 0;
     virtual void Visit(BinaryExprAST &) = 0;
     virtual void Visit(CallExprAST &) = 0;
@@ -51,6 +71,13 @@ class ASTVisitor {
     virtual void Visit(ProgramAST &) = 0;
 };
 
+/**
+ * Returns Node as a T if that is its concrete type, and nullptr otherwise.
+ * LLVM is usually built without RTTI, which rules out dynamic_cast.
+ */
+template <typename T>
+T *DynCast(AST &Node);
+
 class AST {
    public:
     virtual ~AST() = default;
@@ -66,11 +93,14 @@ class ExprAST : public AST {
 
 class NumberExprAST : public ExprAST {
     double Val;
+    bool IsReal;
 
    public:
-    NumberExprAST(double Val) : Val(Val) {}
+    NumberExprAST(double Val, bool IsReal = false)
+        : Val(Val), IsReal(IsReal) {}
     void PrintAST(int NumIndents) override;
     const double GetVal() const { return Val; }
+    const bool GetIsReal() const { return IsReal; }
     virtual void Accept(ASTVisitor &Visitor) override { Visitor.Visit(*this); }
 };
 
@@ -87,6 +117,19 @@ class ConcreteBoolExprAST : public ExprAST {
     virtual void Accept(ASTVisitor &Visitor) override { Visitor.Visit(*this); }
 };
 
+/**
+ * Only valid as an argument of write and writeln
+ */
+class StringExprAST : public ExprAST {
+    std::string Val;
+
+   public:
+    StringExprAST(const std::string &Val) : Val(Val) {}
+    void PrintAST(int NumIndents) override;
+    const std::string &GetVal() const { return Val; }
+    virtual void Accept(ASTVisitor &Visitor) override { Visitor.Visit(*this); }
+};
+
 class VariableExprAST : public ExprAST {
     std::string Name;
 
@@ -170,19 +213,44 @@ class ForStatementAST : public StatementAST {
     std::string VarName;
     std::unique_ptr<ExprAST> Start, End;
     std::unique_ptr<CompoundStatementAST> Body;
+    bool Parallel;
+    std::vector<Reduction> Reductions;
+    // Scalars each iteration writes before reading, given their own copy
+    std::vector<std::string> Privates;
+    // Fewer iterations than this run serially, 0 to always run in parallel
+    int64_t MinTrips = 0;
 
    public:
     ForStatementAST(std::string &VarName, std::unique_ptr<ExprAST> Start,
                     std::unique_ptr<ExprAST> End,
-                    std::unique_ptr<CompoundStatementAST> Body)
+                    std::unique_ptr<CompoundStatementAST> Body,
+                    bool Parallel = false,
+                    std::vector<Reduction> Reductions = {})
         : VarName(VarName),
           Start(std::move(Start)),
           End(std::move(End)),
-          Body(std::move(Body)) {}
+          Body(std::move(Body)),
+          Parallel(Parallel),
+          Reductions(std::move(Reductions)) {}
     const std::string &GetVarName() const { return VarName; }
     ExprAST &GetStart() const { return *Start; }
     ExprAST &GetEnd() const { return *End; }
     CompoundStatementAST &GetBody() const { return *Body; }
+    const bool IsParallel() const { return Parallel; }
+    const std::vector<Reduction> &GetReductions() const { return Reductions; }
+    const std::vector<std::string> &GetPrivates() const { return Privates; }
+    const int64_t GetMinTrips() const { return MinTrips; }
+    /**
+     * Makes this a parallel loop once analysis has shown its iterations to be
+     * independent
+     */
+    void Parallelize(std::vector<Reduction> Reductions,
+                     std::vector<std::string> Privates, int64_t MinTrips) {
+        Parallel = true;
+        this->Reductions = std::move(Reductions);
+        this->Privates = std::move(Privates);
+        this->MinTrips = MinTrips;
+    }
     virtual void Accept(ASTVisitor &Visitor) override { Visitor.Visit(*this); }
     void PrintAST(int NumIndents) override;
 };
@@ -306,10 +374,49 @@ class ProgramAST : public AST {
           Block(std::move(Block)) {}
     void PrintAST(int NumIndents) override;
     virtual void Accept(ASTVisitor &Visitor) override { Visitor.Visit(*this); }
+    const std::string &GetName() const { return Name; }
     const std::vector<std::unique_ptr<FunctionAST>> &GetFunctions() const {
         return Functions;
     }
     BlockAST &GetBlock() const { return *Block; }
 };
 
+template <typename T>
+class CastVisitor : public ASTVisitor {
+    template <typename U>
+    void Match(U &Node) {
+        if constexpr (std::is_same_v<T, U>) {
+            Result = &Node;
+        }
+    }
+
+   public:
+    T *Result = nullptr;
+
+    virtual void Visit(NumberExprAST &N) override { Match(N); }
+    virtual void Visit(ConcreteBoolExprAST &N) override { Match(N); }
+    virtual void Visit(StringExprAST &N) override { Match(N); }
+    virtual void Visit(VariableExprAST &N) override { Match(N); }
+    virtual void Visit(BinaryExprAST &N) override { Match(N); }
+    virtual void Visit(CallExprAST &N) override { Match(N); }
+    virtual void Visit(StatementCallExprAST &N) override { Match(N); }
+    virtual void Visit(IfStatementAST &N) override { Match(N); }
+    virtual void Visit(ForStatementAST &N) override { Match(N); }
+    virtual void Visit(VariableAssignmentAST &N) override { Match(N); }
+    virtual void Visit(VariableDeclAST &N) override { Match(N); }
+    virtual void Visit(PrototypeAST &N) override { Match(N); }
+    virtual void Visit(DeclarationAST &N) override { Match(N); }
+    virtual void Visit(CompoundStatementAST &N) override { Match(N); }
+    virtual void Visit(BlockAST &N) override { Match(N); }
+    virtual void Visit(FunctionAST &N) override { Match(N); }
+    virtual void Visit(ProgramAST &N) override { Match(N); }
+};
+
+template <typename T>
+T *DynCast(AST &Node) {
+    CastVisitor<T> Cast;
+    Node.Accept(Cast);
+    return Cast.Result;
+}
+
 #endif
@@ -0,0 +1,404 @@
+#include "autopar/autopar.h"
+
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+
+namespace {
+
+// Visits every node below the one it is handed. Analyses override the nodes
+// they are interested in and call back into the walker to keep descending.
+class Walker : public ASTVisitor {
+   public:
+    virtual void Visit(NumberExprAST &) override {}
+    virtual void Visit(ConcreteBoolExprAST &) override {}
+    virtual void Visit(StringExprAST &) override {}
+    virtual void Visit(VariableExprAST &) override {}
+    virtual void Visit(BinaryExprAST &E) override {
+        E.GetLeft().Accept(*this);
+        E.GetRight().Accept(*this);
+    }
+    virtual void Visit(CallExprAST &E) override {
+        for (auto &Arg : E.GetArgs()) {
+            Arg->Accept(*this);
+        }
+    }
+    virtual void Visit(StatementCallExprAST &E) override {
+        for (auto &Arg : E.GetArgs()) {
+            Arg->Accept(*this);
+        }
+    }
+    virtual void Visit(IfStatementAST &S) override {
+        S.GetCond().Accept(*this);
+        S.GetThen().Accept(*this);
+        if (S.HasElse()) {
+            S.GetElse().Accept(*this);
+        }
+    }
+    virtual void Visit(ForStatementAST &S) override {
+        S.GetStart().Accept(*this);
+        S.GetEnd().Accept(*this);
+        S.GetBody().Accept(*this);
+    }
+    virtual void Visit(VariableAssignmentAST &S) override {
+        S.GetValue().Accept(*this);
+    }
+    virtual void Visit(VariableDeclAST &) override {}
+    virtual void Visit(PrototypeAST &) override {}
+    virtual void Visit(DeclarationAST &) override {}
+    virtual void Visit(CompoundStatementAST &S) override {
+        for (auto &Statement : S.GetStatements()) {
+            Statement->Accept(*this);
+        }
+    }
+    virtual void Visit(BlockAST &B) override {
+        B.GetCompoundStatementAST().Accept(*this);
+    }
+    virtual void Visit(FunctionAST &F) override { F.GetBody().Accept(*this); }
+    virtual void Visit(ProgramAST &P) override {
+        for (auto &F : P.GetFunctions()) {
+            F->Accept(*this);
+        }
+        P.GetBlock().Accept(*this);
+    }
+};
+
+// Counts the reads and assignments of each variable by name
+class ReferenceCounter : public Walker {
+   public:
+    using Walker::Visit;
+
+    std::map<std::string, unsigned> Count;
+
+    virtual void Visit(VariableExprAST &E) override { Count[E.GetName()]++; }
+    virtual void Visit(VariableAssignmentAST &S) override {
+        Count[S.GetVarName()]++;
+        S.GetValue().Accept(*this);
+    }
+};
+
+class CallCollector : public Walker {
+   public:
+    using Walker::Visit;
+
+    std::set<std::string> Callees;
+
+    virtual void Visit(CallExprAST &E) override {
+        Callees.insert(E.GetCallee());
+        Walker::Visit(E);
+    }
+    virtual void Visit(StatementCallExprAST &E) override {
+        Callees.insert(E.GetCallee());
+        Walker::Visit(E);
+    }
+};
+
+// What one iteration of a loop body does to the variables it shares with the
+// rest of the procedure
+class BodyAnalysis : public Walker {
+    // Loop variables of nested loops. Those loops give their variable its
+    // own storage, so the names refer to nothing shared while they run.
+    std::multiset<std::string> Shadowed;
+    // Variables assigned on every path through the iteration so far
+    std::set<std::string> Assigned;
+
+   public:
+    using Walker::Visit;
+
+    std::map<std::string, unsigned> Reads;
+    std::set<std::string> ReadBeforeWrite;
+    std::map<std::string, std::vector<VariableAssignmentAST *>> Writes;
+    std::set<std::string> Callees;
+    bool HasParallelLoop = false;
+
+    virtual void Visit(VariableExprAST &E) override {
+        if (Shadowed.count(E.GetName())) {
+            return;
+        }
+        Reads[E.GetName()]++;
+        if (!Assigned.count(E.GetName())) {
+            ReadBeforeWrite.insert(E.GetName());
+        }
+    }
+
+    virtual void Visit(VariableAssignmentAST &S) override {
+        S.GetValue().Accept(*this);
+        if (Shadowed.count(S.GetVarName())) {
+            return;
+        }
+        Writes[S.GetVarName()].push_back(&S);
+        Assigned.insert(S.GetVarName());
+    }
+
+    virtual void Visit(IfStatementAST &S) override {
+        S.GetCond().Accept(*this);
+        std::set<std::string> Before = Assigned;
+        S.GetThen().Accept(*this);
+        std::set<std::string> AfterThen = std::move(Assigned);
+        Assigned = std::move(Before);
+        if (S.HasElse()) {
+            S.GetElse().Accept(*this);
+        }
+
+        std::set<std::string> OnBothPaths;
+        for (auto &Name : Assigned) {
+            if (AfterThen.count(Name)) {
+                OnBothPaths.insert(Name);
+            }
+        }
+        Assigned = std::move(OnBothPaths);
+    }
+
+    virtual void Visit(ForStatementAST &S) override {
+        HasParallelLoop |= S.IsParallel();
+
+        // Start is evaluated before the loop variable is shadowed, End after
+        // every iteration
+        S.GetStart().Accept(*this);
+        std::set<std::string> Before = Assigned;
+        auto It = Shadowed.insert(S.GetVarName());
+        S.GetBody().Accept(*this);
+        S.GetEnd().Accept(*this);
+        Shadowed.erase(It);
+        Assigned = std::move(Before);
+    }
+
+    virtual void Visit(CallExprAST &E) override {
+        Callees.insert(E.GetCallee());
+        Walker::Visit(E);
+    }
+    virtual void Visit(StatementCallExprAST &E) override {
+        Callees.insert(E.GetCallee());
+        Walker::Visit(E);
+    }
+};
+
+// Matches Name when every assignment to it has the form Name := Name + e or
+// Name := e + Name, with e not reading Name, or the same with *
+std::optional<ReductionOp> MatchReduction(const std::string &Name,
+                                          const BodyAnalysis &A) {
+    auto IsName = [&](ExprAST &E) {
+        auto *Var = DynCast<VariableExprAST>(E);
+        return Var && Var->GetName() == Name;
+    };
+
+    const std::vector<VariableAssignmentAST *> &Writes = A.Writes.at(Name);
+    char Op = 0;
+    for (VariableAssignmentAST *S : Writes) {
+        auto *B = DynCast<BinaryExprAST>(S->GetValue());
+        if (!B || (B->GetOp() != '+' && B->GetOp() != '*') ||
+            (Op && B->GetOp() != Op)) {
+            return std::nullopt;
+        }
+        if (!IsName(B->GetLeft()) && !IsName(B->GetRight())) {
+            return std::nullopt;
+        }
+        Op = B->GetOp();
+    }
+
+    // Any other read would see a partial result
+    if (A.Reads.at(Name) != Writes.size()) {
+        return std::nullopt;
+    }
+    return Op == '+' ? REDUCE_ADD : REDUCE_MUL;
+}
+
+// Procedures take their arguments by value and cannot see the variables of
+// their caller, so one that produces no output, directly or through its
+// callees, has no effect on the rest of the program
+std::set<std::string> SideEffectFree(ProgramAST &P) {
+    std::map<std::string, std::set<std::string>> Callees;
+    for (auto &F : P.GetFunctions()) {
+        CallCollector C;
+        F->Accept(C);
+        Callees[F->GetPrototype().GetName()] = std::move(C.Callees);
+    }
+
+    // write, writeln and procedures defined by earlier programs are never in
+    // the set, so anything that calls them drops out
+    std::set<std::string> Pure;
+    for (auto &[Name, Calls] : Callees) {
+        Pure.insert(Name);
+    }
+    bool Changed = true;
+    while (Changed) {
+        Changed = false;
+        for (auto &[Name, Calls] : Callees) {
+            if (!Pure.count(Name)) {
+                continue;
+            }
+            for (auto &Callee : Calls) {
+                if (!Pure.count(Callee)) {
+                    Pure.erase(Name);
+                    Changed = true;
+                    break;
+                }
+            }
+        }
+    }
+    return Pure;
+}
+
+class LoopParallelizer : public Walker {
+    const std::string &ProcName;
+    const std::map<std::string, VarType> &Types;
+    const std::map<std::string, unsigned> &ProcReferences;
+    const std::set<std::string> &Pure;
+    int64_t MinTrips;
+
+    // Returns why S cannot run in parallel, or parallelizes it and returns
+    // an empty string
+    std::string TryParallelize(ForStatementAST &S) {
+        BodyAnalysis A;
+        S.GetBody().Accept(A);
+
+        if (A.HasParallelLoop) {
+            return "it contains a parallel loop";
+        }
+        for (auto &Callee : A.Callees) {
+            if (Callee == "write" || Callee == "writeln") {
+                return "it writes output, which must stay in order";
+            }
+            if (!Pure.count(Callee)) {
+                return "it calls " + Callee + ", which may write output";
+            }
+        }
+        if (A.Writes.count(S.GetVarName())) {
+            return "it assigns the loop variable";
+        }
+
+        // The sequential loop evaluates End after every iteration
+        ReferenceCounter EndReads;
+        S.GetEnd().Accept(EndReads);
+        for (auto &[Name, Count] : EndReads.Count) {
+            if (A.Writes.count(Name)) {
+                return "its bound reads " + Name + ", which it assigns";
+            }
+        }
+
+        ReferenceCounter BodyReferences;
+        S.GetBody().Accept(BodyReferences);
+
+        std::vector<Reduction> Reductions;
+        std::vector<std::string> Privates;
+        for (auto &[Name, Writes] : A.Writes) {
+            auto Type = Types.find(Name);
+            if (Type == Types.end()) {
+                return Name + " is not declared";
+            }
+
+            if (auto Op = MatchReduction(Name, A)) {
+                if (Type->second == TYPE_REAL) {
+                    return "reducing " + Name +
+                           " in parallel would reorder floating point "
+                           "arithmetic";
+                }
+                if (Type->second == TYPE_INTEGER) {
+                    Reductions.push_back({*Op, Name});
+                    continue;
+                }
+            }
+
+            if (A.ReadBeforeWrite.count(Name)) {
+                return Name + " carries a value from one iteration to the "
+                              "next";
+            }
+            // Every iteration would leave its own value behind
+            if (ProcReferences.at(Name) > BodyReferences.Count[Name]) {
+                return Name + " is used outside of the loop";
+            }
+            Privates.push_back(Name);
+        }
+
+        auto *Start = DynCast<NumberExprAST>(S.GetStart());
+        auto *End = DynCast<NumberExprAST>(S.GetEnd());
+        if (Start && End && !Start->GetIsReal() && !End->GetIsReal()) {
+            int64_t Trips =
+                int64_t(End->GetVal()) - int64_t(Start->GetVal()) + 1;
+            if (Trips < MinTrips) {
+                return "it runs " + std::to_string(Trips) +
+                       " iterations, below --auto-parallel-min-trips";
+            }
+        }
+
+        std::cerr << "auto-parallel: " << ProcName << ": loop over "
+                  << S.GetVarName() << " parallelized";
+        for (auto &R : Reductions) {
+            std::cerr << (R.Op == REDUCE_ADD ? ", sum " : ", product ")
+                      << R.VarName;
+        }
+        for (auto &Name : Privates) {
+            std::cerr << ", private " << Name;
+        }
+        std::cerr << "\n";
+
+        S.Parallelize(std::move(Reductions), std::move(Privates), MinTrips);
+        return "";
+    }
+
+   public:
+    using Walker::Visit;
+
+    LoopParallelizer(const std::string &ProcName,
+                     const std::map<std::string, VarType> &Types,
+                     const std::map<std::string, unsigned> &ProcReferences,
+                     const std::set<std::string> &Pure, int64_t MinTrips)
+        : ProcName(ProcName),
+          Types(Types),
+          ProcReferences(ProcReferences),
+          Pure(Pure),
+          MinTrips(MinTrips) {}
+
+    // Parallelizes the outermost loops it can, and looks for candidates
+    // inside the ones it cannot
+    virtual void Visit(ForStatementAST &S) override {
+        if (S.IsParallel()) {
+            return;
+        }
+
+        std::string Reason = TryParallelize(S);
+        if (Reason.empty()) {
+            return;
+        }
+        std::cerr << "auto-parallel: " << ProcName << ": loop over "
+                  << S.GetVarName() << " not parallelized, " << Reason << "\n";
+        S.GetBody().Accept(*this);
+    }
+};
+
+void AddDeclarations(const std::vector<std::unique_ptr<VariableDeclAST>> &Decls,
+                     std::map<std::string, VarType> &Types) {
+    for (auto &Decl : Decls) {
+        for (auto &Name : Decl->GetVarNames()) {
+            Types[Name] = Decl->GetType();
+        }
+    }
+}
+
+void ParallelizeBlock(const std::string &ProcName, BlockAST &Block,
+                      std::map<std::string, VarType> Types,
+                      const std::set<std::string> &Pure, int64_t MinTrips) {
+    AddDeclarations(Block.GetDeclaration().GetVarDeclarations(), Types);
+
+    ReferenceCounter ProcReferences;
+    Block.Accept(ProcReferences);
+
+    LoopParallelizer LP(ProcName, Types, ProcReferences.Count, Pure, MinTrips);
+    Block.Accept(LP);
+}
+
+}  // namespace
+
+void AutoParallelize(ProgramAST &P, int64_t MinTrips) {
+    std::set<std::string> Pure = SideEffectFree(P);
+
+    for (auto &F : P.GetFunctions()) {
+        PrototypeAST &Proto = F->GetPrototype();
+        std::map<std::string, VarType> Types;
+        AddDeclarations(Proto.GetParameters(), Types);
+        ParallelizeBlock(Proto.GetName(), F->GetBody(), std::move(Types), Pure,
+                         MinTrips);
+    }
+    ParallelizeBlock(P.GetName(), P.GetBlock(), {}, Pure, MinTrips);
+}
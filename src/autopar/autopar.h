@@ -0,0 +1,22 @@
+#ifndef AUTOPAR_H
+#define AUTOPAR_H
+
+#include <cstdint>
+
+#include "ast/ast.h"
+
+/**
+ * Turns the for loops of P whose iterations are independent into parallel
+ * loops, and reports on stderr which loops were parallelized and why the
+ * others were not.
+ *
+ * A loop qualifies when its body calls nothing that produces output, does
+ * not assign the loop variable or anything its bound reads, and every scalar
+ * it assigns is either an integer sum or product, which becomes a reduction,
+ * or a temporary that is written before it is read and not used outside the
+ * loop, which becomes private. Loops with fewer than MinTrips iterations run
+ * serially.
+ */
+void AutoParallelize(ProgramAST &P, int64_t MinTrips);
+
+#endif
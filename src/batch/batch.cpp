@@ -0,0 +1,86 @@
+#include "batch/batch.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "lexer/lexer.h"
+#include "llvm/Support/ThreadPool.h"
+#include "logger/logger.h"
+#include "runner/runner.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct FileResult {
+    bool Opened = false;
+    unsigned Errors = 0;
+    PhaseTimings Timings;
+};
+
+static double Since(Clock::time_point Start) {
+    return std::chrono::duration<double>(Clock::now() - Start).count();
+}
+
+static FileResult ProcessFile(const std::string &Path, BatchHandler &Handle) {
+    FileResult Result;
+    std::FILE *In = std::fopen(Path.c_str(), "r");
+    if (!In) {
+        return Result;
+    }
+    Result.Opened = true;
+
+    unsigned ErrorsBefore = GetThreadErrorCount();
+    OutputCapture Capture;
+    Result.Timings = Handle(In);
+    Capture.Release();
+
+    SetLexerInput(stdin);
+    std::fclose(In);
+    Result.Errors = GetThreadErrorCount() - ErrorsBefore;
+    return Result;
+}
+
+unsigned RunBatch(const std::vector<std::string> &Files, unsigned Jobs,
+                  BatchHandler Handle) {
+    Clock::time_point Start = Clock::now();
+    std::vector<FileResult> Results(Files.size());
+    {
+        llvm::ThreadPool Pool(llvm::hardware_concurrency(Jobs));
+        for (size_t i = 0; i < Files.size(); i++) {
+            Pool.async(
+                [&, i]() { Results[i] = ProcessFile(Files[i], Handle); });
+        }
+        Pool.wait();
+    }
+    double Wall = Since(Start);
+
+    unsigned Failed = 0;
+    PhaseTimings Total;
+    fprintf(stderr, "\n");
+    for (size_t i = 0; i < Files.size(); i++) {
+        const FileResult &R = Results[i];
+        if (!R.Opened) {
+            fprintf(stderr, "FAIL %s: cannot open file\n", Files[i].c_str());
+            Failed++;
+            continue;
+        }
+
+        bool Ok = R.Errors == 0;
+        Failed += !Ok;
+        fprintf(stderr,
+                "%s %s: %u errors, parse %.3fs, codegen %.3fs, link %.3fs, "
+                "execute %.3fs\n",
+                Ok ? "ok  " : "FAIL", Files[i].c_str(), R.Errors,
+                R.Timings.Parse, R.Timings.Codegen, R.Timings.Link,
+                R.Timings.Execute);
+        Total.Parse += R.Timings.Parse;
+        Total.Codegen += R.Timings.Codegen;
+        Total.Link += R.Timings.Link;
+        Total.Execute += R.Timings.Execute;
+    }
+    fprintf(stderr,
+            "%zu files, %u failed in %.3fs (parse %.3fs, codegen %.3fs, link "
+            "%.3fs, execute %.3fs across threads)\n",
+            Files.size(), Failed, Wall, Total.Parse, Total.Codegen,
+            Total.Link, Total.Execute);
+    return Failed;
+}
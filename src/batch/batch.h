@@ -0,0 +1,26 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "codegen/codegen.h"
+
+/**
+ * Compiles or runs every program in Source and returns the time spent on
+ * them. Runs on the thread that opened Source, whose lexer reads from it.
+ */
+typedef std::function<PhaseTimings(std::FILE *Source)> BatchHandler;
+
+/**
+ * Processes Files on Jobs threads (0: one per core), passing each opened
+ * file to Handle. The output of a file's programs is written out in one
+ * piece once the file is done. Prints the result and timings of every file
+ * to stderr and returns the number of files that failed.
+ */
+unsigned RunBatch(const std::vector<std::string> &Files, unsigned Jobs,
+                  BatchHandler Handle);
+
+#endif
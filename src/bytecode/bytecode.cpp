@@ -0,0 +1,948 @@
+#include "bytecode/bytecode.h"
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <optional>
+
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+#include "logger/logger.h"
+
+using namespace llvm;
+
+namespace {
+
+enum OperandKind { OPERAND_R, OPERAND_N, OPERAND_T, OPERAND_F, OPERAND_S };
+
+struct OpInfo {
+    const char *Name;
+    OperandKind A, B, C;
+};
+
+const OpInfo OpInfos[] = {
+#define X(Name, A, B, C) \
+    {#Name, OPERAND_##A, OPERAND_##B, OPERAND_##C},
+    BYTECODE_OPCODES(X)
+#undef X
+};
+
+// Registers and wide operands
+constexpr uint32_t MaxRegisters = 0xFFFF;
+constexpr uint32_t MaxWide = 0xFFFFFF;
+// Constants are numbered from here until the function is done and they are
+// moved to after its other registers
+constexpr uint32_t ConstantTag = 0x8000;
+
+BytecodeSlot IntSlot(int64_t I) {
+    BytecodeSlot S;
+    S.I = I;
+    return S;
+}
+
+BytecodeSlot RealSlot(double D) {
+    BytecodeSlot S;
+    S.D = D;
+    return S;
+}
+
+// Integer arithmetic wraps here where compiled code's would be undefined
+int64_t Wrap(uint64_t V) { return static_cast<int64_t>(V); }
+
+class BytecodeGen : public ASTVisitor {
+    struct Variable {
+        uint16_t Reg;
+        VarType Type;
+    };
+
+    struct Value {
+        uint16_t Reg;
+        VarType Type;
+    };
+
+    BytecodeProgram &Program;
+    // Parameter types of the procedures compiled so far, which are all a
+    // procedure may call
+    std::map<std::string, std::vector<VarType>> Procedures;
+    std::map<std::string, uint32_t> StringIndex;
+
+    BytecodeFunction *Fn = nullptr;
+    std::map<std::string, Variable> NamedValues;
+    std::map<uint64_t, uint16_t> ConstantIndex;
+    std::vector<BytecodeSlot> Constants;
+    // Registers from NextReg on are free. Statements free the temporaries
+    // they use by putting it back.
+    uint32_t NextReg = 0;
+    uint32_t NumRegs = 0;
+
+    // Where the expression being compiled may put its result if it has this
+    // type, instead of a new temporary
+    std::optional<Value> Hint;
+    std::optional<Value> V;
+
+   public:
+    bool Failed = false;
+
+    BytecodeGen(BytecodeProgram &Program) : Program(Program) {}
+
+   private:
+    void Fail(const char *Message) {
+        LogError(Message);
+        Failed = true;
+        V.reset();
+    }
+
+    uint16_t NewRegister() {
+        if (NextReg >= ConstantTag) {
+            Fail("Too many registers in bytecode procedure");
+            return 0;
+        }
+        NumRegs = std::max(NumRegs, NextReg + 1);
+        return NextReg++;
+    }
+
+    uint16_t Constant(BytecodeSlot Val) {
+        uint64_t Bits;
+        std::memcpy(&Bits, &Val, sizeof(Bits));
+        auto [It, Inserted] = ConstantIndex.emplace(Bits, Constants.size());
+        if (Inserted) {
+            if (Constants.size() >= ConstantTag) {
+                Fail("Too many constants in bytecode procedure");
+                return 0;
+            }
+            Constants.push_back(Val);
+        }
+        return ConstantTag | It->second;
+    }
+
+    size_t Emit(BytecodeOp Op, uint16_t A = 0, uint16_t B = 0,
+                uint32_t Wide = 0) {
+        Fn->Code.push_back({Op, uint8_t(Wide >> 16), A, B, uint16_t(Wide)});
+        return Fn->Code.size() - 1;
+    }
+
+    // Points the jump at Index to the next instruction
+    void Patch(size_t Index) { SetTarget(Index, Fn->Code.size()); }
+
+    void SetTarget(size_t Index, size_t Target) {
+        if (Target > MaxWide) {
+            Fail("Bytecode procedure is too long");
+            return;
+        }
+        Fn->Code[Index].X = uint8_t(Target >> 16);
+        Fn->Code[Index].C = uint16_t(Target);
+    }
+
+    uint32_t AddString(const std::string &Str) {
+        auto [It, Inserted] =
+            StringIndex.emplace(Str, Program.Strings.size());
+        if (Inserted) {
+            Program.Strings.push_back(Str);
+        }
+        return It->second;
+    }
+
+    // Converts Val for a destination of type To, as codegen does
+    std::optional<Value> Convert(Value Val, VarType To) {
+        if (To == TYPE_REAL) {
+            if (Val.Type == TYPE_BOOLEAN) {
+                Fail("Cannot convert a boolean to a real");
+                return std::nullopt;
+            }
+            if (Val.Type == TYPE_INTEGER) {
+                if (Val.Reg & ConstantTag) {
+                    int64_t I = Constants[Val.Reg & ~ConstantTag].I;
+                    return Value{Constant(RealSlot(double(I))), TYPE_REAL};
+                }
+                uint16_t Reg = NewRegister();
+                Emit(BC_ITOF, Reg, Val.Reg);
+                return Value{Reg, TYPE_REAL};
+            }
+            return Val;
+        }
+        if (Val.Type == TYPE_REAL) {
+            Fail("Cannot convert a real to an integer or boolean");
+            return std::nullopt;
+        }
+        return Val;
+    }
+
+    std::optional<Value> Compile(ExprAST &E,
+                                 std::optional<Value> Dest = std::nullopt) {
+        Hint = Dest;
+        V.reset();
+        E.Accept(*this);
+        Hint.reset();
+        return Failed ? std::nullopt : V;
+    }
+
+    // The operands of a comparison, both reals if either is
+    bool CompileComparison(BinaryExprAST &E, Value &L, Value &R) {
+        std::optional<Value> LV = Compile(E.GetLeft());
+        std::optional<Value> RV = LV ? Compile(E.GetRight()) : std::nullopt;
+        if (!RV) {
+            return false;
+        }
+        if (LV->Type == TYPE_REAL || RV->Type == TYPE_REAL) {
+            LV = Convert(*LV, TYPE_REAL);
+            RV = LV ? Convert(*RV, TYPE_REAL) : std::nullopt;
+            if (!RV) {
+                return false;
+            }
+        }
+        L = *LV;
+        R = *RV;
+        return true;
+    }
+
+    void Call(const std::string &Callee,
+              const std::vector<std::unique_ptr<ExprAST>> &Args) {
+        auto It = Procedures.find(Callee);
+        if (It == Procedures.end()) {
+            Fail("Could not find function");
+            return;
+        }
+        const std::vector<VarType> &Params = It->second;
+        if (Params.size() != Args.size()) {
+            Fail("Incorrect # of arguments");
+            return;
+        }
+
+        // Arguments go in consecutive registers
+        uint32_t First = NextReg;
+        for (size_t i = 0; i < Args.size(); i++) {
+            NewRegister();
+        }
+        for (size_t i = 0; i < Args.size(); i++) {
+            VarType ParamType =
+                Params[i] == TYPE_REAL ? TYPE_REAL : TYPE_INTEGER;
+            uint16_t Reg = First + i;
+            std::optional<Value> Arg = Compile(*Args[i], Value{Reg, ParamType});
+            Arg = Arg ? Convert(*Arg, ParamType) : std::nullopt;
+            if (!Arg) {
+                LogError("Error occurred while codegen function args");
+                return;
+            }
+            if (Arg->Reg != Reg) {
+                Emit(BC_MOV, Reg, Arg->Reg);
+            }
+        }
+
+        if (Program.CallSites.size() > MaxWide) {
+            Fail("Too many calls in bytecode program");
+            return;
+        }
+        Emit(BC_CALL, First, 0, Program.CallSites.size());
+        Program.CallSites.push_back({Callee, uint32_t(Args.size())});
+    }
+
+    void Write(const std::vector<std::unique_ptr<ExprAST>> &Args,
+               bool NewLine) {
+        for (auto &Arg : Args) {
+            if (auto *Str = DynCast<StringExprAST>(*Arg)) {
+                Emit(BC_WRITES, 0, 0, AddString(Str->GetVal()));
+                continue;
+            }
+            std::optional<Value> Val = Compile(*Arg);
+            if (!Val) {
+                LogError("Error occurred while codegen write args");
+                return;
+            }
+            switch (Val->Type) {
+                case TYPE_INTEGER:
+                    Emit(BC_WRITEI, Val->Reg);
+                    break;
+                case TYPE_BOOLEAN:
+                    Emit(BC_WRITEB, Val->Reg);
+                    break;
+                case TYPE_REAL:
+                    Emit(BC_WRITEF, Val->Reg);
+                    break;
+            }
+        }
+        if (NewLine) {
+            Emit(BC_NEWLINE);
+        }
+    }
+
+    uint16_t Declare(const std::string &Name, VarType Type) {
+        uint16_t Reg = NewRegister();
+        NamedValues[Name] = {Reg, Type};
+        return Reg;
+    }
+
+    BytecodeSlot ReductionIdentity(ReductionOp Op, VarType T) {
+        if (T == TYPE_REAL) {
+            switch (Op) {
+                case REDUCE_ADD:
+                    return RealSlot(0.0);
+                case REDUCE_MUL:
+                    return RealSlot(1.0);
+                case REDUCE_MIN:
+                    return RealSlot(INFINITY);
+                case REDUCE_MAX:
+                    return RealSlot(-INFINITY);
+            }
+        }
+        switch (Op) {
+            case REDUCE_ADD:
+                return IntSlot(0);
+            case REDUCE_MUL:
+                return IntSlot(1);
+            case REDUCE_MIN:
+                return IntSlot(INT64_MAX);
+            case REDUCE_MAX:
+                return IntSlot(INT64_MIN);
+        }
+        return IntSlot(0);
+    }
+
+    BytecodeOp CombineOp(ReductionOp Op, VarType T) {
+        bool Real = T == TYPE_REAL;
+        switch (Op) {
+            case REDUCE_ADD:
+                return Real ? BC_ADDF : BC_ADDI;
+            case REDUCE_MUL:
+                return Real ? BC_MULF : BC_MULI;
+            case REDUCE_MIN:
+                return Real ? BC_MINF : BC_MINI;
+            case REDUCE_MAX:
+                return Real ? BC_MAXF : BC_MAXI;
+        }
+        return BC_ADDI;
+    }
+
+    // Runs the loop on the calling thread, as one chunk of iterations with
+    // the private and reduction variables a chunk of compiled code gets
+    void CompileParallelFor(ForStatementAST &S) {
+        // The bounds are evaluated once up front
+        std::optional<Value> Start = Compile(S.GetStart());
+        Start = Start ? Convert(*Start, TYPE_INTEGER) : std::nullopt;
+        if (!Start) {
+            LogError("Failed to codegen start");
+            return;
+        }
+        uint16_t Lo = NewRegister();
+        Emit(BC_MOV, Lo, Start->Reg);
+        std::optional<Value> End = Compile(S.GetEnd());
+        End = End ? Convert(*End, TYPE_INTEGER) : std::nullopt;
+        if (!End) {
+            LogError("Failed to codegen end");
+            return;
+        }
+        uint16_t Last = NewRegister();
+        Emit(BC_MOV, Last, End->Reg);
+
+        std::vector<Variable> Shared;
+        for (auto &R : S.GetReductions()) {
+            auto It = NamedValues.find(R.VarName);
+            if (It == NamedValues.end()) {
+                Fail("Unknown reduction variable");
+                return;
+            }
+            if (It->second.Type == TYPE_BOOLEAN) {
+                Fail("Reduction variables must be integers or reals");
+                return;
+            }
+            Shared.push_back(It->second);
+        }
+
+        // Like the sequential loop, the loop runs at least once
+        Emit(BC_MAXI, Last, Lo, Last);
+        uint16_t Hi = NewRegister();
+        Emit(BC_ADDI, Hi, Last, Constant(IntSlot(1)));
+
+        std::map<std::string, Variable> SavedValues = NamedValues;
+        for (size_t i = 0; i < Shared.size(); i++) {
+            const Reduction &R = S.GetReductions()[i];
+            uint16_t Reg = Declare(R.VarName, Shared[i].Type);
+            Emit(BC_MOV, Reg,
+                 Constant(ReductionIdentity(R.Op, Shared[i].Type)));
+        }
+        for (auto &Name : S.GetPrivates()) {
+            auto It = NamedValues.find(Name);
+            if (It != NamedValues.end()) {
+                uint16_t Reg = Declare(Name, It->second.Type);
+                Emit(BC_MOV, Reg, Constant(IntSlot(0)));
+            }
+        }
+
+        // Iterations [Lo, Hi)
+        uint16_t Var = Declare(S.GetVarName(), TYPE_INTEGER);
+        Emit(BC_MOV, Var, Lo);
+        size_t Empty = Emit(BC_JNLTI, Var, Hi);
+        size_t Top = Fn->Code.size();
+        S.GetBody().Accept(*this);
+        if (Failed) {
+            LogError("Error generating body code in parallel for loop");
+            return;
+        }
+        SetTarget(Emit(BC_FORLOOP, Var, Last), Top);
+        Patch(Empty);
+
+        for (size_t i = 0; i < Shared.size(); i++) {
+            const Reduction &R = S.GetReductions()[i];
+            Emit(CombineOp(R.Op, Shared[i].Type), Shared[i].Reg, Shared[i].Reg,
+                 NamedValues[R.VarName].Reg);
+        }
+        NamedValues = std::move(SavedValues);
+    }
+
+    // The procedure's constants go after its other registers
+    void FinishFunction() {
+        uint32_t Base = NumRegs;
+        if (Base + Constants.size() > MaxRegisters) {
+            Fail("Too many registers in bytecode procedure");
+            return;
+        }
+        for (BytecodeInstr &I : Fn->Code) {
+            const OpInfo &Info = OpInfos[I.Op];
+            if (Info.A == OPERAND_R && (I.A & ConstantTag)) {
+                I.A = Base + (I.A & ~ConstantTag);
+            }
+            if (Info.B == OPERAND_R && (I.B & ConstantTag)) {
+                I.B = Base + (I.B & ~ConstantTag);
+            }
+            if (Info.C == OPERAND_R && (I.C & ConstantTag)) {
+                I.C = Base + (I.C & ~ConstantTag);
+            }
+        }
+        Fn->Frame.assign(Base, IntSlot(0));
+        Fn->Frame.insert(Fn->Frame.end(), Constants.begin(), Constants.end());
+    }
+
+    void StartFunction(const std::string &Name) {
+        Program.Functions.emplace_back();
+        Fn = &Program.Functions.back();
+        Fn->Name = Name;
+        NamedValues.clear();
+        ConstantIndex.clear();
+        Constants.clear();
+        NextReg = 0;
+        NumRegs = 0;
+    }
+
+   public:
+    virtual void Visit(NumberExprAST &E) override {
+        if (E.GetIsReal()) {
+            V = Value{Constant(RealSlot(E.GetVal())), TYPE_REAL};
+            return;
+        }
+        V = Value{Constant(IntSlot(Wrap(static_cast<uint64_t>(E.GetVal())))),
+                  TYPE_INTEGER};
+    }
+
+    virtual void Visit(ConcreteBoolExprAST &E) override {
+        V = Value{Constant(IntSlot(E.GetVal())), TYPE_BOOLEAN};
+    }
+
+    virtual void Visit(StringExprAST &E) override {
+        Fail("Strings can only be passed to write and writeln");
+    }
+
+    virtual void Visit(VariableExprAST &E) override {
+        auto It = NamedValues.find(E.GetName());
+        if (It == NamedValues.end()) {
+            Fail("Unknown variable");
+            return;
+        }
+        V = Value{It->second.Reg, It->second.Type};
+    }
+
+    virtual void Visit(BinaryExprAST &E) override {
+        std::optional<Value> Dest = Hint;
+        Hint.reset();
+
+        if (E.GetOp() == '<') {
+            Value L, R;
+            if (!CompileComparison(E, L, R)) {
+                return;
+            }
+            uint16_t Reg = Dest && Dest->Type == TYPE_BOOLEAN ? Dest->Reg
+                                                              : NewRegister();
+            Emit(L.Type == TYPE_REAL ? BC_LTF : BC_LTI, Reg, L.Reg, R.Reg);
+            V = Value{Reg, TYPE_BOOLEAN};
+            return;
+        }
+
+        std::optional<Value> L = Compile(E.GetLeft());
+        std::optional<Value> R = L ? Compile(E.GetRight()) : std::nullopt;
+        if (!R) {
+            LogError("L or R was null in visit");
+            return;
+        }
+        VarType Type = L->Type == TYPE_REAL || R->Type == TYPE_REAL
+                           ? TYPE_REAL
+                           : TYPE_INTEGER;
+        if (Type == TYPE_REAL) {
+            L = Convert(*L, TYPE_REAL);
+            R = L ? Convert(*R, TYPE_REAL) : std::nullopt;
+            if (!R) {
+                return;
+            }
+        }
+
+        BytecodeOp Op;
+        switch (E.GetOp()) {
+            case '+':
+                Op = Type == TYPE_REAL ? BC_ADDF : BC_ADDI;
+                break;
+            case '-':
+                Op = Type == TYPE_REAL ? BC_SUBF : BC_SUBI;
+                break;
+            case '*':
+                Op = Type == TYPE_REAL ? BC_MULF : BC_MULI;
+                break;
+            case '/':
+                Op = Type == TYPE_REAL ? BC_DIVF : BC_DIVI;
+                break;
+            default:
+                Fail("Unknown operation!");
+                return;
+        }
+        uint16_t Reg = Dest && Dest->Type == Type ? Dest->Reg : NewRegister();
+        Emit(Op, Reg, L->Reg, R->Reg);
+        V = Value{Reg, Type};
+    }
+
+    virtual void Visit(CallExprAST &E) override {
+        Fail("Procedures do not return a value");
+    }
+
+    virtual void Visit(StatementCallExprAST &S) override {
+        uint32_t Mark = NextReg;
+        if (S.GetCallee() == "write" || S.GetCallee() == "writeln") {
+            Write(S.GetArgs(), S.GetCallee() == "writeln");
+        } else {
+            Call(S.GetCallee(), S.GetArgs());
+        }
+        NextReg = Mark;
+    }
+
+    virtual void Visit(IfStatementAST &S) override {
+        uint32_t Mark = NextReg;
+        size_t ToElse;
+        auto *Cmp = DynCast<BinaryExprAST>(S.GetCond());
+        if (Cmp && Cmp->GetOp() == '<') {
+            // Compare and branch in one instruction
+            Value L, R;
+            if (!CompileComparison(*Cmp, L, R)) {
+                LogError("Failed to codegen cond");
+                return;
+            }
+            ToElse = Emit(L.Type == TYPE_REAL ? BC_JNLTF : BC_JNLTI, L.Reg,
+                          R.Reg);
+        } else {
+            std::optional<Value> Cond = Compile(S.GetCond());
+            if (!Cond) {
+                LogError("Failed to codegen cond");
+                return;
+            }
+            Cond = Convert(*Cond, TYPE_BOOLEAN);
+            if (!Cond) {
+                return;
+            }
+            ToElse = Emit(BC_JZ, Cond->Reg);
+        }
+        NextReg = Mark;
+
+        S.GetThen().Accept(*this);
+        if (Failed) {
+            LogError("Failed to codegen then clause");
+            return;
+        }
+        if (!S.HasElse()) {
+            Patch(ToElse);
+            return;
+        }
+        size_t ToEnd = Emit(BC_JMP);
+        Patch(ToElse);
+        S.GetElse().Accept(*this);
+        Patch(ToEnd);
+    }
+
+    // Like the compiled loop, the body runs before the end condition is
+    // first checked, and End is evaluated again after every iteration
+    virtual void Visit(ForStatementAST &S) override {
+        uint32_t Mark = NextReg;
+        if (S.IsParallel()) {
+            CompileParallelFor(S);
+            NextReg = Mark;
+            return;
+        }
+
+        std::optional<Value> Start = Compile(S.GetStart());
+        Start = Start ? Convert(*Start, TYPE_INTEGER) : std::nullopt;
+        if (!Start) {
+            LogError("Failed to codegen start");
+            return;
+        }
+
+        auto Old = NamedValues.find(S.GetVarName());
+        std::optional<Variable> OldVar;
+        if (Old != NamedValues.end()) {
+            OldVar = Old->second;
+        }
+        uint16_t Var = Declare(S.GetVarName(), TYPE_INTEGER);
+        Emit(BC_MOV, Var, Start->Reg);
+
+        size_t Top = Fn->Code.size();
+        S.GetBody().Accept(*this);
+        if (Failed) {
+            LogError("Error generating body code in for loop");
+            return;
+        }
+        std::optional<Value> End = Compile(S.GetEnd());
+        End = End ? Convert(*End, TYPE_INTEGER) : std::nullopt;
+        if (!End) {
+            LogError("Failed to codegen end cond");
+            return;
+        }
+        // Increments the variable and goes back to the top in one
+        // instruction
+        SetTarget(Emit(BC_FORLOOP, Var, End->Reg), Top);
+
+        if (OldVar) {
+            NamedValues[S.GetVarName()] = *OldVar;
+        } else {
+            NamedValues.erase(S.GetVarName());
+        }
+        NextReg = Mark;
+    }
+
+    virtual void Visit(VariableAssignmentAST &S) override {
+        uint32_t Mark = NextReg;
+        auto It = NamedValues.find(S.GetVarName());
+        std::optional<Value> Dest;
+        if (It != NamedValues.end()) {
+            Dest = Value{It->second.Reg, It->second.Type};
+        }
+        std::optional<Value> Val = Compile(S.GetValue(), Dest);
+        if (!Val) {
+            LogError("Failed to codegen expression in assignment");
+            return;
+        }
+        if (!Dest) {
+            Fail("Unknown variable");
+            return;
+        }
+        Val = Convert(*Val, Dest->Type);
+        if (!Val) {
+            return;
+        }
+        if (Val->Reg != Dest->Reg) {
+            Emit(BC_MOV, Dest->Reg, Val->Reg);
+        }
+        NextReg = Mark;
+    }
+
+    // Frames start out zeroed, which is what a new variable holds
+    virtual void Visit(VariableDeclAST &D) override {
+        for (auto &Name : D.GetVarNames()) {
+            Declare(Name, D.GetType());
+        }
+    }
+
+    virtual void Visit(PrototypeAST &P) override {}
+
+    virtual void Visit(DeclarationAST &D) override {
+        for (auto &VarDecl : D.GetVarDeclarations()) {
+            VarDecl->Accept(*this);
+        }
+    }
+
+    virtual void Visit(CompoundStatementAST &S) override {
+        for (auto &Statement : S.GetStatements()) {
+            if (Failed) {
+                return;
+            }
+            Statement->Accept(*this);
+        }
+    }
+
+    virtual void Visit(BlockAST &B) override {
+        B.GetDeclaration().Accept(*this);
+        B.GetCompoundStatementAST().Accept(*this);
+    }
+
+    virtual void Visit(FunctionAST &Func) override {
+        const std::string &Name = Func.GetPrototype().GetName();
+        if (Procedures.count(Name)) {
+            Fail("Function cannot be redefined");
+            return;
+        }
+        StartFunction(Name);
+
+        // Registered before the body, which may call the procedure itself
+        std::vector<VarType> &Params = Procedures[Name];
+        for (auto &Decl : Func.GetPrototype().GetParameters()) {
+            for (auto &ParamName : Decl->GetVarNames()) {
+                Declare(ParamName, Decl->GetType());
+                Params.push_back(Decl->GetType());
+            }
+        }
+        Fn->NumParams = Params.size();
+
+        Func.GetBody().Accept(*this);
+        if (Failed) {
+            LogError("Error while generating function body");
+            return;
+        }
+        Emit(BC_RET);
+        FinishFunction();
+    }
+
+    virtual void Visit(ProgramAST &P) override {
+        Program.Name = P.GetName();
+        for (auto &Func : P.GetFunctions()) {
+            Func->Accept(*this);
+            if (Failed) {
+                return;
+            }
+        }
+        Program.Main = Program.Functions.size();
+        StartFunction("micropascal_main");
+        P.GetBlock().Accept(*this);
+        if (Failed) {
+            return;
+        }
+        Emit(BC_RET);
+        FinishFunction();
+    }
+};
+
+// Little-endian whatever the host
+class Writer {
+    raw_ostream &OS;
+
+   public:
+    Writer(raw_ostream &OS) : OS(OS) {}
+
+    void U32(uint32_t V) {
+        for (int i = 0; i < 4; i++) {
+            OS << char(V >> (8 * i));
+        }
+    }
+
+    void U64(uint64_t V) {
+        for (int i = 0; i < 8; i++) {
+            OS << char(V >> (8 * i));
+        }
+    }
+
+    void Str(const std::string &S) {
+        U32(S.size());
+        OS << S;
+    }
+};
+
+class Reader {
+    const char *Cur, *End;
+
+   public:
+    bool Truncated = false;
+
+    Reader(StringRef Data) : Cur(Data.begin()), End(Data.end()) {}
+
+    uint64_t Bytes(int N) {
+        if (End - Cur < N) {
+            Truncated = true;
+            Cur = End;
+            return 0;
+        }
+        uint64_t V = 0;
+        for (int i = 0; i < N; i++) {
+            V |= uint64_t(uint8_t(Cur[i])) << (8 * i);
+        }
+        Cur += N;
+        return V;
+    }
+
+    uint32_t U32() { return Bytes(4); }
+    uint64_t U64() { return Bytes(8); }
+
+    std::string Str() {
+        uint32_t Size = U32();
+        if (uint64_t(End - Cur) < Size) {
+            Truncated = true;
+            Cur = End;
+            return "";
+        }
+        std::string S(Cur, Size);
+        Cur += Size;
+        return S;
+    }
+
+    bool AtEnd() const { return Cur == End; }
+};
+
+const char Magic[] = "MPBC";
+constexpr uint32_t Version = 1;
+
+Error Malformed(const std::string &Path, const char *What) {
+    return createStringError(inconvertibleErrorCode(),
+                             "'%s' is not valid bytecode: %s", Path.c_str(),
+                             What);
+}
+
+// Null if every operand of F is in range
+const char *CheckFunction(const BytecodeProgram &P,
+                          const BytecodeFunction &F) {
+    if (F.Frame.size() > MaxRegisters || F.NumParams > F.Frame.size()) {
+        return "bad frame size";
+    }
+    if (F.Code.empty() ||
+        (F.Code.back().Op != BC_RET && F.Code.back().Op != BC_JMP)) {
+        return "procedure does not end in a return or jump";
+    }
+    for (const BytecodeInstr &I : F.Code) {
+        if (I.Op >= BC_NUM_OPS) {
+            return "unknown opcode";
+        }
+        const OpInfo &Info = OpInfos[I.Op];
+        auto OutOfFrame = [&F](OperandKind Kind, uint16_t Operand) {
+            return Kind == OPERAND_R && Operand >= F.Frame.size();
+        };
+        if (OutOfFrame(Info.A, I.A) || OutOfFrame(Info.B, I.B) ||
+            OutOfFrame(Info.C, I.C)) {
+            return "register out of range";
+        }
+        if (Info.C == OPERAND_T && I.Wide() >= F.Code.size()) {
+            return "jump out of range";
+        }
+        if (Info.C == OPERAND_S && I.Wide() >= P.Strings.size()) {
+            return "string out of range";
+        }
+        if (Info.C == OPERAND_F) {
+            if (I.Wide() >= P.CallSites.size()) {
+                return "call out of range";
+            }
+            if (I.A + P.CallSites[I.Wide()].Argc > F.Frame.size()) {
+                return "arguments out of range";
+            }
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+std::unique_ptr<BytecodeProgram> CompileBytecode(ProgramAST &P) {
+    auto Program = std::make_unique<BytecodeProgram>();
+    BytecodeGen Gen(*Program);
+    P.Accept(Gen);
+    if (Gen.Failed) {
+        return nullptr;
+    }
+    return Program;
+}
+
+Error SaveBytecode(const BytecodeProgram &P, const std::string &Path) {
+    std::error_code EC;
+    raw_fd_ostream OS(Path, EC, sys::fs::OF_None);
+    if (EC) {
+        return createStringError(EC, "could not open '%s'", Path.c_str());
+    }
+    OS << Magic;
+    Writer W(OS);
+    W.U32(Version);
+    W.Str(P.Name);
+    W.U32(P.Main);
+
+    W.U32(P.Strings.size());
+    for (auto &Str : P.Strings) {
+        W.Str(Str);
+    }
+    W.U32(P.CallSites.size());
+    for (auto &Site : P.CallSites) {
+        W.Str(Site.Callee);
+        W.U32(Site.Argc);
+    }
+
+    W.U32(P.Functions.size());
+    for (auto &F : P.Functions) {
+        W.Str(F.Name);
+        W.U32(F.NumParams);
+        W.U32(F.Frame.size());
+        for (BytecodeSlot Slot : F.Frame) {
+            W.U64(Slot.I);
+        }
+        W.U32(F.Code.size());
+        for (const BytecodeInstr &I : F.Code) {
+            W.U64(uint64_t(I.Op) | uint64_t(I.X) << 8 | uint64_t(I.A) << 16 |
+                  uint64_t(I.B) << 32 | uint64_t(I.C) << 48);
+        }
+    }
+
+    OS.close();
+    if (OS.has_error()) {
+        return createStringError(OS.error(), "could not write '%s'",
+                                 Path.c_str());
+    }
+    return Error::success();
+}
+
+Expected<std::unique_ptr<BytecodeProgram>> LoadBytecode(
+    const std::string &Path) {
+    auto Buffer = MemoryBuffer::getFile(Path);
+    if (!Buffer) {
+        return createStringError(Buffer.getError(), "could not open '%s'",
+                                 Path.c_str());
+    }
+    StringRef Data = (*Buffer)->getBuffer();
+    if (!Data.startswith(Magic)) {
+        return Malformed(Path, "bad magic");
+    }
+    Reader In(Data.drop_front(strlen(Magic)));
+    if (In.U32() != Version) {
+        return Malformed(Path, "unsupported version");
+    }
+
+    // The loops stop at the end of the file, so that a bad count cannot
+    // make them allocate much
+    auto P = std::make_unique<BytecodeProgram>();
+    P->Name = In.Str();
+    P->Main = In.U32();
+    uint32_t NumStrings = In.U32();
+    for (uint32_t i = 0; i < NumStrings && !In.Truncated; i++) {
+        P->Strings.push_back(In.Str());
+    }
+    uint32_t NumCallSites = In.U32();
+    for (uint32_t i = 0; i < NumCallSites && !In.Truncated; i++) {
+        std::string Callee = In.Str();
+        P->CallSites.push_back({Callee, In.U32()});
+    }
+    uint32_t NumFunctions = In.U32();
+    for (uint32_t i = 0; i < NumFunctions && !In.Truncated; i++) {
+        BytecodeFunction F;
+        F.Name = In.Str();
+        F.NumParams = In.U32();
+        uint32_t FrameSize = In.U32();
+        for (uint32_t j = 0; j < FrameSize && !In.Truncated; j++) {
+            F.Frame.push_back(IntSlot(In.U64()));
+        }
+        uint32_t CodeSize = In.U32();
+        for (uint32_t j = 0; j < CodeSize && !In.Truncated; j++) {
+            uint64_t Bits = In.U64();
+            F.Code.push_back({BytecodeOp(Bits & 0xFF), uint8_t(Bits >> 8),
+                              uint16_t(Bits >> 16), uint16_t(Bits >> 32),
+                              uint16_t(Bits >> 48)});
+        }
+        P->Functions.push_back(std::move(F));
+    }
+    if (In.Truncated || !In.AtEnd()) {
+        return Malformed(Path, "bad size");
+    }
+
+    if (P->Main >= P->Functions.size() ||
+        P->Functions[P->Main].NumParams != 0) {
+        return Malformed(Path, "no main block");
+    }
+    for (auto &F : P->Functions) {
+        if (const char *Problem = CheckFunction(*P, F)) {
+            return Malformed(Path, Problem);
+        }
+    }
+    return std::move(P);
+}
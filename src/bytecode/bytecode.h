@@ -0,0 +1,130 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ast/ast.h"
+#include "llvm/Support/Error.h"
+
+/**
+ * A compact register-based bytecode, for running programs without waiting
+ * for LLVM.
+ *
+ * Every procedure has a frame of 8-byte registers holding its parameters,
+ * variables, temporaries and constants. A call starts from a copy of the
+ * procedure's frame template, which has the constants in place and zeros
+ * elsewhere, so no instruction ever loads a constant.
+ *
+ * Instructions are 8 bytes: an opcode and three 16-bit operands A, B and C.
+ * Operands that need more than 16 bits, jump targets, call sites and
+ * strings, take C and the extra byte X together.
+ */
+
+// Opcode, and what its operands A, B and C are: a register (R), a jump
+// target (T), a call site (F), a string (S) or nothing (N). T, F and S are
+// only ever in C.
+#define BYTECODE_OPCODES(X) \
+    X(MOV, R, R, N)         \
+    X(ITOF, R, R, N)        \
+    X(ADDI, R, R, R)        \
+    X(SUBI, R, R, R)        \
+    X(MULI, R, R, R)        \
+    X(DIVI, R, R, R)        \
+    X(LTI, R, R, R)         \
+    X(MINI, R, R, R)        \
+    X(MAXI, R, R, R)        \
+    X(ADDF, R, R, R)        \
+    X(SUBF, R, R, R)        \
+    X(MULF, R, R, R)        \
+    X(DIVF, R, R, R)        \
+    X(LTF, R, R, R)         \
+    X(MINF, R, R, R)        \
+    X(MAXF, R, R, R)        \
+    X(JMP, N, N, T)         \
+    X(JZ, R, N, T)          \
+    X(JNLTI, R, R, T)       \
+    X(JNLTF, R, R, T)       \
+    X(FORLOOP, R, R, T)     \
+    X(CALL, R, N, F)        \
+    X(WRITEI, R, N, N)      \
+    X(WRITEB, R, N, N)      \
+    X(WRITEF, R, N, N)      \
+    X(WRITES, N, N, S)      \
+    X(NEWLINE, N, N, N)     \
+    X(RET, N, N, N)
+
+// A = B op C, with integers wrapping on overflow. LT* set A to 0 or 1.
+// JZ jumps if A is 0, JNLT* if A < B does not hold. FORLOOP ends a for loop:
+// it increments the loop variable in A and jumps back if its old value was
+// less than B. CALL passes the registers from A on as the call site's
+// arguments.
+enum BytecodeOp : uint8_t {
+#define X(Name, A, B, C) BC_##Name,
+    BYTECODE_OPCODES(X)
+#undef X
+        BC_NUM_OPS,
+};
+
+struct BytecodeInstr {
+    BytecodeOp Op;
+    uint8_t X;
+    uint16_t A, B, C;
+
+    uint32_t Wide() const { return uint32_t(X) << 16 | C; }
+};
+
+union BytecodeSlot {
+    int64_t I;
+    double D;
+};
+
+struct BytecodeFunction {
+    std::string Name;
+    uint32_t NumParams = 0;
+    std::vector<BytecodeSlot> Frame;
+    std::vector<BytecodeInstr> Code;
+};
+
+/**
+ * A call instruction's callee, which is looked up by name the first time
+ * the call runs and cached from then on
+ */
+struct BytecodeCallSite {
+    std::string Callee;
+    uint32_t Argc;
+    BytecodeFunction *Cached = nullptr;
+};
+
+struct BytecodeProgram {
+    std::string Name;
+    std::vector<BytecodeFunction> Functions;
+    uint32_t Main = 0;
+    std::vector<std::string> Strings;
+    std::vector<BytecodeCallSite> CallSites;
+};
+
+/**
+ * Compiles P, reporting errors through LogError as codegen does. Returns
+ * null if there were any.
+ */
+std::unique_ptr<BytecodeProgram> CompileBytecode(ProgramAST &P);
+
+/**
+ * Runs the program's main block and flushes its output. Returns false if it
+ * stopped on an error.
+ */
+bool RunBytecode(BytecodeProgram &P);
+
+/**
+ * Writes P to Path in a portable format, or reads it back. Loading checks
+ * that every operand is in range, so that a damaged file cannot make the VM
+ * read outside of a frame or jump outside of a procedure.
+ */
+llvm::Error SaveBytecode(const BytecodeProgram &P, const std::string &Path);
+llvm::Expected<std::unique_ptr<BytecodeProgram>> LoadBytecode(
+    const std::string &Path);
+
+#endif
@@ -0,0 +1,212 @@
+// The bytecode interpreter. Each procedure call runs in a recursive call to
+// Execute, with its frame on a stack that is shared by all of them and
+// grows as needed.
+//
+// With GCC and Clang, every handler jumps straight to the next one through
+// a table of label addresses, which gives each its own indirect branch for
+// the predictor to learn. Other compilers get a switch.
+
+#include <algorithm>
+
+#include "bytecode/bytecode.h"
+#include "logger/logger.h"
+#include "runtime/runtime.h"
+
+namespace {
+
+// Integer arithmetic wraps here where compiled code's would be undefined
+int64_t Wrap(uint64_t V) { return static_cast<int64_t>(V); }
+
+class VM {
+    BytecodeProgram &P;
+    OutputBuffer *Out;
+    std::vector<BytecodeSlot> Stack;
+    size_t Top = 0;
+
+   public:
+    bool Failed = false;
+
+    VM(BytecodeProgram &P) : P(P), Out(mp_output_buffer()) {}
+
+    void Fail(const char *Message) {
+        LogError(Message);
+        Failed = true;
+    }
+
+    // Resolves a call site the first time it runs
+    BytecodeFunction *Resolve(BytecodeCallSite &Site) {
+        for (auto &F : P.Functions) {
+            if (F.Name == Site.Callee && F.NumParams == Site.Argc) {
+                Site.Cached = &F;
+                return &F;
+            }
+        }
+        Fail("Could not find function");
+        return nullptr;
+    }
+
+    void Reserve(size_t Size) {
+        if (Stack.size() < Size) {
+            Stack.resize(std::max(Stack.size() * 2, Size));
+        }
+    }
+
+    // Runs Fn with its arguments at Stack[Base]
+    void Execute(BytecodeFunction &Fn, size_t Base);
+
+    void Run() {
+        BytecodeFunction &Main = P.Functions[P.Main];
+        Reserve(std::max<size_t>(Main.Frame.size(), 1024));
+        Execute(Main, 0);
+    }
+};
+
+void VM::Execute(BytecodeFunction &Fn, size_t Base) {
+    const size_t FrameSize = Fn.Frame.size();
+    Reserve(Base + FrameSize);
+    // Everything but the arguments starts as it is in the template
+    std::copy(Fn.Frame.begin() + Fn.NumParams, Fn.Frame.end(),
+              Stack.begin() + Base + Fn.NumParams);
+    size_t SavedTop = Top;
+    Top = Base + FrameSize;
+
+    const BytecodeInstr *Code = Fn.Code.data();
+    const BytecodeInstr *IP = Code;
+    BytecodeSlot *R = Stack.data() + Base;
+    BytecodeInstr I;
+
+#if defined(__GNUC__)
+    static const void *const Labels[] = {
+#define X(Name, A, B, C) &&Op_##Name,
+        BYTECODE_OPCODES(X)
+#undef X
+    };
+#define CASE(Name) Op_##Name
+#define NEXT()               \
+    do {                     \
+        I = *IP++;           \
+        goto *Labels[I.Op];  \
+    } while (0)
+#define DISPATCH() NEXT();
+#else
+#define CASE(Name) case BC_##Name
+#define NEXT() continue
+#define DISPATCH() \
+    for (;;)       \
+        switch (I = *IP++, I.Op)
+#endif
+
+    DISPATCH() {
+        CASE(MOV) : R[I.A] = R[I.B];
+        NEXT();
+        CASE(ITOF) : R[I.A].D = static_cast<double>(R[I.B].I);
+        NEXT();
+        CASE(ADDI) : R[I.A].I = Wrap(uint64_t(R[I.B].I) + uint64_t(R[I.C].I));
+        NEXT();
+        CASE(SUBI) : R[I.A].I = Wrap(uint64_t(R[I.B].I) - uint64_t(R[I.C].I));
+        NEXT();
+        CASE(MULI) : R[I.A].I = Wrap(uint64_t(R[I.B].I) * uint64_t(R[I.C].I));
+        NEXT();
+        CASE(DIVI) : {
+            int64_t L = R[I.B].I, Div = R[I.C].I;
+            // Compiled code would trap
+            if (Div == 0 || (L == INT64_MIN && Div == -1)) {
+                Fail("Integer division overflow");
+                goto Done;
+            }
+            R[I.A].I = L / Div;
+        }
+        NEXT();
+        CASE(LTI) : R[I.A].I = R[I.B].I < R[I.C].I;
+        NEXT();
+        CASE(MINI) : R[I.A] = R[I.B].I < R[I.C].I ? R[I.B] : R[I.C];
+        NEXT();
+        CASE(MAXI) : R[I.A] = R[I.B].I > R[I.C].I ? R[I.B] : R[I.C];
+        NEXT();
+        CASE(ADDF) : R[I.A].D = R[I.B].D + R[I.C].D;
+        NEXT();
+        CASE(SUBF) : R[I.A].D = R[I.B].D - R[I.C].D;
+        NEXT();
+        CASE(MULF) : R[I.A].D = R[I.B].D * R[I.C].D;
+        NEXT();
+        CASE(DIVF) : R[I.A].D = R[I.B].D / R[I.C].D;
+        NEXT();
+        CASE(LTF) : R[I.A].I = R[I.B].D < R[I.C].D;
+        NEXT();
+        CASE(MINF) : R[I.A] = R[I.B].D < R[I.C].D ? R[I.B] : R[I.C];
+        NEXT();
+        CASE(MAXF) : R[I.A] = R[I.B].D > R[I.C].D ? R[I.B] : R[I.C];
+        NEXT();
+        CASE(JMP) : IP = Code + I.Wide();
+        NEXT();
+        CASE(JZ) : if (R[I.A].I == 0) { IP = Code + I.Wide(); }
+        NEXT();
+        CASE(JNLTI) : if (!(R[I.A].I < R[I.B].I)) { IP = Code + I.Wide(); }
+        NEXT();
+        CASE(JNLTF) : if (!(R[I.A].D < R[I.B].D)) { IP = Code + I.Wide(); }
+        NEXT();
+        CASE(FORLOOP) : {
+            int64_t Cur = R[I.A].I;
+            R[I.A].I = Wrap(uint64_t(Cur) + 1);
+            if (Cur < R[I.B].I) {
+                IP = Code + I.Wide();
+            }
+        }
+        NEXT();
+        CASE(CALL) : {
+            BytecodeCallSite &Site = P.CallSites[I.Wide()];
+            BytecodeFunction *Callee = Site.Cached;
+            if (!Callee && !(Callee = Resolve(Site))) {
+                goto Done;
+            }
+            // The callee's frame goes above this one, with the arguments
+            // copied to its first registers
+            size_t CalleeBase = Top;
+            size_t ArgOffset = R - Stack.data() + I.A;
+            Reserve(CalleeBase + Callee->Frame.size());
+            std::copy_n(Stack.begin() + ArgOffset, Site.Argc,
+                        Stack.begin() + CalleeBase);
+            Execute(*Callee, CalleeBase);
+            if (Failed) {
+                goto Done;
+            }
+            // The stack may have moved
+            R = Stack.data() + Base;
+        }
+        NEXT();
+        CASE(WRITEI) : mp_write_int(Out, R[I.A].I);
+        NEXT();
+        CASE(WRITEB) : mp_write_bool(Out, R[I.A].I);
+        NEXT();
+        CASE(WRITEF) : mp_write_real(Out, R[I.A].D);
+        NEXT();
+        CASE(WRITES) : {
+            const std::string &Str = P.Strings[I.Wide()];
+            mp_write_str(Out, Str.data(), Str.size());
+        }
+        NEXT();
+        CASE(NEWLINE) : mp_write_newline(Out);
+        NEXT();
+        CASE(RET) : goto Done;
+#if !defined(__GNUC__)
+        default:
+            goto Done;
+#endif
+    }
+
+#undef CASE
+#undef NEXT
+#undef DISPATCH
+
+Done:
+    Top = SavedTop;
+}
+
+}  // namespace
+
+bool RunBytecode(BytecodeProgram &P) {
+    VM Machine(P);
+    Machine.Run();
+    mp_flush();
+    return !Machine.Failed;
+}
@@ -1,117 +1,482 @@
 #include "codegen/codegen.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
+#include <optional>
 
 #include "llvm/Analysis/CGSCCPassManager.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/Analysis/LoopAccessAnalysis.h"
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/StandardInstrumentations.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Transforms/IPO/AlwaysInliner.h"
 #include "llvm/Transforms/InstCombine/InstCombine.h"
 #include "llvm/Transforms/Scalar.h"
 #include "llvm/Transforms/Scalar/GVN.h"
 #include "llvm/Transforms/Scalar/Reassociate.h"
 #include "llvm/Transforms/Scalar/SimplifyCFG.h"
+#include "llvm/Transforms/Utils/Cloning.h"
 #include "logger/logger.h"
+#include "pgo/pgo.h"
+#include "rtbitcode/rtbitcode.h"
+#include "runtime/runtime.h"
+#include "tiering/tiering.h"
 
 using namespace llvm;
 
+static cl::opt<bool> Tiered(
+    "tiered",
+    cl::desc("Compile procedures at -O0 first and re-optimize hot ones"));
+static cl::opt<unsigned> TierThreshold(
+    "tier-threshold", cl::desc("Calls before a procedure is re-optimized"),
+    cl::init(1000));
+static cl::opt<unsigned> TierOptLevel(
+    "tier-opt", cl::desc("Optimization level for hot procedures (2 or 3)"),
+    cl::init(3));
+
+static cl::opt<PGOMode> PGO(
+    "pgo", cl::desc("Profile-guided optimization"),
+    cl::values(
+        clEnumValN(PGO_OFF, "off", "Do not use profiles"),
+        clEnumValN(PGO_GEN, "gen", "Instrument and record a profile"),
+        clEnumValN(PGO_USE, "use", "Optimize with the recorded profile"),
+        clEnumValN(PGO_AUTO, "auto",
+                   "Use the profile if one exists, record one otherwise")),
+    cl::init(PGO_OFF));
+static cl::opt<std::string> PGODir(
+    "pgo-dir", cl::desc("Directory holding <program>.profdata profiles"),
+    cl::init("."));
+
+static cl::opt<bool> Profile(
+    "profile",
+    cl::desc("Count the calls and cycles of every procedure and print them "
+             "when the program ends"));
+static cl::opt<std::string> ProfileJSON(
+    "profile-json",
+    cl::desc("Profile like --profile, but write the counts to this file as "
+             "JSON"),
+    cl::value_desc("filename"));
+
+bool CheckCodeGenOptions(bool CompileAndRun, bool ProgramJITDylibs) {
+    if (TierOptLevel != 2 && TierOptLevel != 3) {
+        LogError("--tier-opt must be 2 or 3");
+        return false;
+    }
+    // The call counter is compared after its increment, so it never equals
+    // a threshold of 0
+    if (TierThreshold == 0) {
+        LogError("--tier-threshold must be at least 1");
+        return false;
+    }
+    if (Tiered && !CompileAndRun) {
+        LogError("--tiered cannot be combined with --session, --aot or "
+                 "--exec");
+        return false;
+    }
+    if (Tiered && PGO != PGO_OFF) {
+        LogError("--pgo cannot be combined with --tiered");
+        return false;
+    }
+    if (PGO != PGO_OFF && !CompileAndRun) {
+        LogError("--pgo cannot be combined with --session, --aot or --exec");
+        return false;
+    }
+    // Tier-up stubs and their re-optimized bodies live in the main JITDylib
+    if (Tiered && ProgramJITDylibs) {
+        LogError("--tiered cannot be combined with --program-threads or "
+                 "input files");
+        return false;
+    }
+    // The counters are per process, so concurrent programs would count
+    // into each other's reports
+    if ((Profile || !ProfileJSON.empty()) && ProgramJITDylibs) {
+        LogError("--profile cannot be combined with --program-threads or "
+                 "input files");
+        return false;
+    }
+    return true;
+}
+
+// Where a local variable or parameter lives and its declared type, since
+// integers and booleans share an LLVM type. Ptr is an alloca, or inside the
+// body of a parallel for, a pointer into the enclosing procedure's frame.
+struct Variable {
+    Value *Ptr;
+    VarType Type;
+};
+
+// The function pass pipeline and the analysis managers it runs with, which
+// do not depend on the program being compiled. Declared in the order that
+// lets the proxies between the managers be destroyed first.
+struct CodeGenPasses {
+    LoopAnalysisManager LAM;
+    FunctionAnalysisManager FAM;
+    CGSCCAnalysisManager CGAM;
+    ModuleAnalysisManager MAM;
+    PassInstrumentationCallbacks PIC;
+    StandardInstrumentations SI;
+    FunctionPassManager FPM;
+
+    CodeGenPasses(LLVMContext &Ctx, TargetMachine *TM) : SI(Ctx, true) {
+        SI.registerCallbacks(PIC, &MAM);
+
+        FPM.addPass(InstCombinePass());
+        FPM.addPass(ReassociatePass());
+        FPM.addPass(GVNPass());
+        FPM.addPass(SimplifyCFGPass());
+
+        PassBuilder PB(TM);
+        PB.registerModuleAnalyses(MAM);
+        PB.registerFunctionAnalyses(FAM);
+        PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+    }
+
+    // Drops the analyses cached for a module, which would otherwise be
+    // handed to the next module allocated at the same address
+    void Clear() {
+        FAM.clear();
+        LAM.clear();
+        CGAM.clear();
+        MAM.clear();
+    }
+};
+
 class GenIRVisitor : public ASTVisitor {
     // std::unique_ptr<Module> TheModule;
     Module *TheModule;
     IRBuilder<> Builder;
-    std::unique_ptr<FunctionPassManager> TheFPM;
-    std::unique_ptr<LoopAnalysisManager> TheLAM;
-    std::unique_ptr<FunctionAnalysisManager> TheFAM;
-    std::unique_ptr<CGSCCAnalysisManager> TheCGAM;
-    std::unique_ptr<ModuleAnalysisManager> TheMAM;
-    std::unique_ptr<PassInstrumentationCallbacks> ThePIC;
-    std::unique_ptr<StandardInstrumentations> TheSI;
+    FunctionPassManager *TheFPM;
+    FunctionAnalysisManager *TheFAM;
+    ModuleAnalysisManager *TheMAM;
+    bool RunFunctionPasses;
+    double PassSeconds = 0;
 
-    Type *Int64Ty, *Int1Ty;
+    Type *Int64Ty, *Int1Ty, *DoubleTy, *PtrTy;
 
     Value *V;
+    VarType ExprType;
     Function *F;
-    std::map<std::string, AllocaInst *> NamedValues;
+    std::map<std::string, Variable> NamedValues;
 
    public:
-    GenIRVisitor(Module *M, std::unique_ptr<FunctionPassManager> FPM,
-                 std::unique_ptr<LoopAnalysisManager> LAM,
-                 std::unique_ptr<FunctionAnalysisManager> FAM,
-                 std::unique_ptr<CGSCCAnalysisManager> CGAM,
-                 std::unique_ptr<ModuleAnalysisManager> MAM,
-                 std::unique_ptr<PassInstrumentationCallbacks> PIC,
-                 std::unique_ptr<StandardInstrumentations> SI)
+    GenIRVisitor(Module *M, CodeGenPasses &Passes,
+                 bool RunFunctionPasses = true)
         : TheModule(M),
-          TheFPM(std::move(FPM)),
-          TheLAM(std::move(LAM)),
-          TheFAM(std::move(FAM)),
-          TheCGAM(std::move(CGAM)),
-          TheMAM(std::move(MAM)),
-          ThePIC(std::move(PIC)),
-          TheSI(std::move(SI)),
+          TheFPM(&Passes.FPM),
+          TheFAM(&Passes.FAM),
+          TheMAM(&Passes.MAM),
+          RunFunctionPasses(RunFunctionPasses),
           Builder(TheModule->getContext()) {
         Int1Ty = Type::getInt1Ty(TheModule->getContext());
         Int64Ty = Type::getInt64Ty(TheModule->getContext());
+        DoubleTy = Type::getDoubleTy(TheModule->getContext());
+        PtrTy = PointerType::getUnqual(TheModule->getContext());
+    }
+
+    Type *GetType(VarType T) { return T == TYPE_REAL ? DoubleTy : Int64Ty; }
 
-        TheSI->registerCallbacks(*ThePIC, TheMAM.get());
+    // Generates into M, which must share the context, from now on
+    void SetModule(Module *M) { TheModule = M; }
 
-        TheFPM->addPass(InstCombinePass());
-        TheFPM->addPass(ReassociatePass());
-        TheFPM->addPass(GVNPass());
-        TheFPM->addPass(SimplifyCFGPass());
+    // Seconds spent in optimization passes so far
+    double GetPassSeconds() const { return PassSeconds; }
 
-        PassBuilder PB;
-        PB.registerModuleAnalyses(*TheMAM);
-        PB.registerFunctionAnalyses(*TheFAM);
-        PB.crossRegisterProxies(*TheLAM, *TheFAM, *TheCGAM, *TheMAM);
+    void RunPasses(Function &Fn) {
+        if (!RunFunctionPasses) {
+            return;
+        }
+        auto Start = std::chrono::steady_clock::now();
+        TheFPM->run(Fn, *TheFAM);
+        std::chrono::duration<double> Elapsed =
+            std::chrono::steady_clock::now() - Start;
+        PassSeconds += Elapsed.count();
+    }
+
+    static bool Profiling() { return Profile || !ProfileJSON.empty(); }
+
+    // --profile: counts the activation that starts here in a site of the
+    // procedure's own. Called once the entry block is set up.
+    void EmitProfileEnter(const std::string &Name) {
+        if (!Profiling()) {
+            return;
+        }
+        StructType *SiteTy = StructType::get(PtrTy, Int64Ty);
+        Constant *Site = ConstantStruct::get(
+            SiteTy, {Builder.CreateGlobalString(Name, ".profname"),
+                     ConstantInt::get(Int64Ty, 0)});
+        auto *GV = new GlobalVariable(*TheModule, SiteTy, false,
+                                      GlobalValue::InternalLinkage, Site,
+                                      ".profsite");
+        Builder.CreateCall(
+            GetRuntimeFunction("mp_profile_enter",
+                               Type::getVoidTy(TheModule->getContext()),
+                               {PtrTy}),
+            {GV});
+    }
+
+    // Procedures return only at the end of their body
+    void EmitProfileExit() {
+        if (!Profiling()) {
+            return;
+        }
+        Builder.CreateCall(GetRuntimeFunction(
+            "mp_profile_exit", Type::getVoidTy(TheModule->getContext()), {}));
     }
 
     AllocaInst *CreateEntryBlockAlloca(Function *TheFunction,
-                                       const std::string &VarName) {
+                                       const std::string &VarName,
+                                       Type *Ty) {
         IRBuilder<> TmpBuilder(&TheFunction->getEntryBlock(),
                                TheFunction->getEntryBlock().begin());
-        return TmpBuilder.CreateAlloca(Int64Ty, nullptr, VarName);
+        return TmpBuilder.CreateAlloca(Ty, nullptr, VarName);
+    }
+
+    // Converts V from type From for a destination of type To. Integers widen
+    // to reals, but reals never narrow implicitly.
+    Value *Convert(Value *V, VarType From, VarType To) {
+        if (To == TYPE_REAL) {
+            if (From == TYPE_INTEGER) {
+                return Builder.CreateSIToFP(V, DoubleTy);
+            }
+            if (From == TYPE_BOOLEAN) {
+                LogError("Cannot convert a boolean to a real");
+                return nullptr;
+            }
+            return V;
+        }
+        if (From == TYPE_REAL) {
+            LogError("Cannot convert a real to an integer or boolean");
+            return nullptr;
+        }
+        // Comparisons produce an i1, but booleans are stored as i64
+        return Builder.CreateZExt(V, Int64Ty);
     }
 
-    void run(std::unique_ptr<AST> Ast) {
-        Ast->Accept(*this);
-        TheModule->print(errs(), nullptr);
+    FunctionCallee GetRuntimeFunction(const char *Name, Type *Result,
+                                      ArrayRef<Type *> Params) {
+        return TheModule->getOrInsertFunction(
+            Name, FunctionType::get(Result, Params, false));
+    }
+
+    // write and writeln take any number of arguments of any type. Each one
+    // becomes an append to the thread's output buffer, which is looked up
+    // once per statement.
+    void EmitWrite(const std::vector<std::unique_ptr<ExprAST>> &Args,
+                   bool NewLine) {
+        Type *VoidTy = Type::getVoidTy(TheModule->getContext());
+        Value *Out = Builder.CreateCall(
+            GetRuntimeFunction("mp_output_buffer", PtrTy, {}));
+
+        for (auto &Arg : Args) {
+            if (auto *Str = DynCast<StringExprAST>(*Arg)) {
+                Value *Ptr = Builder.CreateGlobalString(Str->GetVal(), ".str");
+                Builder.CreateCall(
+                    GetRuntimeFunction("mp_write_str", VoidTy,
+                                       {PtrTy, PtrTy, Int64Ty}),
+                    {Out, Ptr,
+                     ConstantInt::get(Int64Ty, Str->GetVal().size())});
+                continue;
+            }
+
+            Arg->Accept(*this);
+            if (!V) {
+                LogError("Error occurred while codegen write args");
+                return;
+            }
+
+            switch (ExprType) {
+                case TYPE_INTEGER:
+                    Builder.CreateCall(
+                        GetRuntimeFunction("mp_write_int", VoidTy,
+                                           {PtrTy, Int64Ty}),
+                        {Out, V});
+                    break;
+                case TYPE_BOOLEAN:
+                    Builder.CreateCall(
+                        GetRuntimeFunction("mp_write_bool", VoidTy,
+                                           {PtrTy, Int64Ty}),
+                        {Out, Convert(V, ExprType, TYPE_BOOLEAN)});
+                    break;
+                case TYPE_REAL:
+                    Builder.CreateCall(
+                        GetRuntimeFunction("mp_write_real", VoidTy,
+                                           {PtrTy, DoubleTy}),
+                        {Out, V});
+                    break;
+            }
+        }
+
+        if (NewLine) {
+            Builder.CreateCall(
+                GetRuntimeFunction("mp_write_newline", VoidTy, {PtrTy}), {Out});
+        }
+        V = Out;
+    }
+
+    // void <name>.args(ptr Args) calls procedure Callee with its arguments
+    // read from consecutive 8-byte slots of Args, for callers that only
+    // know its signature at run time
+    void EmitArgsThunk(Function &Callee) {
+        LLVMContext &Ctx = TheModule->getContext();
+        FunctionType *FT =
+            FunctionType::get(Type::getVoidTy(Ctx), {PtrTy}, false);
+        Function *Thunk = Function::Create(FT, Function::ExternalLinkage,
+                                           Callee.getName() + ".args",
+                                           TheModule);
+        Builder.SetInsertPoint(BasicBlock::Create(Ctx, "entry", Thunk));
+        std::vector<Value *> Args;
+        for (auto &Arg : Callee.args()) {
+            Value *Slot = Builder.CreateConstInBoundsGEP1_64(
+                Int64Ty, Thunk->getArg(0), Arg.getArgNo());
+            Args.push_back(Builder.CreateLoad(Arg.getType(), Slot));
+        }
+        Builder.CreateCall(&Callee, Args);
+        Builder.CreateRetVoid();
+    }
+
+    // Procedures defined outside of this program, e.g. by earlier programs
+    // in a REPL session. Declared up front, before any procedure that may
+    // call them is generated.
+    void DeclareExternalProcedures(const ProcedureTable &Procedures) {
+        for (auto &[Name, Params] : Procedures) {
+            std::vector<Type *> ParamTys;
+            for (VarType Param : Params) {
+                ParamTys.push_back(GetType(Param));
+            }
+            FunctionType *FT = FunctionType::get(
+                Type::getVoidTy(TheModule->getContext()), ParamTys, false);
+            Function::Create(FT, Function::ExternalLinkage, Name, TheModule);
+        }
+    }
+
+    // Completes the module once everything in it has been visited
+    void Finish(bool ArgsThunks, bool PrintIR) {
+        if (ArgsThunks) {
+            std::vector<Function *> Procedures;
+            for (Function &Fn : *TheModule) {
+                if (!Fn.isDeclaration() && !Fn.hasLocalLinkage()) {
+                    Procedures.push_back(&Fn);
+                }
+            }
+            for (Function *Fn : Procedures) {
+                EmitArgsThunk(*Fn);
+            }
+        }
+
+        ExitOnError ExitOnErr;
+        ExitOnErr(LinkRuntime(*TheModule));
+
+        // Fold the runtime helpers into their callers. Modes that skip the
+        // function passes run a full pipeline later, which inlines them too.
+        if (RunFunctionPasses) {
+            FunctionPassManager Cleanup;
+            Cleanup.addPass(InstCombinePass());
+            Cleanup.addPass(SimplifyCFGPass());
+
+            ModulePassManager MPM;
+            MPM.addPass(AlwaysInlinerPass());
+            MPM.addPass(createModuleToFunctionPassAdaptor(std::move(Cleanup)));
+            auto Start = std::chrono::steady_clock::now();
+            MPM.run(*TheModule, *TheMAM);
+            std::chrono::duration<double> Elapsed =
+                std::chrono::steady_clock::now() - Start;
+            PassSeconds += Elapsed.count();
+        }
+
+        if (PrintIR) {
+            TheModule->print(errs(), nullptr);
+        }
     }
 
     virtual void Visit(NumberExprAST &E) override {
+        if (E.GetIsReal()) {
+            V = ConstantFP::get(DoubleTy, E.GetVal());
+            ExprType = TYPE_REAL;
+            return;
+        }
         V = ConstantInt::get(Type::getInt64Ty(TheModule->getContext()),
                              (uint64_t)E.GetVal());
+        ExprType = TYPE_INTEGER;
     }
 
     virtual void Visit(ConcreteBoolExprAST &E) override {
         V = ConstantInt::get(Int64Ty, E.GetVal());
+        ExprType = TYPE_BOOLEAN;
+    }
+
+    virtual void Visit(StringExprAST &E) override {
+        LogError("Strings can only be passed to write and writeln");
+        V = nullptr;
     }
 
     virtual void Visit(VariableExprAST &E) override {
-        AllocaInst *A = NamedValues[E.GetName()];
-        if (!A) {
+        auto It = NamedValues.find(E.GetName());
+        if (It == NamedValues.end()) {
             LogError("Unknown variable");
+            V = nullptr;
             return;
         }
 
-        V = Builder.CreateLoad(A->getAllocatedType(), A, E.GetName().c_str());
+        V = Builder.CreateLoad(GetType(It->second.Type), It->second.Ptr,
+                               E.GetName().c_str());
+        ExprType = It->second.Type;
     }
 
     virtual void Visit(BinaryExprAST &E) override {
         E.GetLeft().Accept(*this);
         Value *L = V;
+        VarType LType = ExprType;
         E.GetRight().Accept(*this);
         Value *R = V;
+        VarType RType = ExprType;
 
         if (!L || !R) {
             LogError("L or R was null in visit");
             return;
         }
 
+        if (LType == TYPE_REAL || RType == TYPE_REAL) {
+            L = Convert(L, LType, TYPE_REAL);
+            R = Convert(R, RType, TYPE_REAL);
+            if (!L || !R) {
+                V = nullptr;
+                return;
+            }
+
+            ExprType = TYPE_REAL;
+            switch (E.GetOp()) {
+                case '+':
+                    V = Builder.CreateFAdd(L, R, "addtmp");
+                    break;
+                case '-':
+                    V = Builder.CreateFSub(L, R, "subtmp");
+                    break;
+                case '*':
+                    V = Builder.CreateFMul(L, R, "multmp");
+                    break;
+                case '/':
+                    V = Builder.CreateFDiv(L, R, "divtmp");
+                    break;
+                case '<':
+                    V = Builder.CreateFCmpOLT(L, R, "cmptmp");
+                    ExprType = TYPE_BOOLEAN;
+                    break;
+                default:
+                    LogError("Unknown operation!");
+                    return;
+            }
+            return;
+        }
+
+        ExprType = E.GetOp() == '<' ? TYPE_BOOLEAN : TYPE_INTEGER;
         switch (E.GetOp()) {
             case '+':
                 V = Builder.CreateNSWAdd(L, R, "addtmp");
@@ -150,6 +515,12 @@ class GenIRVisitor : public ASTVisitor {
         std::vector<Value *> ArgsV;
         for (unsigned i = 0, e = Args.size(); i != e; i++) {
             Args[i]->Accept(*this);
+            if (V) {
+                VarType ParamType =
+                    CalleeF->getArg(i)->getType()->isDoubleTy() ? TYPE_REAL
+                                                                : TYPE_INTEGER;
+                V = Convert(V, ExprType, ParamType);
+            }
             ArgsV.push_back(V);
             if (!ArgsV.back()) {
                 LogError("Error occurred while codegen function args");
@@ -162,6 +533,11 @@ class GenIRVisitor : public ASTVisitor {
     }
 
     virtual void Visit(StatementCallExprAST &E) override {
+        if (E.GetCallee() == "write" || E.GetCallee() == "writeln") {
+            EmitWrite(E.GetArgs(), E.GetCallee() == "writeln");
+            return;
+        }
+
         Function *CalleeF = TheModule->getFunction(E.GetCallee());
         if (!CalleeF) {
             LogError("Could not find function");
@@ -177,6 +553,12 @@ class GenIRVisitor : public ASTVisitor {
         std::vector<Value *> ArgsV;
         for (unsigned i = 0, e = Args.size(); i != e; i++) {
             Args[i]->Accept(*this);
+            if (V) {
+                VarType ParamType =
+                    CalleeF->getArg(i)->getType()->isDoubleTy() ? TYPE_REAL
+                                                                : TYPE_INTEGER;
+                V = Convert(V, ExprType, ParamType);
+            }
             ArgsV.push_back(V);
             if (!ArgsV.back()) {
                 LogError("Error occurred while codegen function args");
@@ -195,9 +577,12 @@ class GenIRVisitor : public ASTVisitor {
             LogError("Failed to codegen cond");
             return;
         }
-        Value *CondV = V;
+        Value *CondV = Convert(V, ExprType, TYPE_BOOLEAN);
+        if (!CondV) {
+            return;
+        }
 
-        CondV = Builder.CreateICmpNE(CondV, ConstantInt::get(Int1Ty, 0.0));
+        CondV = Builder.CreateICmpNE(CondV, ConstantInt::get(Int64Ty, 0));
 
         Function *TheFunction = Builder.GetInsertBlock()->getParent();
 
@@ -238,14 +623,268 @@ class GenIRVisitor : public ASTVisitor {
         // Since we don't treat if/else as value exprs, we don't need a PHI node
     }
 
+    Constant *ReductionIdentity(ReductionOp Op, VarType T) {
+        if (T == TYPE_REAL) {
+            switch (Op) {
+                case REDUCE_ADD:
+                    return ConstantFP::get(DoubleTy, 0.0);
+                case REDUCE_MUL:
+                    return ConstantFP::get(DoubleTy, 1.0);
+                case REDUCE_MIN:
+                    return ConstantFP::getInfinity(DoubleTy, false);
+                case REDUCE_MAX:
+                    return ConstantFP::getInfinity(DoubleTy, true);
+            }
+        }
+        switch (Op) {
+            case REDUCE_ADD:
+                return ConstantInt::get(Int64Ty, 0);
+            case REDUCE_MUL:
+                return ConstantInt::get(Int64Ty, 1);
+            case REDUCE_MIN:
+                return ConstantInt::get(Int64Ty, INT64_MAX);
+            case REDUCE_MAX:
+                return ConstantInt::get(Int64Ty, INT64_MIN);
+        }
+        return nullptr;
+    }
+
+    Value *Combine(ReductionOp Op, VarType T, Value *L, Value *R) {
+        bool Real = T == TYPE_REAL;
+        switch (Op) {
+            case REDUCE_ADD:
+                return Real ? Builder.CreateFAdd(L, R)
+                            : Builder.CreateAdd(L, R);
+            case REDUCE_MUL:
+                return Real ? Builder.CreateFMul(L, R)
+                            : Builder.CreateMul(L, R);
+            case REDUCE_MIN:
+                return Builder.CreateSelect(Real ? Builder.CreateFCmpOLT(L, R)
+                                                 : Builder.CreateICmpSLT(L, R),
+                                            L, R);
+            case REDUCE_MAX:
+                return Builder.CreateSelect(Real ? Builder.CreateFCmpOGT(L, R)
+                                                 : Builder.CreateICmpSGT(L, R),
+                                            L, R);
+        }
+        return nullptr;
+    }
+
+    // Outlines the body of a parallel for into
+    //   void <procedure>.par(ptr Env, i64 Lo, i64 Hi)
+    // which runs iterations [Lo, Hi). Env holds a pointer to every variable
+    // of the enclosing procedure, in the order of Captured. Reductions
+    // accumulate into private copies that are merged under a lock once per
+    // call, so workers only synchronize once per chunk.
+    Function *EmitLoopBody(ForStatementAST &S,
+                           const std::vector<std::string> &Captured,
+                           ArrayType *EnvTy, StringRef ParentName) {
+        LLVMContext &Ctx = TheModule->getContext();
+        Type *VoidTy = Type::getVoidTy(Ctx);
+        FunctionType *FT =
+            FunctionType::get(VoidTy, {PtrTy, Int64Ty, Int64Ty}, false);
+        Function *Body = Function::Create(FT, Function::InternalLinkage,
+                                          ParentName + ".par", TheModule);
+        Argument *Env = Body->getArg(0);
+        Argument *Lo = Body->getArg(1);
+        Argument *Hi = Body->getArg(2);
+        Env->setName("env");
+        Lo->setName("lo");
+        Hi->setName("hi");
+
+        IRBuilderBase::InsertPoint SavedIP = Builder.saveIP();
+        std::map<std::string, Variable> SavedValues = NamedValues;
+
+        Builder.SetInsertPoint(BasicBlock::Create(Ctx, "entry", Body));
+        for (unsigned i = 0; i < Captured.size(); i++) {
+            Variable &Var = NamedValues[Captured[i]];
+            Var.Ptr = Builder.CreateLoad(
+                PtrTy, Builder.CreateConstInBoundsGEP2_32(EnvTy, Env, 0, i),
+                Captured[i] + ".ptr");
+        }
+
+        std::vector<Value *> Shared;
+        for (auto &R : S.GetReductions()) {
+            Variable &Var = NamedValues[R.VarName];
+            Shared.push_back(Var.Ptr);
+            AllocaInst *Private =
+                CreateEntryBlockAlloca(Body, R.VarName, GetType(Var.Type));
+            Builder.CreateStore(ReductionIdentity(R.Op, Var.Type), Private);
+            Var.Ptr = Private;
+        }
+        for (auto &Name : S.GetPrivates()) {
+            auto It = NamedValues.find(Name);
+            if (It != NamedValues.end()) {
+                It->second.Ptr = CreateEntryBlockAlloca(
+                    Body, Name, GetType(It->second.Type));
+            }
+        }
+
+        AllocaInst *IndVar =
+            CreateEntryBlockAlloca(Body, S.GetVarName(), Int64Ty);
+        Builder.CreateStore(Lo, IndVar);
+        NamedValues[S.GetVarName()] = {IndVar, TYPE_INTEGER};
+
+        BasicBlock *CondBB = BasicBlock::Create(Ctx, "loopcond", Body);
+        BasicBlock *LoopBB = BasicBlock::Create(Ctx, "loop", Body);
+        BasicBlock *AfterBB = BasicBlock::Create(Ctx, "afterloop", Body);
+        Builder.CreateBr(CondBB);
+
+        Builder.SetInsertPoint(CondBB);
+        Value *CurVar = Builder.CreateLoad(Int64Ty, IndVar, S.GetVarName());
+        Builder.CreateCondBr(Builder.CreateICmpSLT(CurVar, Hi), LoopBB,
+                             AfterBB);
+
+        Builder.SetInsertPoint(LoopBB);
+        S.GetBody().Accept(*this);
+        bool Failed = !V;
+        if (!Failed) {
+            CurVar = Builder.CreateLoad(Int64Ty, IndVar, S.GetVarName());
+            Builder.CreateStore(
+                Builder.CreateNSWAdd(CurVar, ConstantInt::get(Int64Ty, 1)),
+                IndVar);
+            Builder.CreateBr(CondBB);
+
+            Builder.SetInsertPoint(AfterBB);
+            if (!Shared.empty()) {
+                Builder.CreateCall(
+                    GetRuntimeFunction("mp_reduce_lock", VoidTy, {}));
+                for (unsigned i = 0; i < Shared.size(); i++) {
+                    const Reduction &R = S.GetReductions()[i];
+                    Variable &Var = NamedValues[R.VarName];
+                    Type *Ty = GetType(Var.Type);
+                    Value *Total = Combine(R.Op, Var.Type,
+                                           Builder.CreateLoad(Ty, Shared[i]),
+                                           Builder.CreateLoad(Ty, Var.Ptr));
+                    Builder.CreateStore(Total, Shared[i]);
+                }
+                Builder.CreateCall(
+                    GetRuntimeFunction("mp_reduce_unlock", VoidTy, {}));
+            }
+            Builder.CreateRetVoid();
+        }
+
+        NamedValues = std::move(SavedValues);
+        Builder.restoreIP(SavedIP);
+
+        if (Failed) {
+            LogError("Error generating body code in parallel for loop");
+            Body->eraseFromParent();
+            return nullptr;
+        }
+
+        verifyFunction(*Body);
+        RunPasses(*Body);
+        return Body;
+    }
+
+    void EmitParallelFor(ForStatementAST &S) {
+        Function *TheFunction = Builder.GetInsertBlock()->getParent();
+
+        // Unlike the sequential loop, the bounds are evaluated once up front
+        S.GetStart().Accept(*this);
+        Value *StartV = V ? Convert(V, ExprType, TYPE_INTEGER) : nullptr;
+        if (!StartV) {
+            LogError("Failed to codegen start");
+            return;
+        }
+        S.GetEnd().Accept(*this);
+        Value *EndV = V ? Convert(V, ExprType, TYPE_INTEGER) : nullptr;
+        if (!EndV) {
+            LogError("Failed to codegen end");
+            return;
+        }
+        // The sequential loop tests its bound after the body, so it runs
+        // at least once even when End is below Start
+        EndV = Builder.CreateSelect(Builder.CreateICmpSLT(EndV, StartV),
+                                    StartV, EndV);
+
+        for (auto &R : S.GetReductions()) {
+            auto It = NamedValues.find(R.VarName);
+            if (It == NamedValues.end()) {
+                LogError("Unknown reduction variable");
+                V = nullptr;
+                return;
+            }
+            if (It->second.Type == TYPE_BOOLEAN) {
+                LogError("Reduction variables must be integers or reals");
+                V = nullptr;
+                return;
+            }
+        }
+
+        // The body shares every variable in scope with the procedure
+        std::vector<std::string> Captured;
+        for (auto &[Name, Var] : NamedValues) {
+            Captured.push_back(Name);
+        }
+        ArrayType *EnvTy = ArrayType::get(PtrTy, Captured.size());
+        AllocaInst *Env = CreateEntryBlockAlloca(TheFunction, "env", EnvTy);
+        for (unsigned i = 0; i < Captured.size(); i++) {
+            Builder.CreateStore(
+                NamedValues[Captured[i]].Ptr,
+                Builder.CreateConstInBoundsGEP2_32(EnvTy, Env, 0, i));
+        }
+
+        Function *Body =
+            EmitLoopBody(S, Captured, EnvTy, TheFunction->getName());
+        if (!Body) {
+            V = nullptr;
+            return;
+        }
+
+        // End is inclusive, as in the sequential loop
+        Type *VoidTy = Type::getVoidTy(TheModule->getContext());
+        Value *One = ConstantInt::get(Int64Ty, 1);
+        FunctionCallee ParallelFor = GetRuntimeFunction(
+            "mp_parallel_for", VoidTy, {PtrTy, PtrTy, Int64Ty, Int64Ty});
+        if (S.GetMinTrips() <= 0) {
+            V = Builder.CreateCall(
+                ParallelFor,
+                {Body, Env, StartV, Builder.CreateNSWAdd(EndV, One)});
+            return;
+        }
+
+        // Short loops are not worth waking the pool for, so they call the
+        // body directly
+        LLVMContext &Ctx = TheModule->getContext();
+        BasicBlock *ParallelBB =
+            BasicBlock::Create(Ctx, "parallel", TheFunction);
+        BasicBlock *SerialBB = BasicBlock::Create(Ctx, "serial", TheFunction);
+        BasicBlock *AfterBB = BasicBlock::Create(Ctx, "afterloop", TheFunction);
+        Value *Trips = Builder.CreateSub(EndV, StartV);
+        Builder.CreateCondBr(
+            Builder.CreateICmpSGE(
+                Trips, ConstantInt::get(Int64Ty, S.GetMinTrips() - 1)),
+            ParallelBB, SerialBB);
+
+        Builder.SetInsertPoint(ParallelBB);
+        Builder.CreateCall(ParallelFor, {Body, Env, StartV,
+                                         Builder.CreateNSWAdd(EndV, One)});
+        Builder.CreateBr(AfterBB);
+
+        Builder.SetInsertPoint(SerialBB);
+        Builder.CreateCall(Body->getFunctionType(), Body,
+                           {Env, StartV, Builder.CreateNSWAdd(EndV, One)});
+        Builder.CreateBr(AfterBB);
+
+        Builder.SetInsertPoint(AfterBB);
+        V = Trips;
+    }
+
     virtual void Visit(ForStatementAST &S) override {
+        if (S.IsParallel()) {
+            EmitParallelFor(S);
+            return;
+        }
+
         Function *TheFunction = Builder.GetInsertBlock()->getParent();
 
         AllocaInst *Alloca =
-            CreateEntryBlockAlloca(TheFunction, S.GetVarName());
+            CreateEntryBlockAlloca(TheFunction, S.GetVarName(), Int64Ty);
 
         S.GetStart().Accept(*this);
-        Value *StartV = V;
+        Value *StartV = V ? Convert(V, ExprType, TYPE_INTEGER) : nullptr;
         if (!StartV) {
             LogError("Failed to codegen start");
             return;
@@ -263,8 +902,12 @@ class GenIRVisitor : public ASTVisitor {
         Builder.SetInsertPoint(LoopBB);
 
         // load the new value and shadow the old value
-        AllocaInst *OldAlloca = NamedValues[S.GetVarName()];
-        NamedValues[S.GetVarName()] = Alloca;
+        auto Old = NamedValues.find(S.GetVarName());
+        std::optional<Variable> OldVar;
+        if (Old != NamedValues.end()) {
+            OldVar = Old->second;
+        }
+        NamedValues[S.GetVarName()] = {Alloca, TYPE_INTEGER};
 
         S.GetBody().Accept(*this);
         if (!V) {
@@ -280,10 +923,13 @@ class GenIRVisitor : public ASTVisitor {
             LogError("Failed to codegen end cond");
             return;
         }
-        Value *EndCond = V;
+        Value *EndCond = Convert(V, ExprType, TYPE_INTEGER);
+        if (!EndCond) {
+            return;
+        }
 
-        Value *CurVar = Builder.CreateLoad(Alloca->getAllocatedType(), Alloca,
-                                           S.GetVarName().c_str());
+        Value *CurVar =
+            Builder.CreateLoad(Int64Ty, Alloca, S.GetVarName().c_str());
         Value *NextVar = Builder.CreateNSWAdd(CurVar, StepV, "nextvar");
         Builder.CreateStore(NextVar, Alloca);
 
@@ -298,8 +944,8 @@ class GenIRVisitor : public ASTVisitor {
 
         Builder.SetInsertPoint(AfterBB);
 
-        if (OldAlloca) {
-            NamedValues[S.GetVarName()] = OldAlloca;
+        if (OldVar) {
+            NamedValues[S.GetVarName()] = *OldVar;
         } else {
             NamedValues.erase(S.GetVarName());
         }
@@ -315,27 +961,29 @@ class GenIRVisitor : public ASTVisitor {
             return;
         }
 
-        Value *Variable = NamedValues[S.GetVarName()];
-        if (!Variable) {
+        auto It = NamedValues.find(S.GetVarName());
+        if (It == NamedValues.end()) {
             LogError("Unknown variable");
             return;
         }
-        Builder.CreateStore(Val, Variable);
+        Val = Convert(Val, ExprType, It->second.Type);
+        if (!Val) {
+            return;
+        }
+        Builder.CreateStore(Val, It->second.Ptr);
     }
 
     virtual void Visit(VariableDeclAST &S) override {
-        std::vector<AllocaInst *> OldBindings;
-
         Function *F = Builder.GetInsertBlock()->getParent();
+        Type *Ty = GetType(S.GetType());
 
         for (int i = 0; i < S.GetVarNames().size(); i++) {
             const std::string &VarName = S.GetVarNames()[i];
-            Value *InitVal = ConstantInt::get(Int64Ty, 0, true);
+            Value *InitVal = Constant::getNullValue(Ty);
 
-            AllocaInst *Alloca = CreateEntryBlockAlloca(F, VarName);
+            AllocaInst *Alloca = CreateEntryBlockAlloca(F, VarName, Ty);
             Builder.CreateStore(InitVal, Alloca);
-            OldBindings.push_back(NamedValues[VarName]);
-            NamedValues[VarName] = Alloca;
+            NamedValues[VarName] = {Alloca, S.GetType()};
         }
     }
 
@@ -351,6 +999,9 @@ class GenIRVisitor : public ASTVisitor {
                 case TYPE_BOOLEAN:
                     CurrentType = Type::getInt64Ty(TheModule->getContext());
                     break;
+                case TYPE_REAL:
+                    CurrentType = Type::getDoubleTy(TheModule->getContext());
+                    break;
                 default:
                     LogError("Unknown parameter type");
                     return;
@@ -415,38 +1066,40 @@ class GenIRVisitor : public ASTVisitor {
             BasicBlock::Create(TheModule->getContext(), "entry", TheFunction);
         Builder.SetInsertPoint(BB);
         NamedValues.clear();
+        std::vector<VarType> ParamTypes;
+        for (auto &Decl : Func.GetPrototype().GetParameters()) {
+            ParamTypes.insert(ParamTypes.end(), Decl->GetVarNames().size(),
+                              Decl->GetType());
+        }
         for (auto &Arg : TheFunction->args()) {
-            AllocaInst *Alloca =
-                CreateEntryBlockAlloca(TheFunction, Arg.getName().str());
+            AllocaInst *Alloca = CreateEntryBlockAlloca(
+                TheFunction, Arg.getName().str(), Arg.getType());
 
             Builder.CreateStore(&Arg, Alloca);
 
-            NamedValues[std::string(Arg.getName())] = Alloca;
+            NamedValues[std::string(Arg.getName())] = {
+                Alloca, ParamTypes[Arg.getArgNo()]};
         }
 
+        EmitProfileEnter(Func.GetPrototype().GetName());
+
         Func.GetBody().Accept(*this);
         if (!V) {
             LogError("Error while generating function body");
             TheFunction->eraseFromParent();
             return;
         }
-        Builder.CreateRet(V);
+        EmitProfileExit();
+        Builder.CreateRetVoid();
         verifyFunction(*TheFunction);
 
-        TheFPM->run(*TheFunction, *TheFAM);
+        RunPasses(*TheFunction);
 
         F = TheFunction;
     }
 
+    // Streamed programs have had their procedures generated already
     virtual void Visit(ProgramAST &P) override {
-        // Create prototype for writeln() from runtime.c
-        FunctionType *WriteLnTy = FunctionType::get(
-            Type::getVoidTy(TheModule->getContext()),
-            {Type::getInt64Ty(TheModule->getContext())}, false);
-
-        Function *WriteLn = Function::Create(
-            WriteLnTy, Function::ExternalLinkage, "writeln", TheModule);
-
         for (auto &Func : P.GetFunctions()) {
             Func->Accept(*this);
         }
@@ -459,63 +1112,408 @@ class GenIRVisitor : public ASTVisitor {
             BasicBlock::Create(TheModule->getContext(), "entry", MainFn);
 
         Builder.SetInsertPoint(BB);
+        // Not a valid identifier, so it cannot clash with a procedure
+        EmitProfileEnter("(main)");
 
         P.GetBlock().Accept(*this);
 
-        Builder.CreateRet(ConstantInt::get(
-            Type::getInt32Ty(TheModule->getContext()), 0, true));
+        EmitProfileExit();
+        if (Profiling()) {
+            Value *JSONPath =
+                ProfileJSON.empty()
+                    ? Constant::getNullValue(PtrTy)
+                    : Builder.CreateGlobalString(ProfileJSON, ".profjson");
+            Builder.CreateCall(
+                GetRuntimeFunction("mp_profile_report",
+                                   Type::getVoidTy(TheModule->getContext()),
+                                   {PtrTy, PtrTy}),
+                {Builder.CreateGlobalString(P.GetName(), ".profprogram"),
+                 JSONPath});
+        }
+        Builder.CreateRetVoid();
 
-        TheFPM->run(*MainFn, *TheFAM);
+        RunPasses(*MainFn);
 
         F = MainFn;
     }
 };
 
-void CodeGen::CompileAndRun(std::unique_ptr<AST> Ast,
-                            llvm::orc::KaleidoscopeJIT &TheJIT) {
-    std::unique_ptr<LLVMContext> TheContext = std::make_unique<LLVMContext>();
-    M = std::make_unique<Module>("micropascal.tl", *TheContext);
-
-    M->setDataLayout(TheJIT.getDataLayout());
-
-    std::unique_ptr<FunctionPassManager> FPM =
-        std::make_unique<FunctionPassManager>();
-    std::unique_ptr<LoopAnalysisManager> LAM =
-        std::make_unique<LoopAnalysisManager>();
-    std::unique_ptr<FunctionAnalysisManager> FAM =
-        std::make_unique<FunctionAnalysisManager>();
-    std::unique_ptr<CGSCCAnalysisManager> CGAM =
-        std::make_unique<CGSCCAnalysisManager>();
-    std::unique_ptr<ModuleAnalysisManager> MAM =
-        std::make_unique<ModuleAnalysisManager>();
-    std::unique_ptr<PassInstrumentationCallbacks> PIC =
-        std::make_unique<PassInstrumentationCallbacks>();
-    std::unique_ptr<StandardInstrumentations> SI =
-        std::make_unique<StandardInstrumentations>(*TheContext, true);
-
-    GenIRVisitor GenIR(M.get(), std::move(FPM), std::move(LAM), std::move(FAM),
-                       std::move(CGAM), std::move(MAM), std::move(PIC),
-                       std::move(SI));
-    std::cerr
-        << "============================   IR   ============================\n";
-    GenIR.run(std::move(Ast));
+std::vector<ProcedureBitcode> SplitPerProcedure(Module &M) {
+    std::vector<ProcedureBitcode> Parts;
+    for (Function &F : M) {
+        if (F.isDeclaration() || F.hasLocalLinkage()) {
+            continue;
+        }
+
+        // Internal definitions such as inlined runtime helpers cannot be
+        // referenced across modules, so every part gets its own copy
+        ValueToValueMapTy VMap;
+        std::unique_ptr<Module> Part =
+            CloneModule(M, VMap, [&](const GlobalValue *GV) {
+                return GV == &F || GV->hasLocalLinkage();
+            });
+
+        ProcedureBitcode PB;
+        PB.Name = F.getName().str();
+        raw_svector_ostream OS(PB.Bitcode);
+        WriteBitcodeToFile(*Part, OS);
+        Parts.push_back(std::move(PB));
+    }
+    return Parts;
+}
+
+Expected<orc::ThreadSafeModule> LoadBitcode(const ProcedureBitcode &PB) {
+    auto Ctx = std::make_unique<LLVMContext>();
+    auto Parsed = parseBitcodeFile(
+        MemoryBufferRef(StringRef(PB.Bitcode.data(), PB.Bitcode.size()),
+                        PB.Name),
+        *Ctx);
+    if (!Parsed) {
+        return Parsed.takeError();
+    }
+    return orc::ThreadSafeModule(std::move(*Parsed), std::move(Ctx));
+}
+
+void CodeGen::Generate(std::unique_ptr<AST> Ast, const DataLayout &DL,
+                       bool RunFunctionPasses, TargetMachine *TM) {
+    GenerateModule({Ast.get()}, false, DL, RunFunctionPasses, TM);
+}
+
+void CodeGen::GenerateProcedures(
+    const std::vector<std::unique_ptr<FunctionAST>> &Procedures,
+    const DataLayout &DL, TargetMachine *TM) {
+    std::vector<AST *> Roots;
+    for (auto &Func : Procedures) {
+        Roots.push_back(Func.get());
+    }
+    GenerateModule(Roots, true, DL, true, TM);
+}
+
+CompilerSession::CompilerSession(std::unique_ptr<TargetMachine> TM,
+                                 unsigned ProgramsPerContext)
+    : TM(std::move(TM)),
+      ProgramsPerContext(std::max(ProgramsPerContext, 1u)) {}
+
+CompilerSession::~CompilerSession() = default;
+
+CodeGenPasses &CompilerSession::Prepare() {
+    if (!Passes || Programs == ProgramsPerContext) {
+        // Modules still in the JIT keep the old context alive
+        Passes.reset();
+        Context = orc::ThreadSafeContext(std::make_unique<LLVMContext>());
+        Passes = std::make_unique<CodeGenPasses>(*Context.getContext(),
+                                                 TM.get());
+        Programs = 0;
+    }
+    Programs++;
+    return *Passes;
+}
+
+CodeGen::CodeGen(CompilerSession *Session) : Session(Session) {}
+
+CodeGen::~CodeGen() = default;
+
+void CodeGen::GenerateModule(ArrayRef<AST *> Roots, bool ArgsThunks,
+                             const DataLayout &DL, bool RunFunctionPasses,
+                             TargetMachine *TM) {
+    StartModule(DL, RunFunctionPasses, TM);
+    for (AST *Root : Roots) {
+        Root->Accept(*GenIR);
+    }
+    FinishModule(ArgsThunks);
+}
+
+void CodeGen::StartModule(const DataLayout &DL, bool RunFunctionPasses,
+                          TargetMachine *TM) {
+    // A module left from the last program must go before its context can
+    M.reset();
+    if (Session) {
+        Passes = &Session->Prepare();
+        TheContext = Session->Context;
+        TM = &Session->GetTargetMachine();
+    } else {
+        TheContext = orc::ThreadSafeContext(std::make_unique<LLVMContext>());
+        OwnPasses =
+            std::make_unique<CodeGenPasses>(*TheContext.getContext(), TM);
+        Passes = OwnPasses.get();
+    }
+    ContextLock.emplace(TheContext.getLock());
+    M = std::make_unique<Module>("micropascal.tl", *TheContext.getContext());
+
+    M->setDataLayout(DL);
+    if (TM) {
+        M->setTargetTriple(TM->getTargetTriple().str());
+    }
+
+    GenIR = std::make_unique<GenIRVisitor>(M.get(), *Passes, RunFunctionPasses);
+    GenIR->DeclareExternalProcedures(ExternalProcedures);
+    if (Verbose) {
+        std::cerr << "============================   IR   "
+                     "============================\n";
+    }
+}
+
+void CodeGen::FinishModule(bool ArgsThunks) {
+    GenIR->Finish(ArgsThunks, Verbose);
+    Timings.Optimize = GenIR->GetPassSeconds();
     // M->print(outs(), nullptr);
+    EndModule();
+}
 
-    auto RT = TheJIT.getMainJITDylib().createResourceTracker();
+void CodeGen::EndModule() {
+    GenIR.reset();
+    Passes->Clear();
+    OwnPasses.reset();
+    ContextLock.reset();
+}
 
-    auto TSM = llvm::orc::ThreadSafeModule(std::move(M), std::move(TheContext));
+void CodeGen::AddProcedure(std::unique_ptr<FunctionAST> Func) {
+    if (ProcedureJIT) {
+        return LinkProcedure(std::move(Func));
+    }
+    Func->Accept(*GenIR);
+}
 
-    llvm::ExitOnError ExitOnErr;
-    ExitOnErr(TheJIT.addModule(std::move(TSM), RT));
+void CodeGen::LinkProcedure(std::unique_ptr<FunctionAST> Func) {
+    const PrototypeAST &Proto = Func->GetPrototype();
+    std::string Name = Proto.GetName();
+    // The module would only see the declaration of the earlier one
+    if (LinkedProcedures.count(Name)) {
+        LogError("Function cannot be redefined");
+        return;
+    }
+    std::vector<VarType> Params;
+    for (auto &Decl : Proto.GetParameters()) {
+        Params.insert(Params.end(), Decl->GetVarNames().size(),
+                      Decl->GetType());
+    }
 
-    auto ExprSymbol = ExitOnErr(TheJIT.lookup("micropascal_main"));
+    auto Part = std::make_unique<Module>(Name, *TheContext.getContext());
+    Part->setDataLayout(M->getDataLayout());
+    Part->setTargetTriple(M->getTargetTriple());
+    GenIR->SetModule(Part.get());
+    GenIR->DeclareExternalProcedures(ExternalProcedures);
+    GenIR->DeclareExternalProcedures(LinkedProcedures);
+    Func->Accept(*GenIR);
+    Func.reset();
+    GenIR->Finish(false, Verbose);
+    GenIR->SetModule(M.get());
+    // The part is freed once it has been compiled
+    Passes->Clear();
+
+    Function *Fn = Part->getFunction(Name);
+    if (!Fn || Fn->isDeclaration()) {
+        // Its error has been reported
+        return;
+    }
+    LinkedProcedures[Name] = std::move(Params);
+
+    // The JIT may compile the part on one of its own threads, which takes
+    // the context lock
+    ExitOnError ExitOnErr;
+    ContextLock.reset();
+    ExitOnErr(ProcedureJIT->addModule(
+        orc::ThreadSafeModule(std::move(Part), TheContext), ProcedureRT));
+    ExitOnErr(ProcedureJIT->lookup(ProcedureRT->getJITDylib(), Name));
+    ContextLock.emplace(TheContext.getLock());
+}
+
+std::unique_ptr<ProgramAST> CodeGen::GenerateStreamed(
+    const ProgramStream &Stream, const DataLayout &DL, bool RunFunctionPasses,
+    TargetMachine *TM) {
+    StartModule(DL, RunFunctionPasses, TM);
+    std::unique_ptr<ProgramAST> P = Stream(*this);
+    if (!P) {
+        // The procedures generated so far will not be run
+        EndModule();
+        M.reset();
+        return nullptr;
+    }
+    GenIR->DeclareExternalProcedures(LinkedProcedures);
+    P->Accept(*GenIR);
+    FinishModule(false);
+    return P;
+}
+
+orc::ThreadSafeModule CodeGen::TakeModule() {
+    return orc::ThreadSafeModule(std::move(M), TheContext);
+}
+
+void CodeGen::DeclareProcedure(const std::string &Name,
+                               const std::vector<VarType> &Params) {
+    ExternalProcedures[Name] = Params;
+}
 
-    std::cerr << "\n";
-    std::cerr
-        << "============================ Result ============================\n";
+void CodeGen::CompileAndRun(std::unique_ptr<ProgramAST> Program,
+                            llvm::orc::KaleidoscopeJIT &TheJIT,
+                            llvm::orc::JITDylib *JD) {
+    CompileAndRun([&Program](CodeGen &) { return std::move(Program); },
+                  TheJIT, JD);
+}
+
+void CodeGen::CompileAndRun(const ProgramStream &Stream,
+                            llvm::orc::KaleidoscopeJIT &TheJIT,
+                            llvm::orc::JITDylib *JD) {
+    assert(!(Tiered && JD) && "Tiered programs run in the main JITDylib");
+    if (!JD) {
+        JD = &TheJIT.getMainJITDylib();
+    }
+
+    llvm::ExitOnError ExitOnErr;
+    auto RT = JD->createResourceTracker();
+    std::unique_ptr<TieredProgram> TP;
+    std::unique_ptr<ProfiledProgram> PP;
+    orc::ExecutorAddr Main = Load(Stream, TheJIT, RT, TP, PP);
+    if (!Main) {
+        // Procedures may have been linked before the error
+        ExitOnErr(RT->remove());
+        return;
+    }
+
+    if (Verbose) {
+        std::cerr << "\n";
+        std::cerr << "============================ Result "
+                     "============================\n";
+    }
     // Execute the main function
-    void (*FP)() = ExprSymbol.getAddress().toPtr<void (*)()>();
+    void (*FP)() = Main.toPtr<void (*)()>();
+    auto Start = std::chrono::steady_clock::now();
     FP();
-
+    mp_flush();
+    std::chrono::duration<double> Elapsed =
+        std::chrono::steady_clock::now() - Start;
+    Timings.Execute = Elapsed.count();
+
+    // Background re-optimizations still reference the program's tracker
+    if (TP) {
+        TP->WaitForPromotions();
+    }
+    if (PP) {
+        ExitOnErr(PP->WriteProfile());
+    }
     ExitOnErr(RT->remove());
 }
+
+orc::ExecutorAddr CodeGen::Link(const ProgramStream &Stream,
+                                orc::KaleidoscopeJIT &TheJIT,
+                                orc::ResourceTrackerSP RT) {
+    // Their state lives until the program has run, which is not up to Link
+    if (Tiered || PGO != PGO_OFF) {
+        LogError("Tiered and PGO programs can only be compiled to be run");
+        return orc::ExecutorAddr();
+    }
+    std::unique_ptr<TieredProgram> TP;
+    std::unique_ptr<ProfiledProgram> PP;
+    return Load(Stream, TheJIT, std::move(RT), TP, PP);
+}
+
+orc::ExecutorAddr CodeGen::Load(const ProgramStream &Stream,
+                                orc::KaleidoscopeJIT &TheJIT,
+                                orc::ResourceTrackerSP RT,
+                                std::unique_ptr<TieredProgram> &TP,
+                                std::unique_ptr<ProfiledProgram> &PP) {
+    using Clock = std::chrono::steady_clock;
+    auto Since = [](Clock::time_point Start) {
+        return std::chrono::duration<double>(Clock::now() - Start).count();
+    };
+
+    llvm::ExitOnError ExitOnErr;
+    orc::JITDylib &JD = RT->getJITDylib();
+    Clock::time_point Start = Clock::now();
+    std::unique_ptr<TargetMachine> OwnTM;
+    TargetMachine *TM;
+    if (Session) {
+        TM = &Session->GetTargetMachine();
+    } else {
+        OwnTM = ExitOnErr(TheJIT.createTargetMachine());
+        TM = OwnTM.get();
+    }
+    bool WholeModule = Tiered || PGO != PGO_OFF;
+    if (!WholeModule) {
+        ProcedureJIT = &TheJIT;
+        ProcedureRT = RT;
+    }
+    std::unique_ptr<ProgramAST> Program = GenerateStreamed(
+        Stream, TheJIT.getDataLayout(), !WholeModule, TM);
+    ProcedureJIT = nullptr;
+    ProcedureRT = nullptr;
+    LinkedProcedures.clear();
+    if (!Program) {
+        return orc::ExecutorAddr();
+    }
+    if (PGO != PGO_OFF) {
+        SmallString<128> Path(PGODir);
+        sys::path::append(Path, Program->GetName() + ".profdata");
+        PP = std::make_unique<ProfiledProgram>(Path.str().str(), PGO);
+        if (auto Err = PP->Optimize(*M, *TM)) {
+            LogError(toString(std::move(Err)).c_str());
+            PP.reset();
+            return orc::ExecutorAddr();
+        }
+    }
+    Program.reset();
+    Timings.Codegen = Since(Start);
+    Start = Clock::now();
+
+    if (Tiered) {
+        TP = std::make_unique<TieredProgram>(TheJIT, RT, TierOptLevel,
+                                             TierThreshold);
+        ExitOnErr(TP->Add(TakeModule()));
+    } else if (TheJIT.getMaterializationThreads() > 1) {
+        std::vector<std::string> Names;
+        for (auto &PB : SplitPerProcedure(*M)) {
+            ExitOnErr(TheJIT.addModule(ExitOnErr(LoadBitcode(PB)), RT));
+            Names.push_back(PB.Name);
+        }
+        ExitOnErr(TheJIT.materialize(JD, Names));
+    } else {
+        ExitOnErr(TheJIT.addModule(TakeModule(), RT));
+    }
+
+    auto ExprSymbol = ExitOnErr(TheJIT.lookup(JD, "micropascal_main"));
+    Timings.Link = Since(Start);
+    return ExprSymbol.getAddress();
+}
+
+void CodeGen::CompileToFile(std::unique_ptr<AST> Ast, TargetMachine &TM,
+                            EmitKind Kind, const std::string &Path) {
+    using Clock = std::chrono::steady_clock;
+    auto Since = [](Clock::time_point Start) {
+        return std::chrono::duration<double>(Clock::now() - Start).count();
+    };
+
+    llvm::ExitOnError ExitOnErr;
+    Clock::time_point Start = Clock::now();
+    Generate(std::move(Ast), TM.createDataLayout(), true, &TM);
+    Timings.Codegen = Since(Start);
+
+    Start = Clock::now();
+    ExitOnErr(EmitModule(*M, TM, Kind, Path));
+    Timings.Link = Since(Start);
+    std::cerr << "Wrote " << Path << "\n";
+}
+
+void CodeGen::CompileToFile(
+    const ProgramStream &Stream, TargetMachine &TM, EmitKind Kind,
+    const std::function<std::string(const ProgramAST &)> &OutputPath) {
+    using Clock = std::chrono::steady_clock;
+    auto Since = [](Clock::time_point Start) {
+        return std::chrono::duration<double>(Clock::now() - Start).count();
+    };
+
+    llvm::ExitOnError ExitOnErr;
+    Clock::time_point Start = Clock::now();
+    std::unique_ptr<ProgramAST> Program =
+        GenerateStreamed(Stream, TM.createDataLayout(), true, &TM);
+    if (!Program) {
+        return;
+    }
+    std::string Path = OutputPath(*Program);
+    Program.reset();
+    Timings.Codegen = Since(Start);
+
+    Start = Clock::now();
+    ExitOnErr(EmitModule(*M, TM, Kind, Path));
+    Timings.Link = Since(Start);
+    std::cerr << "Wrote " << Path << "\n";
+}
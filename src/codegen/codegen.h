@@ -1,14 +1,245 @@
 #ifndef CODEGEN_H
 #define CODEGEN_H
 
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "aot/aot.h"
 #include "ast/ast.h"
 #include "kaleidoscopejit/KaleidoscopeJIT.h"
 
+// Procedure name -> parameter types
+typedef std::map<std::string, std::vector<VarType>> ProcedureTable;
+
+struct ProcedureBitcode {
+    std::string Name;
+    llvm::SmallVector<char, 0> Bitcode;
+};
+
+/**
+ * Checks the codegen options for values and combinations that no program
+ * can be compiled with, reporting them through LogError. CompileAndRun says
+ * whether programs will go through CodeGen::CompileAndRun, the only path
+ * that tiers or uses profiles, rather than --session, --aot or another
+ * --exec.
+ * ProgramJITDylibs says whether programs will run in JITDylibs of their own.
+ * Returns false if there were any errors.
+ */
+bool CheckCodeGenOptions(bool CompileAndRun, bool ProgramJITDylibs);
+
+/**
+ * Splits M into one bitcode module per defined function. Procedures all have
+ * external linkage, so every part resolves its callees through the JIT.
+ */
+std::vector<ProcedureBitcode> SplitPerProcedure(llvm::Module &M);
+
+/**
+ * Loads a part produced by SplitPerProcedure into a fresh context, so that
+ * parts can be compiled on separate threads.
+ */
+llvm::Expected<llvm::orc::ThreadSafeModule> LoadBitcode(
+    const ProcedureBitcode &);
+
+/**
+ * Wall-clock seconds spent in each phase of compiling and running a program.
+ * Optimize is the part of Codegen spent in the function passes and the
+ * inlining of runtime helpers after them. Link covers JIT compilation of
+ * the optimized module, or for --aot emitting and linking the output.
+ */
+struct PhaseTimings {
+    double Parse = 0;
+    double Codegen = 0;
+    double Optimize = 0;
+    double Link = 0;
+    double Execute = 0;
+};
+
+struct CodeGenPasses;
+class GenIRVisitor;
+class CodeGen;
+class TieredProgram;
+class ProfiledProgram;
+
+/**
+ * Produces a program for CodeGen to compile, after handing its procedures
+ * to CodeGen::AddProcedure one at a time, e.g. as the parser finishes each
+ * of them. Returns null, with the error reported, if there is no program.
+ */
+typedef std::function<std::unique_ptr<ProgramAST>(CodeGen &)> ProgramStream;
+
+/**
+ * What compiling a program takes besides the program: an LLVMContext, a
+ * TargetMachine, and the function pass pipeline with the analysis managers
+ * it runs with. Setting these up is a sizable part of compiling a small
+ * program, so a CodeGen given a session reuses the session's instead of
+ * building its own.
+ *
+ * The analyses cached while generating a program are cleared once its
+ * module is done. Types and constants are never freed from a context, so
+ * every ProgramsPerContext programs the session starts over with a new one;
+ * mpbench --programs-per-context shows what that costs.
+ * Modules share the context of the session they were generated in, so a
+ * session must only be used by one thread at a time.
+ */
+class CompilerSession {
+    friend class CodeGen;
+
+    std::unique_ptr<llvm::TargetMachine> TM;
+    llvm::orc::ThreadSafeContext Context;
+    std::unique_ptr<CodeGenPasses> Passes;
+    unsigned ProgramsPerContext;
+    unsigned Programs = 0;
+
+    // The passes for the next program, in a new context if it is time for
+    // one
+    CodeGenPasses &Prepare();
+
+   public:
+    static constexpr unsigned DefaultProgramsPerContext = 64;
+
+    explicit CompilerSession(
+        std::unique_ptr<llvm::TargetMachine> TM,
+        unsigned ProgramsPerContext = DefaultProgramsPerContext);
+    ~CompilerSession();
+
+    llvm::TargetMachine &GetTargetMachine() { return *TM; }
+};
+
 class CodeGen {
+    CompilerSession *Session;
+    llvm::orc::ThreadSafeContext TheContext;
+    // Held from StartModule to FinishModule
+    std::optional<llvm::orc::ThreadSafeContext::Lock> ContextLock;
     std::unique_ptr<llvm::Module> M;
+    std::unique_ptr<CodeGenPasses> OwnPasses;
+    CodeGenPasses *Passes = nullptr;
+    std::unique_ptr<GenIRVisitor> GenIR;
+    ProcedureTable ExternalProcedures;
+    PhaseTimings Timings;
+    bool Verbose = true;
+    // Where AddProcedure links each procedure as soon as it is generated,
+    // instead of leaving it in M, while a stream is being linked
+    llvm::orc::KaleidoscopeJIT *ProcedureJIT = nullptr;
+    llvm::orc::ResourceTrackerSP ProcedureRT;
+    // The procedures linked so far, declared in every module after them
+    ProcedureTable LinkedProcedures;
+
+    // A module is generated by StartModule, any number of visits through
+    // GenIR, and FinishModule, which links in the runtime and inlines.
+    // EndModule alone drops what the visits left behind.
+    void StartModule(const llvm::DataLayout &, bool RunFunctionPasses,
+                     llvm::TargetMachine *TM);
+    void FinishModule(bool ArgsThunks);
+    void EndModule();
+    void GenerateModule(llvm::ArrayRef<AST *> Roots, bool ArgsThunks,
+                        const llvm::DataLayout &, bool RunFunctionPasses,
+                        llvm::TargetMachine *TM);
+    std::unique_ptr<ProgramAST> GenerateStreamed(const ProgramStream &,
+                                                 const llvm::DataLayout &,
+                                                 bool RunFunctionPasses,
+                                                 llvm::TargetMachine *TM);
+    // Compiles the streamed program into RT's JITDylib and returns its entry
+    // point, or a null address if there is no program or it cannot be
+    // compiled, with the error reported. TP and PP are set for
+    // tiered and PGO programs and must outlive the run.
+    llvm::orc::ExecutorAddr Load(const ProgramStream &,
+                                 llvm::orc::KaleidoscopeJIT &,
+                                 llvm::orc::ResourceTrackerSP RT,
+                                 std::unique_ptr<TieredProgram> &TP,
+                                 std::unique_ptr<ProfiledProgram> &PP);
+    void LinkProcedure(std::unique_ptr<FunctionAST> Func);
 
    public:
-    void CompileAndRun(std::unique_ptr<AST>, llvm::orc::KaleidoscopeJIT &);
+    /**
+     * Generates code with the context, passes and TargetMachine of Session
+     * unless it is null, ignoring the TargetMachine passed to the methods
+     * below.
+     */
+    explicit CodeGen(CompilerSession *Session = nullptr);
+    ~CodeGen();
+
+    /**
+     * Whether to print each module's IR, and the banners around it and
+     * before the program's output, to stderr. They only make sense with one
+     * program at a time.
+     */
+    void SetVerbose(bool Print) { Verbose = Print; }
+
+    /**
+     * Makes a procedure defined outside of the program callable from it.
+     */
+    void DeclareProcedure(const std::string &Name,
+                          const std::vector<VarType> &Params);
+
+    void Generate(std::unique_ptr<AST>, const llvm::DataLayout &,
+                  bool RunFunctionPasses, llvm::TargetMachine *TM = nullptr);
+    llvm::Module &GetModule() { return *M; }
+
+    /**
+     * Generates the procedures alone, without a main program, leaving the
+     * ASTs to the caller. Each procedure also gets a "<name>.args" entry
+     * point, void(int64_t *Args), that reads its arguments from consecutive
+     * 8-byte slots: integers and booleans as int64_t, reals as double.
+     */
+    void GenerateProcedures(
+        const std::vector<std::unique_ptr<FunctionAST>> &Procedures,
+        const llvm::DataLayout &, llvm::TargetMachine *TM = nullptr);
+
+    /**
+     * Hands the generated module and its context over, e.g. to the JIT
+     */
+    llvm::orc::ThreadSafeModule TakeModule();
+
+    /**
+     * Links the program into JD, by default the JIT's main JITDylib, and
+     * runs it
+     */
+    void CompileAndRun(std::unique_ptr<ProgramAST>,
+                       llvm::orc::KaleidoscopeJIT &,
+                       llvm::orc::JITDylib *JD = nullptr);
+    const PhaseTimings &GetTimings() const { return Timings; }
+    void CompileToFile(std::unique_ptr<AST>, llvm::TargetMachine &, EmitKind,
+                       const std::string &);
+
+    /**
+     * Streaming versions of the above. Each procedure is generated and run
+     * through the function passes as soon as the stream hands it over, and
+     * its AST freed, instead of waiting for the whole program to be parsed.
+     * Only the main program is kept until the end. Codegen in the timings
+     * includes whatever the stream spends producing the program.
+     *
+     * Unless the program is tiered or compiled with PGO, which need the
+     * whole module, CompileAndRun also gives each procedure a module of its
+     * own and JIT-compiles it right away, so that its IR is freed too.
+     * Codegen then includes compiling the procedures, and Link only the main
+     * program. Files have to be emitted as one module, so CompileToFile
+     * keeps every procedure's IR until the end.
+     */
+    void CompileAndRun(const ProgramStream &, llvm::orc::KaleidoscopeJIT &,
+                       llvm::orc::JITDylib *JD = nullptr);
+    void CompileToFile(
+        const ProgramStream &, llvm::TargetMachine &, EmitKind,
+        const std::function<std::string(const ProgramAST &)> &OutputPath);
+
+    /**
+     * Compiles the streamed program into RT's JITDylib the way CompileAndRun
+     * does, without running it, and returns the address of its entry point,
+     * or a null address if there is no program. Tiered and PGO programs can
+     * only be compiled by CompileAndRun, so with --tiered or --pgo this
+     * reports an error and returns a null address.
+     */
+    llvm::orc::ExecutorAddr Link(const ProgramStream &,
+                                 llvm::orc::KaleidoscopeJIT &,
+                                 llvm::orc::ResourceTrackerSP RT);
+
+    /**
+     * Generates Func into the module being streamed, or links it on its own.
+     * Only valid while a ProgramStream is running.
+     */
+    void AddProcedure(std::unique_ptr<FunctionAST> Func);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,678 @@
+#include "interp/interp.h"
+
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <optional>
+
+#include "logger/logger.h"
+#include "runtime/runtime.h"
+
+using namespace llvm;
+
+using Clock = std::chrono::steady_clock;
+
+static double Since(Clock::time_point Start) {
+    return std::chrono::duration<double>(Clock::now() - Start).count();
+}
+
+// Iterations the loops in S run in total, nested ones once per iteration of
+// the loop around them, or nothing if that is only known at run time
+static std::optional<double> LoopTrips(StatementAST &S) {
+    if (auto *C = DynCast<CompoundStatementAST>(S)) {
+        double Total = 0;
+        for (auto &Statement : C->GetStatements()) {
+            std::optional<double> Trips = LoopTrips(*Statement);
+            if (!Trips) {
+                return std::nullopt;
+            }
+            Total += *Trips;
+        }
+        return Total;
+    }
+    if (auto *I = DynCast<IfStatementAST>(S)) {
+        std::optional<double> Then = LoopTrips(I->GetThen());
+        std::optional<double> Else =
+            I->HasElse() ? LoopTrips(I->GetElse()) : 0.0;
+        if (!Then || !Else) {
+            return std::nullopt;
+        }
+        return *Then + *Else;
+    }
+    if (auto *F = DynCast<ForStatementAST>(S)) {
+        auto *Start = DynCast<NumberExprAST>(F->GetStart());
+        auto *End = DynCast<NumberExprAST>(F->GetEnd());
+        if (F->IsParallel() || !Start || !End || Start->GetIsReal() ||
+            End->GetIsReal()) {
+            return std::nullopt;
+        }
+        std::optional<double> Body = LoopTrips(F->GetBody());
+        if (!Body) {
+            return std::nullopt;
+        }
+        // The body runs at least once
+        double Trips = std::max(1.0, End->GetVal() - Start->GetVal() + 1);
+        return Trips * (1 + *Body);
+    }
+    return 0.0;
+}
+
+ExecMode ChooseExecMode(ProgramAST &P, uint64_t MaxTrips) {
+    auto Fits = [MaxTrips](BlockAST &B) {
+        std::optional<double> Trips =
+            LoopTrips(B.GetCompoundStatementAST());
+        return Trips && *Trips <= MaxTrips;
+    };
+    for (auto &Func : P.GetFunctions()) {
+        if (!Fits(Func->GetBody())) {
+            return EXEC_JIT;
+        }
+    }
+    return Fits(P.GetBlock()) ? EXEC_MIXED : EXEC_JIT;
+}
+
+union Slot {
+    int64_t I;
+    double D;
+};
+
+// Integer arithmetic wraps here where compiled code's would be undefined
+static int64_t Wrap(uint64_t V) { return static_cast<int64_t>(V); }
+
+static Slot ReductionIdentity(ReductionOp Op, VarType T) {
+    Slot S;
+    if (T == TYPE_REAL) {
+        switch (Op) {
+            case REDUCE_ADD:
+                S.D = 0.0;
+                break;
+            case REDUCE_MUL:
+                S.D = 1.0;
+                break;
+            case REDUCE_MIN:
+                S.D = INFINITY;
+                break;
+            case REDUCE_MAX:
+                S.D = -INFINITY;
+                break;
+        }
+        return S;
+    }
+    switch (Op) {
+        case REDUCE_ADD:
+            S.I = 0;
+            break;
+        case REDUCE_MUL:
+            S.I = 1;
+            break;
+        case REDUCE_MIN:
+            S.I = INT64_MAX;
+            break;
+        case REDUCE_MAX:
+            S.I = INT64_MIN;
+            break;
+    }
+    return S;
+}
+
+static Slot Combine(ReductionOp Op, VarType T, Slot L, Slot R) {
+    Slot S;
+    if (T == TYPE_REAL) {
+        switch (Op) {
+            case REDUCE_ADD:
+                S.D = L.D + R.D;
+                break;
+            case REDUCE_MUL:
+                S.D = L.D * R.D;
+                break;
+            case REDUCE_MIN:
+                S = L.D < R.D ? L : R;
+                break;
+            case REDUCE_MAX:
+                S = L.D > R.D ? L : R;
+                break;
+        }
+        return S;
+    }
+    switch (Op) {
+        case REDUCE_ADD:
+            S.I = Wrap(uint64_t(L.I) + uint64_t(R.I));
+            break;
+        case REDUCE_MUL:
+            S.I = Wrap(uint64_t(L.I) * uint64_t(R.I));
+            break;
+        case REDUCE_MIN:
+            S = L.I < R.I ? L : R;
+            break;
+        case REDUCE_MAX:
+            S = L.I > R.I ? L : R;
+            break;
+    }
+    return S;
+}
+
+class InterpVisitor : public ASTVisitor {
+    struct Variable {
+        Slot *Ptr;
+        VarType Type;
+    };
+
+    struct Procedure {
+        FunctionAST *Func;
+        // Position in the program, as procedures only see earlier ones and
+        // themselves
+        size_t Index;
+        std::vector<VarType> Params;
+        uint64_t Heat = 0;
+        // The compiled "<name>.args" entry point
+        void (*Native)(Slot *Args) = nullptr;
+    };
+
+    orc::KaleidoscopeJIT *TheJIT;
+    uint64_t Threshold;
+    orc::ResourceTrackerSP RT;
+    bool CompileAttempted = false;
+
+    ProgramAST *Program = nullptr;
+    std::map<std::string, Procedure> Procedures;
+    // Null in the main block
+    Procedure *Current = nullptr;
+    // Variables of the procedures being run, as a stack that a procedure or
+    // loop truncates back to where it started. Slots keep their address as
+    // it grows.
+    std::deque<Slot> Locals;
+    std::map<std::string, Variable> NamedValues;
+
+    Slot V;
+    VarType ExprType;
+
+   public:
+    PhaseTimings Timings;
+    // Set by the first error, which stops the program
+    bool Failed = false;
+
+    InterpVisitor(orc::KaleidoscopeJIT *TheJIT, uint64_t Threshold)
+        : TheJIT(TheJIT), Threshold(Threshold) {}
+
+    ~InterpVisitor() {
+        if (RT) {
+            ExitOnError ExitOnErr;
+            ExitOnErr(RT->remove());
+        }
+    }
+
+    void Fail(const char *Message) {
+        if (!Failed) {
+            LogError(Message);
+            Failed = true;
+        }
+    }
+
+    // Converts S from type From for a destination of type To, as codegen
+    // does
+    bool Convert(Slot &S, VarType From, VarType To) {
+        if (Failed) {
+            return false;
+        }
+        if (To == TYPE_REAL) {
+            if (From == TYPE_INTEGER) {
+                S.D = static_cast<double>(S.I);
+            } else if (From == TYPE_BOOLEAN) {
+                Fail("Cannot convert a boolean to a real");
+                return false;
+            }
+            return true;
+        }
+        if (From == TYPE_REAL) {
+            Fail("Cannot convert a real to an integer or boolean");
+            return false;
+        }
+        return true;
+    }
+
+    Slot *Declare(const std::string &Name, VarType Type) {
+        Locals.push_back(Slot{0});
+        NamedValues[Name] = {&Locals.back(), Type};
+        return &Locals.back();
+    }
+
+    // Compiles all procedures once one of them is hot. Calls that are
+    // already running carry on in the interpreter.
+    void HeatUp(Procedure *Proc) {
+        if (Proc && ++Proc->Heat == Threshold) {
+            CompileProcedures();
+        }
+    }
+
+    void CompileProcedures() {
+        if (!TheJIT || CompileAttempted) {
+            return;
+        }
+        CompileAttempted = true;
+
+        ExitOnError ExitOnErr;
+        Clock::time_point Start = Clock::now();
+        unsigned ErrorsBefore = GetThreadErrorCount();
+        auto TM = ExitOnErr(TheJIT->createTargetMachine());
+        CodeGen CG;
+        CG.GenerateProcedures(Program->GetFunctions(),
+                              TheJIT->getDataLayout(), TM.get());
+        Timings.Codegen = Since(Start);
+        // The interpreter reports the error itself if it gets there
+        if (GetThreadErrorCount() != ErrorsBefore) {
+            return;
+        }
+
+        Start = Clock::now();
+        orc::JITDylib &JD = TheJIT->getMainJITDylib();
+        RT = JD.createResourceTracker();
+        ExitOnErr(TheJIT->addModule(CG.TakeModule(), RT));
+        std::vector<std::string> Names;
+        for (auto &[Name, Proc] : Procedures) {
+            Names.push_back(Name + ".args");
+        }
+        ExitOnErr(TheJIT->materialize(JD, Names));
+        for (auto &[Name, Proc] : Procedures) {
+            Proc.Native = ExitOnErr(TheJIT->lookup(JD, Name + ".args"))
+                              .getAddress()
+                              .toPtr<void (*)(Slot *)>();
+        }
+        Timings.Link = Since(Start);
+    }
+
+    void Call(const std::string &Callee,
+              const std::vector<std::unique_ptr<ExprAST>> &Args) {
+        auto It = Procedures.find(Callee);
+        if (It == Procedures.end() ||
+            (Current && It->second.Index > Current->Index)) {
+            Fail("Could not find function");
+            return;
+        }
+        Procedure &Proc = It->second;
+        if (Proc.Params.size() != Args.size()) {
+            Fail("Incorrect # of arguments");
+            return;
+        }
+
+        std::vector<Slot> ArgsV(Args.size());
+        for (size_t i = 0; i < Args.size(); i++) {
+            Args[i]->Accept(*this);
+            VarType ParamType =
+                Proc.Params[i] == TYPE_REAL ? TYPE_REAL : TYPE_INTEGER;
+            if (!Convert(V, ExprType, ParamType)) {
+                return;
+            }
+            ArgsV[i] = V;
+        }
+
+        HeatUp(&Proc);
+        if (Proc.Native) {
+            Proc.Native(ArgsV.data());
+            return;
+        }
+
+        Procedure *Caller = Current;
+        size_t Mark = Locals.size();
+        std::map<std::string, Variable> CallerValues;
+        std::swap(CallerValues, NamedValues);
+        Current = &Proc;
+
+        size_t i = 0;
+        for (auto &Decl : Proc.Func->GetPrototype().GetParameters()) {
+            for (auto &Name : Decl->GetVarNames()) {
+                *Declare(Name, Decl->GetType()) = ArgsV[i++];
+            }
+        }
+        Proc.Func->Accept(*this);
+
+        Current = Caller;
+        NamedValues = std::move(CallerValues);
+        Locals.resize(Mark);
+    }
+
+    void Write(const std::vector<std::unique_ptr<ExprAST>> &Args,
+               bool NewLine) {
+        OutputBuffer *Out = mp_output_buffer();
+        for (auto &Arg : Args) {
+            if (auto *Str = DynCast<StringExprAST>(*Arg)) {
+                mp_write_str(Out, Str->GetVal().data(), Str->GetVal().size());
+                continue;
+            }
+
+            Arg->Accept(*this);
+            if (Failed) {
+                return;
+            }
+            switch (ExprType) {
+                case TYPE_INTEGER:
+                    mp_write_int(Out, V.I);
+                    break;
+                case TYPE_BOOLEAN:
+                    mp_write_bool(Out, V.I);
+                    break;
+                case TYPE_REAL:
+                    mp_write_real(Out, V.D);
+                    break;
+            }
+        }
+        if (NewLine) {
+            mp_write_newline(Out);
+        }
+    }
+
+    // Iterations [Lo, Hi) of a parallel loop, with private reduction
+    // variables merged at the end like a chunk of compiled code
+    void RunChunk(ForStatementAST &S, int64_t Lo, int64_t Hi) {
+        size_t Mark = Locals.size();
+        std::map<std::string, Variable> SavedValues = NamedValues;
+
+        std::vector<Variable> Shared;
+        for (auto &R : S.GetReductions()) {
+            Variable Var = NamedValues[R.VarName];
+            Shared.push_back(Var);
+            *Declare(R.VarName, Var.Type) = ReductionIdentity(R.Op, Var.Type);
+        }
+        for (auto &Name : S.GetPrivates()) {
+            auto It = NamedValues.find(Name);
+            if (It != NamedValues.end()) {
+                Declare(Name, It->second.Type);
+            }
+        }
+
+        Slot *IndVar = Declare(S.GetVarName(), TYPE_INTEGER);
+        IndVar->I = Lo;
+        while (!Failed && IndVar->I < Hi) {
+            S.GetBody().Accept(*this);
+            HeatUp(Current);
+            IndVar->I = Wrap(uint64_t(IndVar->I) + 1);
+        }
+
+        if (!Failed) {
+            for (size_t i = 0; i < Shared.size(); i++) {
+                const Reduction &R = S.GetReductions()[i];
+                *Shared[i].Ptr = Combine(R.Op, Shared[i].Type, *Shared[i].Ptr,
+                                         *NamedValues[R.VarName].Ptr);
+            }
+        }
+        NamedValues = std::move(SavedValues);
+        Locals.resize(Mark);
+    }
+
+    void RunParallelFor(ForStatementAST &S) {
+        // The bounds are evaluated once up front
+        S.GetStart().Accept(*this);
+        if (!Convert(V, ExprType, TYPE_INTEGER)) {
+            return;
+        }
+        int64_t Start = V.I;
+        S.GetEnd().Accept(*this);
+        if (!Convert(V, ExprType, TYPE_INTEGER)) {
+            return;
+        }
+        int64_t End = V.I;
+
+        for (auto &R : S.GetReductions()) {
+            auto It = NamedValues.find(R.VarName);
+            if (It == NamedValues.end()) {
+                Fail("Unknown reduction variable");
+                return;
+            }
+            if (It->second.Type == TYPE_BOOLEAN) {
+                Fail("Reduction variables must be integers or reals");
+                return;
+            }
+        }
+
+        // End is inclusive, and like the sequential loop, the loop runs at
+        // least once
+        RunChunk(S, Start, Wrap(uint64_t(std::max(Start, End)) + 1));
+    }
+
+    virtual void Visit(NumberExprAST &E) override {
+        if (E.GetIsReal()) {
+            V.D = E.GetVal();
+            ExprType = TYPE_REAL;
+            return;
+        }
+        V.I = Wrap(static_cast<uint64_t>(E.GetVal()));
+        ExprType = TYPE_INTEGER;
+    }
+
+    virtual void Visit(ConcreteBoolExprAST &E) override {
+        V.I = E.GetVal();
+        ExprType = TYPE_BOOLEAN;
+    }
+
+    virtual void Visit(StringExprAST &E) override {
+        Fail("Strings can only be passed to write and writeln");
+    }
+
+    virtual void Visit(VariableExprAST &E) override {
+        auto It = NamedValues.find(E.GetName());
+        if (It == NamedValues.end()) {
+            Fail("Unknown variable");
+            return;
+        }
+        V = *It->second.Ptr;
+        ExprType = It->second.Type;
+    }
+
+    virtual void Visit(BinaryExprAST &E) override {
+        E.GetLeft().Accept(*this);
+        Slot L = V;
+        VarType LType = ExprType;
+        E.GetRight().Accept(*this);
+        Slot R = V;
+        VarType RType = ExprType;
+        if (Failed) {
+            return;
+        }
+
+        if (LType == TYPE_REAL || RType == TYPE_REAL) {
+            if (!Convert(L, LType, TYPE_REAL) ||
+                !Convert(R, RType, TYPE_REAL)) {
+                return;
+            }
+            ExprType = TYPE_REAL;
+            switch (E.GetOp()) {
+                case '+':
+                    V.D = L.D + R.D;
+                    break;
+                case '-':
+                    V.D = L.D - R.D;
+                    break;
+                case '*':
+                    V.D = L.D * R.D;
+                    break;
+                case '/':
+                    V.D = L.D / R.D;
+                    break;
+                case '<':
+                    V.I = L.D < R.D;
+                    ExprType = TYPE_BOOLEAN;
+                    break;
+                default:
+                    Fail("Unknown operation!");
+            }
+            return;
+        }
+
+        uint64_t A = L.I, B = R.I;
+        ExprType = E.GetOp() == '<' ? TYPE_BOOLEAN : TYPE_INTEGER;
+        switch (E.GetOp()) {
+            case '+':
+                V.I = Wrap(A + B);
+                break;
+            case '-':
+                V.I = Wrap(A - B);
+                break;
+            case '*':
+                V.I = Wrap(A * B);
+                break;
+            case '/':
+                // Compiled code would trap
+                if (R.I == 0 || (L.I == INT64_MIN && R.I == -1)) {
+                    Fail("Integer division overflow");
+                    return;
+                }
+                V.I = L.I / R.I;
+                break;
+            case '<':
+                V.I = L.I < R.I;
+                break;
+            default:
+                Fail("Unknown operation!");
+        }
+    }
+
+    virtual void Visit(CallExprAST &E) override {
+        Call(E.GetCallee(), E.GetArgs());
+    }
+
+    virtual void Visit(StatementCallExprAST &S) override {
+        if (S.GetCallee() == "write" || S.GetCallee() == "writeln") {
+            Write(S.GetArgs(), S.GetCallee() == "writeln");
+            return;
+        }
+        Call(S.GetCallee(), S.GetArgs());
+    }
+
+    virtual void Visit(IfStatementAST &S) override {
+        S.GetCond().Accept(*this);
+        if (!Convert(V, ExprType, TYPE_BOOLEAN)) {
+            return;
+        }
+        if (V.I != 0) {
+            S.GetThen().Accept(*this);
+        } else if (S.HasElse()) {
+            S.GetElse().Accept(*this);
+        }
+    }
+
+    // Like the compiled loop, the body runs before the end condition is
+    // first checked, and End is evaluated again after every iteration
+    virtual void Visit(ForStatementAST &S) override {
+        if (S.IsParallel()) {
+            RunParallelFor(S);
+            return;
+        }
+
+        S.GetStart().Accept(*this);
+        if (!Convert(V, ExprType, TYPE_INTEGER)) {
+            return;
+        }
+
+        size_t Mark = Locals.size();
+        auto Old = NamedValues.find(S.GetVarName());
+        std::optional<Variable> OldVar;
+        if (Old != NamedValues.end()) {
+            OldVar = Old->second;
+        }
+        Slot *Var = Declare(S.GetVarName(), TYPE_INTEGER);
+        *Var = V;
+
+        while (true) {
+            S.GetBody().Accept(*this);
+            HeatUp(Current);
+            S.GetEnd().Accept(*this);
+            if (!Convert(V, ExprType, TYPE_INTEGER)) {
+                break;
+            }
+            int64_t Cur = Var->I;
+            Var->I = Wrap(uint64_t(Cur) + 1);
+            if (!(Cur < V.I)) {
+                break;
+            }
+        }
+
+        if (OldVar) {
+            NamedValues[S.GetVarName()] = *OldVar;
+        } else {
+            NamedValues.erase(S.GetVarName());
+        }
+        Locals.resize(Mark);
+    }
+
+    virtual void Visit(VariableAssignmentAST &S) override {
+        S.GetValue().Accept(*this);
+        if (Failed) {
+            return;
+        }
+        auto It = NamedValues.find(S.GetVarName());
+        if (It == NamedValues.end()) {
+            Fail("Unknown variable");
+            return;
+        }
+        if (!Convert(V, ExprType, It->second.Type)) {
+            return;
+        }
+        *It->second.Ptr = V;
+    }
+
+    virtual void Visit(VariableDeclAST &D) override {
+        for (auto &Name : D.GetVarNames()) {
+            Declare(Name, D.GetType());
+        }
+    }
+
+    virtual void Visit(PrototypeAST &P) override {}
+
+    virtual void Visit(DeclarationAST &D) override {
+        for (auto &VarDecl : D.GetVarDeclarations()) {
+            VarDecl->Accept(*this);
+        }
+    }
+
+    virtual void Visit(CompoundStatementAST &S) override {
+        for (auto &Statement : S.GetStatements()) {
+            if (Failed) {
+                return;
+            }
+            Statement->Accept(*this);
+        }
+    }
+
+    virtual void Visit(BlockAST &B) override {
+        B.GetDeclaration().Accept(*this);
+        B.GetCompoundStatementAST().Accept(*this);
+    }
+
+    // Runs the body of a procedure whose parameters Call has bound
+    virtual void Visit(FunctionAST &Func) override {
+        Func.GetBody().Accept(*this);
+    }
+
+    virtual void Visit(ProgramAST &P) override {
+        Program = &P;
+        for (auto &Func : P.GetFunctions()) {
+            Procedure Proc;
+            Proc.Func = Func.get();
+            Proc.Index = Procedures.size();
+            for (auto &Decl : Func->GetPrototype().GetParameters()) {
+                Proc.Params.insert(Proc.Params.end(),
+                                   Decl->GetVarNames().size(),
+                                   Decl->GetType());
+            }
+            if (!Procedures.emplace(Func->GetPrototype().GetName(), Proc)
+                     .second) {
+                Fail("Function cannot be redefined");
+                return;
+            }
+        }
+        P.GetBlock().Accept(*this);
+    }
+};
+
+PhaseTimings Interpret(ProgramAST &P, orc::KaleidoscopeJIT *TheJIT,
+                       uint64_t Threshold) {
+    InterpVisitor Interp(TheJIT, std::max<uint64_t>(1, Threshold));
+    Clock::time_point Start = Clock::now();
+    P.Accept(Interp);
+    mp_flush();
+
+    PhaseTimings Timings = Interp.Timings;
+    Timings.Execute = std::max(
+        0.0, Since(Start) - Timings.Codegen - Timings.Link);
+    return Timings;
+}
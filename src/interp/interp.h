@@ -0,0 +1,52 @@
+#ifndef INTERP_H
+#define INTERP_H
+
+#include <cstdint>
+
+#include "ast/ast.h"
+#include "codegen/codegen.h"
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+
+enum ExecMode {
+    // Compile the whole program before running it
+    EXEC_JIT,
+    // Walk the AST and never compile anything
+    EXEC_INTERP,
+    // Start in the interpreter and compile procedures once they are hot
+    EXEC_MIXED,
+    // EXEC_MIXED or EXEC_JIT, whichever ChooseExecMode picks
+    EXEC_AUTO,
+    // Compile to bytecode, which is much quicker than LLVM, and run that
+    EXEC_VM,
+};
+
+/**
+ * Picks EXEC_MIXED for programs that look like they finish before compiling
+ * them would pay off, and EXEC_JIT otherwise. A procedure can move to the JIT
+ * between calls but not in the middle of one, so the interpreter only gets
+ * programs whose for loops all have literal bounds, with at most MaxTrips
+ * iterations per run of the main block or a procedure, and no parallel
+ * loops.
+ */
+ExecMode ChooseExecMode(ProgramAST &P, uint64_t MaxTrips);
+
+/**
+ * Runs P by walking its AST, which starts right away instead of after LLVM
+ * has compiled it, and flushes its output. Returns the time spent.
+ *
+ * Values live in 8-byte slots, integers and booleans as int64_t and reals as
+ * double, with the same arithmetic as compiled code. Errors that codegen
+ * would report up front are only found when the interpreter reaches them,
+ * and stop the program there. Parallel loops run on the calling thread.
+ *
+ * Unless TheJIT is null, every call and loop iteration heats up the
+ * procedure it runs in. Once one of them reaches Threshold, all of P's
+ * procedures are compiled together into TheJIT's main JITDylib, and calls
+ * from then on go to the compiled code. The main block always stays in the
+ * interpreter. Codegen and Link in the result are what that compilation
+ * took.
+ */
+PhaseTimings Interpret(ProgramAST &P, llvm::orc::KaleidoscopeJIT *TheJIT,
+                       uint64_t Threshold);
+
+#endif
@@ -0,0 +1,105 @@
+#include "jitmem/jitmem.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Process.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+PooledMemoryMapper::PooledMemoryMapper(size_t PageSize, bool HugePages)
+    : InProcessMemoryMapper(PageSize), HugePages(HugePages) {}
+
+Expected<std::unique_ptr<PooledMemoryMapper>> PooledMemoryMapper::Create(
+    bool HugePages) {
+    auto PageSize = sys::Process::getPageSize();
+    if (!PageSize) {
+        return PageSize.takeError();
+    }
+    return std::make_unique<PooledMemoryMapper>(*PageSize, HugePages);
+}
+
+void PooledMemoryMapper::reserve(size_t NumBytes,
+                                 OnReservedFunction OnReserved) {
+    InProcessMemoryMapper::reserve(
+        NumBytes, [this, OnReserved = std::move(OnReserved)](
+                      Expected<ExecutorAddrRange> Range) mutable {
+            if (Range) {
+#ifdef MADV_HUGEPAGE
+                // Only a hint: the slab is still usable if the kernel has
+                // transparent huge pages disabled
+                if (HugePages) {
+                    madvise(Range->Start.toPtr<void *>(), Range->size(),
+                            MADV_HUGEPAGE);
+                }
+#endif
+                std::lock_guard<std::mutex> Lock(StatsMutex);
+                ReservationSizes[Range->Start] = Range->size();
+                ReservedBytes += Range->size();
+            }
+            OnReserved(std::move(Range));
+        });
+}
+
+void PooledMemoryMapper::initialize(AllocInfo &AI,
+                                    OnInitializedFunction OnInitialized) {
+    size_t Size = 0;
+    for (auto &Segment : AI.Segments) {
+        Size += alignTo(Segment.ContentSize + Segment.ZeroFillSize,
+                        getPageSize());
+    }
+
+    InProcessMemoryMapper::initialize(
+        AI, [this, Size, OnInitialized = std::move(OnInitialized)](
+                Expected<ExecutorAddr> Addr) mutable {
+            if (Addr) {
+                std::lock_guard<std::mutex> Lock(StatsMutex);
+                AllocationSizes[*Addr] = Size;
+                AllocatedBytes += Size;
+                PeakAllocatedBytes =
+                    std::max(PeakAllocatedBytes, AllocatedBytes);
+            }
+            OnInitialized(std::move(Addr));
+        });
+}
+
+void PooledMemoryMapper::deinitialize(
+    ArrayRef<ExecutorAddr> Allocations,
+    OnDeinitializedFunction OnDeInitialized) {
+    {
+        std::lock_guard<std::mutex> Lock(StatsMutex);
+        for (auto Addr : Allocations) {
+            auto It = AllocationSizes.find(Addr);
+            if (It != AllocationSizes.end()) {
+                AllocatedBytes -= It->second;
+                AllocationSizes.erase(It);
+            }
+        }
+    }
+    InProcessMemoryMapper::deinitialize(Allocations,
+                                        std::move(OnDeInitialized));
+}
+
+void PooledMemoryMapper::release(ArrayRef<ExecutorAddr> Reservations,
+                                 OnReleasedFunction OnRelease) {
+    {
+        std::lock_guard<std::mutex> Lock(StatsMutex);
+        for (auto Addr : Reservations) {
+            auto It = ReservationSizes.find(Addr);
+            if (It != ReservationSizes.end()) {
+                ReservedBytes -= It->second;
+                ReservationSizes.erase(It);
+            }
+        }
+    }
+    InProcessMemoryMapper::release(Reservations, std::move(OnRelease));
+}
+
+JITMemoryStats PooledMemoryMapper::GetStats() {
+    std::lock_guard<std::mutex> Lock(StatsMutex);
+    return {ReservedBytes, AllocatedBytes, PeakAllocatedBytes,
+            AllocationSizes.size()};
+}
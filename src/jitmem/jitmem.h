@@ -0,0 +1,55 @@
+#ifndef JITMEM_H
+#define JITMEM_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "llvm/ExecutionEngine/Orc/MemoryMapper.h"
+
+/**
+ * Bytes of address space reserved for slabs, and bytes handed out from them
+ * to linked code. Neither says how much of it the kernel has made resident.
+ */
+struct JITMemoryStats {
+    size_t ReservedBytes;
+    size_t AllocatedBytes;
+    size_t PeakAllocatedBytes;
+    size_t LiveAllocations;
+};
+
+/**
+ * Memory mapper for the JITLink memory manager. Slabs reserved through it
+ * stay mapped for the lifetime of the JIT, so code removed with a
+ * ResourceTracker is recycled by later programs instead of being unmapped.
+ * Also keeps track of how much JIT memory is in use.
+ */
+class PooledMemoryMapper : public llvm::orc::InProcessMemoryMapper {
+    bool HugePages;
+
+    std::mutex StatsMutex;
+    std::map<llvm::orc::ExecutorAddr, size_t> ReservationSizes;
+    std::map<llvm::orc::ExecutorAddr, size_t> AllocationSizes;
+    size_t ReservedBytes = 0;
+    size_t AllocatedBytes = 0;
+    size_t PeakAllocatedBytes = 0;
+
+   public:
+    PooledMemoryMapper(size_t PageSize, bool HugePages);
+
+    static llvm::Expected<std::unique_ptr<PooledMemoryMapper>> Create(
+        bool HugePages);
+
+    void reserve(size_t NumBytes, OnReservedFunction OnReserved) override;
+    void initialize(AllocInfo &AI,
+                    OnInitializedFunction OnInitialized) override;
+    void deinitialize(llvm::ArrayRef<llvm::orc::ExecutorAddr> Allocations,
+                      OnDeinitializedFunction OnDeInitialized) override;
+    void release(llvm::ArrayRef<llvm::orc::ExecutorAddr> Reservations,
+                 OnReleasedFunction OnRelease) override;
+
+    JITMemoryStats GetStats();
+};
+
+#endif
@@ -13,7 +13,9 @@
 #ifndef LLVM_EXECUTIONENGINE_ORC_KALEIDOSCOPEJIT_H
 #define LLVM_EXECUTIONENGINE_ORC_KALEIDOSCOPEJIT_H
 
+#include "jitmem/jitmem.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/JITEventListener.h"
 #include "llvm/ExecutionEngine/JITSymbol.h"
 #include "llvm/ExecutionEngine/Orc/CompileUtils.h"
 #include "llvm/ExecutionEngine/Orc/Core.h"
@@ -21,53 +23,155 @@
 #include "llvm/ExecutionEngine/Orc/ExecutorProcessControl.h"
 #include "llvm/ExecutionEngine/Orc/IRCompileLayer.h"
 #include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
+#include "llvm/ExecutionEngine/Orc/MapperJITLinkMemoryManager.h"
+#include "llvm/ExecutionEngine/Orc/ObjectLinkingLayer.h"
 #include "llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h"
 #include "llvm/ExecutionEngine/Orc/Shared/ExecutorSymbolDef.h"
+#include "llvm/ExecutionEngine/Orc/TaskDispatch.h"
 #include "llvm/ExecutionEngine/SectionMemoryManager.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/Support/CodeGen.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/TargetParser/Triple.h"
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace llvm {
 namespace orc {
 
+struct KaleidoscopeJITOptions {
+  /// Link through JITLink with a pooled memory manager. When false, objects
+  /// are linked by RuntimeDyld with a SectionMemoryManager per object.
+  bool UseJITLink = true;
+  /// Advise the kernel to back JIT slabs with transparent huge pages.
+  bool HugePages = false;
+  /// Size of each slab reserved by the pooled memory manager.
+  size_t SlabSize = 64 * 1024 * 1024;
+  /// Number of threads materializing modules. Zero runs every
+  /// materialization in place on the thread that triggered it.
+  unsigned MaterializationThreads = 0;
+  /// CPU to generate code for. Empty selects the host CPU together with
+  /// the features it supports.
+  std::string CPU;
+  /// Additional target features, e.g. "+avx2" or "-avx512f".
+  std::vector<std::string> Features;
+  /// Resolve symbols not defined in the JIT against every library loaded
+  /// into the process. Otherwise only explicitly defined symbols are
+  /// visible to JIT code.
+  bool ProcessSymbols = false;
+};
+
+/// Runs materialization tasks on a fixed-size thread pool. LLVM's
+/// DynamicThreadPoolTaskDispatcher starts a thread per task with no upper
+/// bound, which oversubscribes the host for programs with many procedures.
+class ThreadPoolTaskDispatcher : public TaskDispatcher {
+  ThreadPool Pool;
+
+public:
+  ThreadPoolTaskDispatcher(unsigned NumThreads)
+      : Pool(hardware_concurrency(NumThreads)) {}
+
+  void dispatch(std::unique_ptr<Task> T) override {
+    // ThreadPool only accepts copyable callables
+    std::shared_ptr<Task> SharedT(std::move(T));
+    Pool.async([SharedT]() { SharedT->run(); });
+  }
+
+  void shutdown() override { Pool.wait(); }
+};
+
 class KaleidoscopeJIT {
+public:
+  /// Selects which compile layer a module is lowered through. Default uses
+  /// the target's default codegen level, Baseline trades code quality for
+  /// compile latency (-O0, FastISel) and Optimized is used when re-compiling
+  /// hot code.
+  enum class CompileTier { Default, Baseline, Optimized };
+
 private:
   std::unique_ptr<ExecutionSession> ES;
 
   DataLayout DL;
   MangleAndInterner Mangle;
 
-  RTDyldObjectLinkingLayer ObjectLayer;
+  std::unique_ptr<jitlink::JITLinkMemoryManager> MemMgr;
+  PooledMemoryMapper *Mapper;
+  // Declared before the object layer, which notifies them until it is gone
+  std::vector<std::unique_ptr<JITEventListener>> EventListeners;
+  std::unique_ptr<ObjectLayer> ObjLayer;
   IRCompileLayer CompileLayer;
+  IRCompileLayer BaselineCompileLayer;
+  IRCompileLayer OptimizedCompileLayer;
 
+  Triple TT;
+  JITTargetMachineBuilder TargetJTMB;
+  unsigned MaterializationThreads;
   JITDylib &MainJD;
 
+  static JITTargetMachineBuilder withOptLevel(JITTargetMachineBuilder JTMB,
+                                              CodeGenOpt::Level OptLevel) {
+    JTMB.setCodeGenOptLevel(OptLevel);
+    if (OptLevel == CodeGenOpt::None)
+      JTMB.getOptions().EnableFastISel = true;
+    return JTMB;
+  }
+
+  static std::unique_ptr<ObjectLayer>
+  createObjectLayer(ExecutionSession &ES,
+                    jitlink::JITLinkMemoryManager *MemMgr, const Triple &TT) {
+    if (MemMgr)
+      return std::make_unique<ObjectLinkingLayer>(ES, *MemMgr);
+
+    auto RTDyldLayer = std::make_unique<RTDyldObjectLinkingLayer>(
+        ES, []() { return std::make_unique<SectionMemoryManager>(); });
+    if (TT.isOSBinFormatCOFF()) {
+      RTDyldLayer->setOverrideObjectFlagsWithResponsibilityFlags(true);
+      RTDyldLayer->setAutoClaimResponsibilityForObjectSymbols(true);
+    }
+    return RTDyldLayer;
+  }
+
 public:
   KaleidoscopeJIT(std::unique_ptr<ExecutionSession> ES,
-                  JITTargetMachineBuilder JTMB, DataLayout DL)
+                  JITTargetMachineBuilder JTMB, DataLayout DL,
+                  std::unique_ptr<jitlink::JITLinkMemoryManager> MemMgr,
+                  PooledMemoryMapper *Mapper,
+                  unsigned MaterializationThreads = 0)
       : ES(std::move(ES)), DL(std::move(DL)), Mangle(*this->ES, this->DL),
-        ObjectLayer(*this->ES,
-                    []() { return std::make_unique<SectionMemoryManager>(); }),
-        CompileLayer(*this->ES, ObjectLayer,
-                     std::make_unique<ConcurrentIRCompiler>(std::move(JTMB))),
-        MainJD(this->ES->createBareJITDylib("<main>")) {
-    MainJD.addGenerator(
-        cantFail(DynamicLibrarySearchGenerator::GetForCurrentProcess(
-            DL.getGlobalPrefix())));
-    if (JTMB.getTargetTriple().isOSBinFormatCOFF()) {
-      ObjectLayer.setOverrideObjectFlagsWithResponsibilityFlags(true);
-      ObjectLayer.setAutoClaimResponsibilityForObjectSymbols(true);
-    }
-  }
+        MemMgr(std::move(MemMgr)), Mapper(Mapper),
+        ObjLayer(createObjectLayer(*this->ES, this->MemMgr.get(),
+                                   JTMB.getTargetTriple())),
+        CompileLayer(*this->ES, *ObjLayer,
+                     std::make_unique<ConcurrentIRCompiler>(JTMB)),
+        BaselineCompileLayer(*this->ES, *ObjLayer,
+                             std::make_unique<ConcurrentIRCompiler>(
+                                 withOptLevel(JTMB, CodeGenOpt::None))),
+        OptimizedCompileLayer(*this->ES, *ObjLayer,
+                              std::make_unique<ConcurrentIRCompiler>(
+                                  withOptLevel(JTMB, CodeGenOpt::Aggressive))),
+        TT(JTMB.getTargetTriple()), TargetJTMB(JTMB),
+        MaterializationThreads(MaterializationThreads),
+        MainJD(this->ES->createBareJITDylib("<main>")) {}
 
   ~KaleidoscopeJIT() {
     if (auto Err = ES->endSession())
       ES->reportError(std::move(Err));
   }
 
-  static Expected<std::unique_ptr<KaleidoscopeJIT>> Create() {
-    auto EPC = SelfExecutorProcessControl::Create();
+  static Expected<std::unique_ptr<KaleidoscopeJIT>>
+  Create(KaleidoscopeJITOptions Opts = KaleidoscopeJITOptions()) {
+    std::unique_ptr<TaskDispatcher> Dispatcher;
+    if (Opts.MaterializationThreads > 0)
+      Dispatcher = std::make_unique<ThreadPoolTaskDispatcher>(
+          Opts.MaterializationThreads);
+    else
+      Dispatcher = std::make_unique<InPlaceTaskDispatcher>();
+
+    auto EPC = SelfExecutorProcessControl::Create(nullptr,
+                                                  std::move(Dispatcher));
     if (!EPC)
       return EPC.takeError();
 
@@ -75,27 +179,148 @@ public:
 
     JITTargetMachineBuilder JTMB(
         ES->getExecutorProcessControl().getTargetTriple());
+    if (Opts.CPU.empty()) {
+      // Tune for the CPU we are running on rather than a generic baseline
+      auto HostJTMB = JITTargetMachineBuilder::detectHost();
+      if (!HostJTMB)
+        return HostJTMB.takeError();
+      JTMB.setCPU(HostJTMB->getCPU());
+      JTMB.setFeatures(HostJTMB->getFeatures().getString());
+    } else {
+      JTMB.setCPU(Opts.CPU);
+    }
+    JTMB.addFeatures(Opts.Features);
 
     auto DL = JTMB.getDefaultDataLayoutForTarget();
     if (!DL)
       return DL.takeError();
 
-    return std::make_unique<KaleidoscopeJIT>(std::move(ES), std::move(JTMB),
-                                             std::move(*DL));
+    std::unique_ptr<jitlink::JITLinkMemoryManager> MemMgr;
+    PooledMemoryMapper *Mapper = nullptr;
+    if (Opts.UseJITLink) {
+      auto PooledMapper = PooledMemoryMapper::Create(Opts.HugePages);
+      if (!PooledMapper)
+        return PooledMapper.takeError();
+      Mapper = PooledMapper->get();
+      MemMgr = std::make_unique<MapperJITLinkMemoryManager>(
+          Opts.SlabSize, std::move(*PooledMapper));
+    }
+
+    char GlobalPrefix = DL->getGlobalPrefix();
+    auto J = std::make_unique<KaleidoscopeJIT>(
+        std::move(ES), std::move(JTMB), std::move(*DL), std::move(MemMgr),
+        Mapper, Opts.MaterializationThreads);
+
+    if (Opts.ProcessSymbols) {
+      auto Generator =
+          DynamicLibrarySearchGenerator::GetForCurrentProcess(GlobalPrefix);
+      if (!Generator)
+        return Generator.takeError();
+      J->getMainJITDylib().addGenerator(std::move(*Generator));
+    }
+
+    return std::move(J);
   }
 
   const DataLayout &getDataLayout() const { return DL; }
 
+  const Triple &getTargetTriple() const { return TT; }
+
+  unsigned getMaterializationThreads() const { return MaterializationThreads; }
+
+  /// Creates a TargetMachine for the CPU and features code is generated for,
+  /// so that IR passes see the target's real vector width and costs.
+  Expected<std::unique_ptr<TargetMachine>> createTargetMachine() {
+    return TargetJTMB.createTargetMachine();
+  }
+
+  /// Identifies the code generated by this JIT. Anything cached across runs
+  /// must include it in its key, as code built for one CPU may not run on
+  /// another.
+  std::string getTargetFingerprint() const {
+    return TT.str() + ";" + TargetJTMB.getCPU() + ";" +
+           TargetJTMB.getFeatures().getString();
+  }
+
+  ExecutionSession &getExecutionSession() { return *ES; }
+
   JITDylib &getMainJITDylib() { return MainJD; }
 
-  Error addModule(ThreadSafeModule TSM, ResourceTrackerSP RT = nullptr) {
+  /// Creates a JITDylib for a single program. It sees everything defined in
+  /// the main JITDylib, such as the runtime, while its own definitions do not
+  /// clash with those of programs in other JITDylibs.
+  Expected<JITDylib &> createProgramJITDylib(StringRef Name) {
+    auto JD = ES->createJITDylib(Name.str());
+    if (!JD)
+      return JD.takeError();
+    JD->addToLinkOrder(MainJD);
+    return *JD;
+  }
+
+  Error removeJITDylib(JITDylib &JD) { return ES->removeJITDylib(JD); }
+
+  SymbolStringPtr mangle(StringRef Name) { return Mangle(Name); }
+
+  /// True if objects are linked by JITLink rather than RuntimeDyld.
+  bool usesJITLink() const { return MemMgr != nullptr; }
+
+  /// Lets P see the link graph of every object linked by JITLink.
+  void addObjectLinkingPlugin(std::unique_ptr<ObjectLinkingLayer::Plugin> P) {
+    assert(usesJITLink() && "Objects are linked by RuntimeDyld");
+    static_cast<ObjectLinkingLayer &>(*ObjLayer).addPlugin(std::move(P));
+  }
+
+  /// Notifies L of every object loaded by RuntimeDyld. L lives as long as
+  /// the JIT.
+  void addEventListener(std::unique_ptr<JITEventListener> L) {
+    assert(!usesJITLink() && "Objects are linked by JITLink");
+    static_cast<RTDyldObjectLinkingLayer &>(*ObjLayer)
+        .registerJITEventListener(*L);
+    EventListeners.push_back(std::move(L));
+  }
+
+  /// Returns statistics for JIT code memory, or std::nullopt when objects are
+  /// linked by RuntimeDyld.
+  std::optional<JITMemoryStats> getMemoryStats() {
+    if (!Mapper)
+      return std::nullopt;
+    return Mapper->GetStats();
+  }
+
+  Error addModule(ThreadSafeModule TSM, ResourceTrackerSP RT = nullptr,
+                  CompileTier Tier = CompileTier::Default) {
     if (!RT)
       RT = MainJD.getDefaultResourceTracker();
-    return CompileLayer.add(RT, std::move(TSM));
+    switch (Tier) {
+    case CompileTier::Baseline:
+      return BaselineCompileLayer.add(RT, std::move(TSM));
+    case CompileTier::Optimized:
+      return OptimizedCompileLayer.add(RT, std::move(TSM));
+    default:
+      return CompileLayer.add(RT, std::move(TSM));
+    }
   }
 
   Expected<ExecutorSymbolDef> lookup(StringRef Name) {
-    return ES->lookup({&MainJD}, Mangle(Name.str()));
+    return lookup(MainJD, Name);
+  }
+
+  Expected<ExecutorSymbolDef> lookup(JITDylib &JD, StringRef Name) {
+    return ES->lookup({&JD}, Mangle(Name.str()));
+  }
+
+  /// Looks up all of Names in a single query, so that the modules defining
+  /// them are materialized concurrently when a thread pool is installed.
+  Error materialize(ArrayRef<std::string> Names) {
+    return materialize(MainJD, Names);
+  }
+
+  Error materialize(JITDylib &JD, ArrayRef<std::string> Names) {
+    SymbolLookupSet Symbols;
+    for (auto &Name : Names)
+      Symbols.add(Mangle(Name));
+    return ES->lookup(makeJITDylibSearchOrder(&JD), std::move(Symbols))
+        .takeError();
   }
 };
 
@@ -4,20 +4,30 @@
 #include <cstdio>
 #include <cstdlib>
 
-int CurTok;
-std::string IdentifierStr;
-double NumVal;
+#include "logger/logger.h"
 
-int gettok() {
-    static int LastChar = ' ';
+thread_local int CurTok;
+thread_local std::string IdentifierStr;
+thread_local double NumVal;
+thread_local bool NumIsReal;
+thread_local std::string StringVal;
+
+static thread_local std::FILE *Input = stdin;
+static thread_local int LastChar = ' ';
+
+void SetLexerInput(std::FILE *In) {
+    Input = In;
+    LastChar = ' ';
+}
 
+int gettok() {
     while (std::isspace(LastChar)) {
-        LastChar = std::getchar();
+        LastChar = std::getc(Input);
     }
 
     if (std::isalpha(LastChar)) {
         IdentifierStr = LastChar;
-        while (std::isalnum(LastChar = getchar())) {
+        while (std::isalnum(LastChar = std::getc(Input))) {
             IdentifierStr += LastChar;
         }
 
@@ -81,7 +91,7 @@ int gettok() {
 
     // Check for lone period, since otherwise it gets parsed as a number
     if (LastChar == '.') {
-        LastChar = getchar();  // need to skip this token?
+        LastChar = std::getc(Input);  // need to skip this token?
         return tok_period;
     }
 
@@ -89,16 +99,38 @@ int gettok() {
         std::string NumStr;
         do {
             NumStr += LastChar;
-            LastChar = std::getchar();
+            LastChar = std::getc(Input);
         } while (isdigit(LastChar) || LastChar == '.');
 
         NumVal = std::strtod(NumStr.c_str(), 0);
+        NumIsReal = NumStr.find('.') != std::string::npos;
         return tok_number;
     }
 
+    // String literals are quoted with ', which is written twice to escape it.
+    // They end at the end of the line at the latest, so that a missing quote
+    // cannot swallow the programs after it.
+    if (LastChar == '\'') {
+        StringVal.clear();
+        while (true) {
+            LastChar = std::getc(Input);
+            if (LastChar == EOF || LastChar == '\n' || LastChar == '\r') {
+                LogError("Unterminated string literal");
+                return tok_string;
+            }
+            if (LastChar == '\'') {
+                LastChar = std::getc(Input);
+                if (LastChar != '\'') {
+                    return tok_string;
+                }
+            }
+            StringVal += LastChar;
+        }
+    }
+
     if (LastChar == '#') {
         do {
-            LastChar = std::getchar();
+            LastChar = std::getc(Input);
         } while (LastChar != EOF && LastChar != '\n' && LastChar != '\r');
 
         if (LastChar != EOF) {
@@ -111,7 +143,7 @@ int gettok() {
     }
 
     int ThisChar = LastChar;
-    LastChar = getchar();
+    LastChar = std::getc(Input);
     return ThisChar;  // Return as ASCII
 }
 
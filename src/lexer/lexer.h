@@ -2,6 +2,7 @@
 #define LEXER_H
 
 #include <climits>
+#include <cstdio>
 #include <string>
 
 enum Token {
@@ -32,14 +33,25 @@ enum Token {
     // primary
     tok_identifier,
     tok_number,
+    tok_string,
 
     // symbols
     tok_period,
 };
 
-extern int CurTok;
-extern std::string IdentifierStr;
-extern double NumVal;
+// Lexer state is per thread, so that several threads can each parse their
+// own input
+extern thread_local int CurTok;
+extern thread_local std::string IdentifierStr;
+extern thread_local double NumVal;
+extern thread_local bool NumIsReal;
+extern thread_local std::string StringVal;
+
+/**
+ * Makes the calling thread's lexer read from In, which defaults to stdin,
+ * starting with a fresh token
+ */
+void SetLexerInput(std::FILE *In);
 
 int gettok();
 
@@ -1,6 +1,13 @@
 #include "logger.h"
 
+#include <atomic>
+
+static std::atomic<unsigned> ErrorCount = 0;
+static thread_local unsigned ThreadErrorCount = 0;
+
 std::unique_ptr<ExprAST> LogError(const char *Str) {
+    ErrorCount++;
+    ThreadErrorCount++;
     std::fprintf(stderr, "Error: %s\n", Str);
     return nullptr;
 }
@@ -9,3 +16,7 @@ std::unique_ptr<PrototypeAST> LogErrorP(const char *Str) {
     LogError(Str);
     return nullptr;
 }
+
+unsigned GetErrorCount() { return ErrorCount; }
+
+unsigned GetThreadErrorCount() { return ThreadErrorCount; }
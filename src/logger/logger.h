@@ -6,4 +6,14 @@
 
 std::unique_ptr<ExprAST> LogError(const char *Str);
 std::unique_ptr<PrototypeAST> LogErrorP(const char *Str);
+
+/**
+ * Number of errors logged since the compiler started
+ */
+unsigned GetErrorCount();
+
+/**
+ * Number of errors logged by the calling thread
+ */
+unsigned GetThreadErrorCount();
 #endif
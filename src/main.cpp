@@ -1,29 +1,388 @@
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "autopar/autopar.h"
+#include "batch/batch.h"
+#include "bytecode/bytecode.h"
 #include "codegen/codegen.h"
+#include "interp/interp.h"
 #include "kaleidoscopejit/KaleidoscopeJIT.h"
 #include "lexer/lexer.h"
+#include "logger/logger.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/TargetSelect.h"
 #include "parser/parser.h"
+#include "perf/perf.h"
+#include "pipeline/pipeline.h"
+#include "runner/runner.h"
+#include "server/protocol.h"
+#include "server/server.h"
+#include "session/session.h"
+#include "symbols/symbols.h"
 
 static std::unique_ptr<llvm::orc::KaleidoscopeJIT> TheJIT;
+static std::unique_ptr<ReplSession> TheSession;
+static std::unique_ptr<ConcurrentRunner> TheRunner;
+static std::unique_ptr<ActionQueue> ThePipeline;
+// Shared by the programs compiled on the main thread
+static std::unique_ptr<CompilerSession> TheCompiler;
 static llvm::ExitOnError ExitOnErr;
 
-#include <inttypes.h>
-#include <stdio.h>
+// Time spent on the programs read since the last reset
+// Per thread, since batch mode parses and runs files on several threads
+static thread_local PhaseTimings Timings;
+
+static llvm::cl::opt<bool> AOT(
+    "aot", llvm::cl::desc("Compile programs ahead of time instead of running "
+                          "them in the JIT"));
+static llvm::cl::opt<EmitKind> Emit(
+    "emit", llvm::cl::desc("Output produced by --aot"),
+    llvm::cl::values(
+        clEnumValN(EMIT_EXECUTABLE, "exe", "Linked native executable"),
+        clEnumValN(EMIT_OBJECT, "obj", "Native object file"),
+        clEnumValN(EMIT_BITCODE, "bc", "LLVM bitcode, e.g. for LTO")),
+    llvm::cl::init(EMIT_EXECUTABLE));
+static llvm::cl::opt<std::string> OutputFilename(
+    "o",
+    llvm::cl::desc("Output path for --aot (defaults to the program name)"),
+    llvm::cl::value_desc("filename"));
+
+static llvm::cl::opt<ExecMode> Exec(
+    "exec", llvm::cl::desc("How programs are run"),
+    llvm::cl::values(
+        clEnumValN(EXEC_JIT, "jit", "Compile the whole program, then run it"),
+        clEnumValN(EXEC_INTERP, "interp", "Interpret, never compiling"),
+        clEnumValN(EXEC_MIXED, "mixed",
+                   "Interpret, and compile procedures once they are hot"),
+        clEnumValN(EXEC_AUTO, "auto",
+                   "mixed for programs whose loops are short, jit for the "
+                   "rest"),
+        clEnumValN(EXEC_VM, "vm", "Compile to bytecode and run it in the VM")),
+    llvm::cl::init(EXEC_JIT));
+static llvm::cl::opt<unsigned> InterpThreshold(
+    "interp-threshold",
+    llvm::cl::desc("Calls and loop iterations after which interpreted "
+                   "procedures are compiled, and the most loop iterations "
+                   "per block --exec=auto interprets"),
+    llvm::cl::init(1000));
+static llvm::cl::opt<std::string> SaveBytecodeDir(
+    "save-bytecode",
+    llvm::cl::desc("With --exec=vm, also write the bytecode of every program "
+                   "to <dir>/<program>.mpbc"),
+    llvm::cl::value_desc("dir"));
+static llvm::cl::opt<std::string> RunBytecodeFile(
+    "run-bytecode",
+    llvm::cl::desc("Run bytecode written by --save-bytecode and exit"),
+    llvm::cl::value_desc("filename"));
+
+static llvm::cl::opt<bool> UseRTDyld(
+    "jit-rtdyld",
+    llvm::cl::desc("Link JIT code with RuntimeDyld instead of JITLink"));
+static llvm::cl::opt<bool> HugePages(
+    "jit-huge-pages",
+    llvm::cl::desc("Back JIT code memory with transparent huge pages"));
+static llvm::cl::opt<unsigned> SlabSizeMB(
+    "jit-slab-size", llvm::cl::desc("Size of JIT memory slabs in MiB"),
+    llvm::cl::init(64));
+static llvm::cl::opt<unsigned> JITThreads(
+    "jit-threads",
+    llvm::cl::desc("Threads compiling procedures in parallel (0: compile on "
+                   "the calling thread)"),
+    llvm::cl::init(0));
+static llvm::cl::opt<bool> ProcessSymbols(
+    "jit-process-symbols",
+    llvm::cl::desc("Let JIT code call any function exported by a shared "
+                   "library loaded into the compiler, not just the runtime"));
+static llvm::cl::opt<bool> MemStats(
+    "jit-mem-stats",
+    llvm::cl::desc("Report JIT code memory after every program"));
+static llvm::cl::opt<PerfFormat> Perf(
+    "perf", llvm::cl::desc("Tell perf where JIT-compiled procedures are"),
+    llvm::cl::values(
+        clEnumValN(PERF_MAP, "map", "Write /tmp/perf-<pid>.map"),
+        clEnumValN(PERF_JITDUMP, "jitdump",
+                   "Write <perf-dir>/jit-<pid>.dump for perf inject --jit")),
+    llvm::cl::init(PERF_OFF));
+static llvm::cl::opt<std::string> PerfDir(
+    "perf-dir", llvm::cl::desc("Directory for --perf=jitdump files"),
+    llvm::cl::value_desc("dir"), llvm::cl::init("/tmp"));
+
+static llvm::cl::opt<std::string> MCPU(
+    "mcpu",
+    llvm::cl::desc("Target CPU (default: the host CPU for the JIT and a "
+                   "generic CPU for --aot, use 'native' for the host)"),
+    llvm::cl::value_desc("cpu-name"));
+static llvm::cl::list<std::string> MAttrs(
+    "mattr", llvm::cl::CommaSeparated,
+    llvm::cl::desc("Target features to enable (+feature) or disable "
+                   "(-feature)"),
+    llvm::cl::value_desc("+a1,-a2,..."));
+
+static llvm::cl::opt<bool> SessionMode(
+    "session",
+    llvm::cl::desc("Keep procedures linked across programs. Enables the "
+                   "'redefine program' and 'unload <procedure>' commands"));
+
+static llvm::cl::opt<bool> AutoParallel(
+    "auto-parallel",
+    llvm::cl::desc("Run for loops whose iterations are independent in "
+                   "parallel, and report why the others are not"));
+static llvm::cl::opt<int64_t> AutoParallelMinTrips(
+    "auto-parallel-min-trips",
+    llvm::cl::desc("Loops with fewer iterations run serially under "
+                   "--auto-parallel"),
+    llvm::cl::init(1000));
+
+static llvm::cl::opt<unsigned> ProgramThreads(
+    "program-threads",
+    llvm::cl::desc("Compile and run up to N programs at the same time, each "
+                   "in its own JITDylib (0: one at a time)"),
+    llvm::cl::value_desc("N"), llvm::cl::init(0));
+
+static llvm::cl::opt<unsigned> PipelineDepth(
+    "pipeline-depth",
+    llvm::cl::desc("Parse stdin on a separate thread, up to N programs ahead "
+                   "of the one running (0: parse each program after the "
+                   "previous one has run)"),
+    llvm::cl::value_desc("N"), llvm::cl::init(0));
+
+static llvm::cl::opt<bool> Stream(
+    "stream",
+    llvm::cl::desc("Compile each procedure as soon as it has been parsed and "
+                   "free its AST, instead of parsing the whole program "
+                   "first"));
+
+static llvm::cl::list<std::string> InputFiles(
+    llvm::cl::Positional,
+    llvm::cl::desc("[files...] (compile or run these instead of stdin)"));
+static llvm::cl::opt<unsigned> BatchJobs(
+    "j", llvm::cl::Prefix,
+    llvm::cl::desc("Files processed in parallel (0: one per core)"),
+    llvm::cl::value_desc("N"), llvm::cl::init(1));
+
+static llvm::cl::opt<bool> ServeMode(
+    "serve",
+    llvm::cl::desc("Keep the JIT warm and run programs sent by mpclient over "
+                   "a Unix socket instead of reading stdin"));
+static llvm::cl::opt<std::string> SocketPath(
+    "socket",
+    llvm::cl::desc("Socket for --serve (default: $MICROPASCAL_SOCKET or "
+                   "/tmp/micropascal-<uid>.sock)"),
+    llvm::cl::value_desc("path"));
+
+static void PrintMemoryStats() {
+    auto Stats = TheJIT->getMemoryStats();
+    if (!Stats) {
+        fprintf(stderr, "JIT memory stats require JITLink\n");
+        return;
+    }
+    fprintf(stderr,
+            "JIT memory: %zu KiB allocated in %zu allocations (peak %zu "
+            "KiB), %zu KiB reserved\n",
+            Stats->AllocatedBytes / 1024, Stats->LiveAllocations,
+            Stats->PeakAllocatedBytes / 1024, Stats->ReservedBytes / 1024);
+}
+
+static std::string GetOutputPath(const ProgramAST &P) {
+    if (!OutputFilename.empty()) {
+        return OutputFilename;
+    }
+
+    switch (Emit) {
+        case EMIT_OBJECT:
+            return P.GetName() + ".o";
+        case EMIT_BITCODE:
+            return P.GetName() + ".bc";
+        default:
+            return P.GetName();
+    }
+}
+
+// Adds the time a program spent to the totals, except for parsing, which
+// is timed where the program is read
+static void AddTimings(const PhaseTimings &T) {
+    Timings.Codegen += T.Codegen;
+    Timings.Link += T.Link;
+    Timings.Execute += T.Execute;
+}
+
+static PhaseTimings RunInVM(ProgramAST &P) {
+    PhaseTimings T;
+    auto Start = std::chrono::steady_clock::now();
+    std::unique_ptr<BytecodeProgram> Bytecode = CompileBytecode(P);
+    std::chrono::duration<double> Elapsed =
+        std::chrono::steady_clock::now() - Start;
+    T.Codegen = Elapsed.count();
+    if (!Bytecode) {
+        return T;
+    }
+    if (!SaveBytecodeDir.empty()) {
+        ExitOnErr(SaveBytecode(
+            *Bytecode, SaveBytecodeDir + "/" + P.GetName() + ".mpbc"));
+    }
+
+    Start = std::chrono::steady_clock::now();
+    RunBytecode(*Bytecode);
+    Elapsed = std::chrono::steady_clock::now() - Start;
+    T.Execute = Elapsed.count();
+    return T;
+}
+
+// Runs Action right away, or with --pipeline-depth on the main thread once
+// everything parsed before it has run
+static void Dispatch(std::function<void()> Action) {
+    if (ThePipeline) {
+        ThePipeline->Push(std::move(Action));
+    } else {
+        Action();
+    }
+}
+
+// Programs from input files may run at the same time as others, so they
+// get a compiler and JITDylib of their own instead of the shared ones
+static PhaseTimings RunBatchProgram(std::unique_ptr<ProgramAST> P) {
+    if (!AOT) {
+        return RunIsolated(*TheJIT, std::move(P));
+    }
+
+    // Programs in different files may share a name, and with it an output
+    // path that two threads would write at once
+    static std::mutex PathsMutex;
+    static std::set<std::string> Paths;
+    std::string Path = GetOutputPath(*P);
+    {
+        std::lock_guard<std::mutex> Lock(PathsMutex);
+        if (!Paths.insert(Path).second) {
+            std::string Msg = "Another program has already been written to '" +
+                              Path + "', rename program '" + P->GetName() +
+                              "'";
+            LogError(Msg.c_str());
+            return {};
+        }
+    }
+
+    // Neither sessions nor TargetMachines can be shared between threads
+    static thread_local CompilerSession Compiler(
+        ExitOnErr(CreateHostTargetMachine(
+            MCPU, std::vector<std::string>(MAttrs.begin(), MAttrs.end()))));
+    CodeGen CG(&Compiler);
+    CG.CompileToFile(std::move(P), Compiler.GetTargetMachine(), Emit, Path);
+    return CG.GetTimings();
+}
 
-extern "C" void writeln(int64_t v) {
-    fprintf(stderr, "%" PRIi64, v);
-    fprintf(stderr, "\n");
+static void RunProgram(std::unique_ptr<ProgramAST> P, bool Redefine) {
+    if (!InputFiles.empty()) {
+        AddTimings(RunBatchProgram(std::move(P)));
+        return;
+    }
+    if (AOT) {
+        CodeGen CG(TheCompiler.get());
+        std::string Path = GetOutputPath(*P);
+        CG.CompileToFile(std::move(P), TheCompiler->GetTargetMachine(), Emit,
+                         Path);
+        return;
+    }
+
+    if (TheRunner) {
+        TheRunner->Submit(std::move(P));
+        return;
+    }
+    if (TheSession) {
+        TheSession->RunProgram(std::move(P), Redefine);
+    } else {
+        ExecMode Mode =
+            Exec == EXEC_AUTO ? ChooseExecMode(*P, InterpThreshold) : Exec;
+        PhaseTimings T;
+        if (Mode == EXEC_JIT) {
+            CodeGen CG(TheCompiler.get());
+            CG.CompileAndRun(std::move(P), *TheJIT);
+            T = CG.GetTimings();
+        } else if (Mode == EXEC_VM) {
+            T = RunInVM(*P);
+        } else {
+            T = Interpret(*P, Mode == EXEC_MIXED ? TheJIT.get() : nullptr,
+                          InterpThreshold);
+        }
+        AddTimings(T);
+    }
+    if (MemStats) {
+        PrintMemoryStats();
+    }
+}
+
+// Parsing is interleaved with codegen, so its time counts as codegen
+static void StreamProgram() {
+    CodeGen CG(TheCompiler.get());
+    bool Parsed = false;
+    ProgramStream Source = [&Parsed](CodeGen &Gen) {
+        auto P = ParseProgram([&Gen](std::unique_ptr<FunctionAST> F) {
+            Gen.AddProcedure(std::move(F));
+        });
+        Parsed = P != nullptr;
+        return P;
+    };
+    if (AOT) {
+        CG.CompileToFile(Source, TheCompiler->GetTargetMachine(), Emit,
+                         GetOutputPath);
+    } else {
+        CG.CompileAndRun(Source, *TheJIT);
+        AddTimings(CG.GetTimings());
+    }
+    if (!Parsed) {
+        getNextToken();
+    }
+    if (MemStats) {
+        PrintMemoryStats();
+    }
 }
 
-void HandleProgram() {
-    if (auto P = ParseProgram()) {
-        CodeGen CG;
-        CG.CompileAndRun(std::move(P), *TheJIT);
+void HandleProgram(bool Redefine = false) {
+    if (Stream) {
+        return StreamProgram();
+    }
+    auto ParseStart = std::chrono::steady_clock::now();
+    auto P = ParseProgram();
+    std::chrono::duration<double> ParseTime =
+        std::chrono::steady_clock::now() - ParseStart;
+    Timings.Parse += ParseTime.count();
+
+    if (P) {
+        if (AutoParallel) {
+            AutoParallelize(*P, std::max<int64_t>(1, AutoParallelMinTrips));
+        }
+
+        // std::function needs a copyable callable
+        auto Shared =
+            std::make_shared<std::unique_ptr<ProgramAST>>(std::move(P));
+        Dispatch([Shared, Redefine]() {
+            RunProgram(std::move(*Shared), Redefine);
+        });
     } else {
         getNextToken();
     }
 }
 
+void HandleRedefine() {
+    getNextToken();  // redefine
+    if (CurTok != tok_program) {
+        LogError("Expected 'program' after 'redefine'");
+        return;
+    }
+    HandleProgram(true);
+}
+
+void HandleUnload() {
+    getNextToken();  // unload
+    if (CurTok != tok_identifier) {
+        LogError("Expected a procedure name after 'unload'");
+        return;
+    }
+    Dispatch([Name = IdentifierStr]() { TheSession->Unload(Name); });
+    getNextToken();  // procedure name
+}
+
 void MainLoop() {
     while (true) {
         switch (CurTok) {
@@ -36,26 +395,157 @@ void MainLoop() {
             case tok_program:
                 HandleProgram();
                 break;
+            case tok_identifier:
+                // Session commands are not keywords, so that they remain
+                // usable as identifiers inside programs
+                if (TheSession && IdentifierStr == "redefine") {
+                    HandleRedefine();
+                } else if (TheSession && IdentifierStr == "unload") {
+                    HandleUnload();
+                } else {
+                    LogError("Unexpected identifier at top level");
+                    getNextToken();
+                }
+                break;
             default:
+                // Would otherwise be looked at again forever
+                LogError("Expected 'program' at top level");
+                getNextToken();
                 break;
         }
-        fprintf(stderr, "ready> ");
+        if (!ServeMode && InputFiles.empty()) {
+            fprintf(stderr, "ready> ");
+        }
+    }
+}
+
+// Runs every program in Source, for --serve requests and input files
+static PhaseTimings RunSource(std::FILE *Source) {
+    Timings = {};
+    SetLexerInput(Source);
+    getNextToken();
+    MainLoop();
+    if (TheRunner) {
+        AddTimings(TheRunner->Wait());
     }
+    return Timings;
 }
 
-int main() {
+int main(int argc, char **argv) {
+    llvm::cl::ParseCommandLineOptions(argc, argv, "micropascal JIT compiler\n");
+
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
     llvm::InitializeNativeTargetAsmParser();
 
     InstantiateBinopPrecendence();
 
-    fprintf(stderr, "ready> ");
-    getNextToken();
+    // Batch runs put every file in a JITDylib of its own, as
+    // --program-threads does
+    bool ProgramJITDylibs = ProgramThreads > 0 || !InputFiles.empty();
+    bool CompileAndRun = !AOT && !SessionMode && Exec == EXEC_JIT;
+    if (!CheckCodeGenOptions(CompileAndRun, !AOT && ProgramJITDylibs)) {
+        return 1;
+    }
+    if (Exec != EXEC_JIT &&
+        (AOT || SessionMode || ProgramThreads > 0 || !InputFiles.empty())) {
+        LogError("--exec cannot be combined with --aot, --session, "
+                 "--program-threads or input files");
+        return 1;
+    }
+    if (Stream && (SessionMode || ProgramThreads > 0 || PipelineDepth > 0 ||
+                   AutoParallel || Exec != EXEC_JIT || !InputFiles.empty())) {
+        LogError("--stream cannot be combined with --session, "
+                 "--program-threads, --pipeline-depth, --auto-parallel, "
+                 "--exec or input files");
+        return 1;
+    }
+    if (!SaveBytecodeDir.empty() && Exec != EXEC_VM) {
+        LogError("--save-bytecode requires --exec=vm");
+        return 1;
+    }
 
-    TheJIT = ExitOnErr(llvm::orc::KaleidoscopeJIT::Create());
+    // Needs neither LLVM nor a JIT, which is what makes it quick to start
+    if (!RunBytecodeFile.empty()) {
+        auto Bytecode = ExitOnErr(LoadBytecode(RunBytecodeFile));
+        return RunBytecode(*Bytecode) ? 0 : 1;
+    }
 
-    MainLoop();
+    if (AOT) {
+        TheCompiler = std::make_unique<CompilerSession>(
+            ExitOnErr(CreateHostTargetMachine(
+                MCPU,
+                std::vector<std::string>(MAttrs.begin(), MAttrs.end()))));
+    } else {
+        llvm::orc::KaleidoscopeJITOptions Opts;
+        Opts.UseJITLink = !UseRTDyld;
+        Opts.HugePages = HugePages;
+        Opts.SlabSize = size_t(SlabSizeMB) * 1024 * 1024;
+        Opts.MaterializationThreads = JITThreads;
+        if (MCPU != "native") {
+            Opts.CPU = MCPU;
+        }
+        Opts.Features.assign(MAttrs.begin(), MAttrs.end());
+        Opts.ProcessSymbols = ProcessSymbols;
+        TheJIT = ExitOnErr(llvm::orc::KaleidoscopeJIT::Create(Opts));
+        ExitOnErr(DefineRuntimeSymbols(*TheJIT));
+        ExitOnErr(EnablePerfSupport(*TheJIT, Perf, PerfDir));
+        TheCompiler = std::make_unique<CompilerSession>(
+            ExitOnErr(TheJIT->createTargetMachine()));
+        if (SessionMode && ProgramThreads > 0) {
+            LogError("--session cannot be combined with --program-threads");
+            return 1;
+        }
+        if (SessionMode) {
+            TheSession = std::make_unique<ReplSession>(*TheJIT);
+        }
+        if (ProgramThreads > 0) {
+            TheRunner =
+                std::make_unique<ConcurrentRunner>(*TheJIT, ProgramThreads);
+        }
+    }
+
+    if (!InputFiles.empty()) {
+        if (SessionMode || ServeMode) {
+            LogError("Input files cannot be combined with --session or "
+                     "--serve");
+            return 1;
+        }
+        if (!OutputFilename.empty() && InputFiles.size() > 1) {
+            LogError("-o cannot be used with several input files");
+            return 1;
+        }
+        std::vector<std::string> Files(InputFiles.begin(), InputFiles.end());
+        return RunBatch(Files, BatchJobs, RunSource) ? 1 : 0;
+    }
+
+    if (ServeMode) {
+        return Serve(SocketPath.empty() ? DefaultSocketPath() : SocketPath,
+                     RunSource);
+    }
+
+    fprintf(stderr, "ready> ");
+    if (PipelineDepth > 0) {
+        ThePipeline = std::make_unique<ActionQueue>(PipelineDepth);
+        std::thread Reader([]() {
+            getNextToken();
+            MainLoop();
+            ThePipeline->Close();
+        });
+
+        // Programs run on the main thread, as they do without a pipeline
+        std::function<void()> Action;
+        while (ThePipeline->Pop(Action)) {
+            Action();
+        }
+        Reader.join();
+    } else {
+        getNextToken();
+        MainLoop();
+    }
+    if (TheRunner) {
+        TheRunner->Wait();
+    }
 
     return 0;
 }
\ No newline at end of file
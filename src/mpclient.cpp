@@ -0,0 +1,78 @@
+// Sends programs to a compiler started with --serve and prints the result as
+// if the compiler had run them itself.
+//
+//   mpclient [--socket <path>] [--timings] [file...]
+//
+// Reads the files in order, or stdin if there are none. Exits with 1 if
+// compilation reported errors and 2 if the server could not be reached.
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "server/protocol.h"
+
+int main(int argc, char **argv) {
+    std::string SocketPath = DefaultSocketPath();
+    bool PrintTimings = false;
+    std::string Source;
+    bool HaveFiles = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--socket") && i + 1 < argc) {
+            SocketPath = argv[++i];
+        } else if (!std::strncmp(argv[i], "--socket=", 9)) {
+            SocketPath = argv[i] + 9;
+        } else if (!std::strcmp(argv[i], "--timings")) {
+            PrintTimings = true;
+        } else {
+            std::ifstream File(argv[i]);
+            if (!File) {
+                std::cerr << "mpclient: cannot read " << argv[i] << "\n";
+                return 2;
+            }
+            std::ostringstream Contents;
+            Contents << File.rdbuf();
+            Source += Contents.str();
+            Source += '\n';
+            HaveFiles = true;
+        }
+    }
+    if (!HaveFiles && !ReadAll(STDIN_FILENO, Source)) {
+        std::perror("mpclient: stdin");
+        return 2;
+    }
+
+    int Server = ConnectToServer(SocketPath);
+    if (Server < 0) {
+        std::perror(("mpclient: " + SocketPath).c_str());
+        return 2;
+    }
+    if (!WriteAll(Server, Source.data(), Source.size()) ||
+        shutdown(Server, SHUT_WR) < 0) {
+        std::perror("mpclient: send");
+        return 2;
+    }
+
+    std::string Kind, Payload;
+    while (ReadFrame(Server, Kind, Payload)) {
+        if (Kind == "stdout") {
+            std::fwrite(Payload.data(), 1, Payload.size(), stdout);
+        } else if (Kind == "stderr") {
+            std::fwrite(Payload.data(), 1, Payload.size(), stderr);
+        } else if (Kind == "timings" && PrintTimings) {
+            std::fwrite(Payload.data(), 1, Payload.size(), stderr);
+        } else if (Kind == "status") {
+            return Payload == "ok" ? 0 : 1;
+        }
+    }
+
+    std::cerr << "mpclient: connection closed before the result arrived\n";
+    return 2;
+}
@@ -10,11 +10,12 @@ int GetTokPrecendence() {
         return -1;
     }
 
-    int TokPrec = BinopPrecedence[CurTok];
-    if (TokPrec <= 0) {
+    // Not operator[], which would insert and race with other parsing threads
+    auto It = BinopPrecedence.find(CurTok);
+    if (It == BinopPrecedence.end() || It->second <= 0) {
         return -1;
     }
-    return TokPrec;
+    return It->second;
 }
 
 void InstantiateBinopPrecendence() {
@@ -27,7 +28,7 @@ void InstantiateBinopPrecendence() {
 }
 
 std::unique_ptr<ExprAST> ParseNumberExpr() {
-    auto Result = std::make_unique<NumberExprAST>(NumVal);
+    auto Result = std::make_unique<NumberExprAST>(NumVal, NumIsReal);
     getNextToken();
     return std::move(Result);
 }
@@ -92,6 +93,11 @@ std::unique_ptr<ExprAST> ParsePrimary() {
             return ParseIdentifierExpr();
         case tok_number:
             return ParseNumberExpr();
+        case tok_string: {
+            auto Result = std::make_unique<StringExprAST>(StringVal);
+            getNextToken();  // string
+            return std::move(Result);
+        }
         case tok_true:
             getNextToken();  // true
             return std::make_unique<ConcreteBoolExprAST>(true);
@@ -244,7 +250,8 @@ std::unique_ptr<VariableDeclAST> ParseVariableDecl() {
 
     getNextToken();  // :
     VarType Type;
-    if (!(CurTok == tok_integer || CurTok == tok_boolean)) {
+    if (!(CurTok == tok_integer || CurTok == tok_boolean ||
+          CurTok == tok_real)) {
         LogError("Expected type identifier after variable list");
         return nullptr;
     }
@@ -253,6 +260,8 @@ std::unique_ptr<VariableDeclAST> ParseVariableDecl() {
         Type = TYPE_INTEGER;
     } else if (IdentifierStr == "boolean") {
         Type = TYPE_BOOLEAN;
+    } else if (IdentifierStr == "real") {
+        Type = TYPE_REAL;
     } else {
         LogError("Unknown type identifier");
         return nullptr;
@@ -349,7 +358,56 @@ std::unique_ptr<IfStatementAST> ParseIfStatement() {
                                             nullptr);
 }
 
-std::unique_ptr<ForStatementAST> ParseForStatement() {
+// reduce(<op>: <identifierList>; ...) where <op> is +, *, min or max
+bool ParseReductions(std::vector<Reduction> &Reductions) {
+    getNextToken();  // reduce
+    if (CurTok != '(') {
+        LogError("Expected '(' after 'reduce'");
+        return false;
+    }
+
+    do {
+        getNextToken();  // ( or ;
+        ReductionOp Op;
+        if (CurTok == '+') {
+            Op = REDUCE_ADD;
+        } else if (CurTok == '*') {
+            Op = REDUCE_MUL;
+        } else if (CurTok == tok_identifier && IdentifierStr == "min") {
+            Op = REDUCE_MIN;
+        } else if (CurTok == tok_identifier && IdentifierStr == "max") {
+            Op = REDUCE_MAX;
+        } else {
+            LogError("Expected '+', '*', 'min' or 'max' in reduction");
+            return false;
+        }
+        getNextToken();  // operator
+
+        if (CurTok != ':') {
+            LogError("Expected ':' after reduction operator");
+            return false;
+        }
+
+        do {
+            getNextToken();  // : or ,
+            if (CurTok != tok_identifier) {
+                LogError("Expected variable name in reduction");
+                return false;
+            }
+            Reductions.push_back({Op, IdentifierStr});
+            getNextToken();  // variable name
+        } while (CurTok == ',');
+    } while (CurTok == ';');
+
+    if (CurTok != ')') {
+        LogError("Expected ')' after reductions");
+        return false;
+    }
+    getNextToken();  // )
+    return true;
+}
+
+std::unique_ptr<ForStatementAST> ParseForStatement(bool Parallel) {
     if (CurTok != tok_for) {
         LogError("Expected 'for'");
         return nullptr;
@@ -395,6 +453,19 @@ std::unique_ptr<ForStatementAST> ParseForStatement() {
         return nullptr;
     }
 
+    // Like min and max, reduce is only a keyword where an identifier could
+    // not appear anyway, so programs may still name variables after it
+    std::vector<Reduction> Reductions;
+    if (CurTok == tok_identifier && IdentifierStr == "reduce") {
+        if (!Parallel) {
+            LogError("'reduce' is only allowed in a parallel for");
+            return nullptr;
+        }
+        if (!ParseReductions(Reductions)) {
+            return nullptr;
+        }
+    }
+
     if (CurTok != tok_do) {
         LogError("Expected 'do' in for");
         return nullptr;
@@ -407,7 +478,8 @@ std::unique_ptr<ForStatementAST> ParseForStatement() {
     }
 
     return std::make_unique<ForStatementAST>(IdName, std::move(Start),
-                                             std::move(End), std::move(Body));
+                                             std::move(End), std::move(Body),
+                                             Parallel, std::move(Reductions));
 }
 
 std::unique_ptr<StatementAST> ParseStatement() {
@@ -415,6 +487,11 @@ std::unique_ptr<StatementAST> ParseStatement() {
         std::string Identifier = IdentifierStr;
         getNextToken();  // eat identifier name
 
+        // parallel only starts a loop when for follows it
+        if (Identifier == "parallel" && CurTok == tok_for) {
+            return ParseForStatement(true);
+        }
+
         if (CurTok != '(') {
             // Must be an assignment
             if (auto S = ParseVariableAssignment(Identifier)) {
@@ -535,7 +612,7 @@ std::unique_ptr<BlockAST> ParseBlock() {
                                       std::move(CompoundStatement));
 }
 
-std::unique_ptr<ProgramAST> ParseProgram() {
+std::unique_ptr<ProgramAST> ParseProgram(const ProcedureSink &OnProcedure) {
     getNextToken();  // program
     std::string ProgramName;
     if (CurTok == tok_identifier) {
@@ -555,7 +632,11 @@ std::unique_ptr<ProgramAST> ParseProgram() {
     std::vector<std::unique_ptr<FunctionAST>> Functions;
     while (CurTok == tok_procedure) {
         if (auto F = ParseDefinition()) {
-            Functions.push_back(std::move(F));
+            if (OnProcedure) {
+                OnProcedure(std::move(F));
+            } else {
+                Functions.push_back(std::move(F));
+            }
             if (CurTok != ';') {
                 LogError("Expected ';' after function definition");
                 return nullptr;
@@ -1,6 +1,7 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <functional>
 #include <map>
 #include <memory>
 
@@ -18,13 +19,23 @@ std::unique_ptr<FunctionAST> ParseDefinition();
 std::unique_ptr<VariableAssignmentAST> ParseVariableAssignment(
     std::string &Identifier);
 std::unique_ptr<IfStatementAST> ParseIfStatement();
-std::unique_ptr<ForStatementAST> ParseForStatement();
+std::unique_ptr<ForStatementAST> ParseForStatement(bool Parallel = false);
+bool ParseReductions(std::vector<Reduction> &Reductions);
 std::unique_ptr<StatementAST> ParseStatement();
 std::unique_ptr<VariableDeclAST> ParseVariableDecl();
 std::unique_ptr<DeclarationAST> ParseDeclarations();
 std::unique_ptr<CompoundStatementAST> ParseCompoundStatement();
 std::unique_ptr<BlockAST> ParseBlock();
-std::unique_ptr<ProgramAST> ParseProgram();
+
+/**
+ * Receives each procedure as soon as it has been parsed, instead of the
+ * ProgramAST, so that it can be compiled and freed before the next one is
+ * read
+ */
+typedef std::function<void(std::unique_ptr<FunctionAST>)> ProcedureSink;
+std::unique_ptr<ProgramAST> ParseProgram(
+    const ProcedureSink &OnProcedure = nullptr);
+
 std::unique_ptr<FunctionAST> ParseTopLevelExpr();
 
 extern std::map<char, int> BinopPrecedence;
@@ -0,0 +1,314 @@
+#include "perf/perf.h"
+
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <system_error>
+
+#include "llvm/ExecutionEngine/JITLink/JITLink.h"
+#include "llvm/Object/SymbolSize.h"
+
+using namespace llvm;
+
+static Error ErrnoError(const std::string &Path) {
+    std::error_code EC(errno, std::generic_category());
+    return createFileError(Path, errorCodeToError(EC));
+}
+
+// Where linked functions are written to. Code is linked on whichever thread
+// materializes it, so Record serializes the writes.
+class PerfWriter {
+    std::mutex Mutex;
+
+   protected:
+    virtual void Write(StringRef Name, uint64_t Addr, uint64_t Size) = 0;
+
+   public:
+    virtual ~PerfWriter() = default;
+
+    void Record(StringRef Name, uint64_t Addr, uint64_t Size) {
+        if (Size == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Write(Name, Addr, Size);
+    }
+};
+
+// One "<start> <size> <name>" line per function, in hex, which perf picks up
+// for the process with that pid
+class PerfMapWriter : public PerfWriter {
+    std::FILE *File;
+
+   protected:
+    virtual void Write(StringRef Name, uint64_t Addr, uint64_t Size) override {
+        std::fprintf(File, "%" PRIx64 " %" PRIx64 " %.*s\n", Addr, Size,
+                     static_cast<int>(Name.size()), Name.data());
+        // perf may read the map while the process is still running
+        std::fflush(File);
+    }
+
+   public:
+    PerfMapWriter(std::FILE *File) : File(File) {}
+    ~PerfMapWriter() { std::fclose(File); }
+
+    static Expected<std::unique_ptr<PerfWriter>> Create() {
+        std::string Path = "/tmp/perf-" + std::to_string(getpid()) + ".map";
+        std::FILE *File = std::fopen(Path.c_str(), "w");
+        if (!File) {
+            return ErrnoError(Path);
+        }
+        return std::make_unique<PerfMapWriter>(File);
+    }
+};
+
+// The jitdump format from tools/perf/Documentation/jitdump-specification.txt
+// in the Linux sources. Unlike a perf map it keeps a copy of the code, so
+// perf inject --jit can turn every function into an ELF image that perf
+// annotate can disassemble.
+namespace jitdump {
+const uint32_t Magic = 0x4A695444;
+const uint32_t Version = 1;
+
+enum RecordType : uint32_t {
+    CodeLoad = 0,
+    CodeClose = 3,
+};
+
+struct FileHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t TotalSize;
+    uint32_t ElfMach;
+    uint32_t Pad1;
+    uint32_t Pid;
+    uint64_t Timestamp;
+    uint64_t Flags;
+};
+
+struct RecordHeader {
+    uint32_t Id;
+    uint32_t TotalSize;
+    uint64_t Timestamp;
+};
+
+// Followed by the function's name, with a terminating null, and its code
+struct CodeLoadRecord {
+    RecordHeader Header;
+    uint32_t Pid;
+    uint32_t Tid;
+    uint64_t Vma;
+    uint64_t CodeAddr;
+    uint64_t CodeSize;
+    uint64_t CodeIndex;
+};
+
+static uint32_t HostMachine() {
+#if defined(__x86_64__)
+    return EM_X86_64;
+#elif defined(__i386__)
+    return EM_386;
+#elif defined(__aarch64__)
+    return EM_AARCH64;
+#elif defined(__arm__)
+    return EM_ARM;
+#elif defined(__riscv)
+    return EM_RISCV;
+#else
+    return EM_NONE;
+#endif
+}
+
+// Timestamps must match perf's clock, which is selected with perf record -k
+// mono
+static uint64_t Now() {
+    timespec TS;
+    clock_gettime(CLOCK_MONOTONIC, &TS);
+    return uint64_t(TS.tv_sec) * 1000000000 + TS.tv_nsec;
+}
+}  // namespace jitdump
+
+class JitDumpWriter : public PerfWriter {
+    std::FILE *File;
+    void *Marker;
+    size_t MarkerSize;
+    uint64_t CodeIndex = 0;
+
+   protected:
+    virtual void Write(StringRef Name, uint64_t Addr, uint64_t Size) override {
+        jitdump::CodeLoadRecord R;
+        R.Header.Id = jitdump::CodeLoad;
+        R.Header.TotalSize = sizeof(R) + Name.size() + 1 + Size;
+        R.Header.Timestamp = jitdump::Now();
+        R.Pid = getpid();
+        R.Tid = syscall(SYS_gettid);
+        R.Vma = Addr;
+        R.CodeAddr = Addr;
+        R.CodeSize = Size;
+        R.CodeIndex = CodeIndex++;
+
+        // The code is in this process, and has been linked by now
+        std::fwrite(&R, sizeof(R), 1, File);
+        std::fwrite(Name.data(), 1, Name.size(), File);
+        std::fputc('\0', File);
+        std::fwrite(reinterpret_cast<const void *>(Addr), 1, Size, File);
+        std::fflush(File);
+    }
+
+   public:
+    JitDumpWriter(std::FILE *File, void *Marker, size_t MarkerSize)
+        : File(File), Marker(Marker), MarkerSize(MarkerSize) {}
+
+    ~JitDumpWriter() {
+        jitdump::RecordHeader Close = {jitdump::CodeClose, sizeof(Close),
+                                       jitdump::Now()};
+        std::fwrite(&Close, sizeof(Close), 1, File);
+        munmap(Marker, MarkerSize);
+        std::fclose(File);
+    }
+
+    static Expected<std::unique_ptr<PerfWriter>> Create(
+        const std::string &Dir) {
+        std::string Path =
+            Dir + "/jit-" + std::to_string(getpid()) + ".dump";
+        int FD = open(Path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0666);
+        if (FD < 0) {
+            return ErrnoError(Path);
+        }
+
+        // perf finds the dump through an executable mapping of it in the
+        // process, which only has to exist, not be used
+        size_t MarkerSize = sysconf(_SC_PAGESIZE);
+        void *Marker = mmap(nullptr, MarkerSize, PROT_READ | PROT_EXEC,
+                            MAP_PRIVATE, FD, 0);
+        if (Marker == MAP_FAILED) {
+            Error Err = ErrnoError(Path);
+            close(FD);
+            return std::move(Err);
+        }
+
+        std::FILE *File = fdopen(FD, "w");
+        if (!File) {
+            Error Err = ErrnoError(Path);
+            munmap(Marker, MarkerSize);
+            close(FD);
+            return std::move(Err);
+        }
+
+        jitdump::FileHeader Header = {};
+        Header.Magic = jitdump::Magic;
+        Header.Version = jitdump::Version;
+        Header.TotalSize = sizeof(Header);
+        Header.ElfMach = jitdump::HostMachine();
+        Header.Pid = getpid();
+        Header.Timestamp = jitdump::Now();
+        std::fwrite(&Header, sizeof(Header), 1, File);
+        std::fflush(File);
+
+        return std::make_unique<JitDumpWriter>(File, Marker, MarkerSize);
+    }
+};
+
+// Records the callable symbols of every graph JITLink links, once their
+// addresses are final
+class PerfPlugin : public orc::ObjectLinkingLayer::Plugin {
+    std::unique_ptr<PerfWriter> Writer;
+
+   public:
+    PerfPlugin(std::unique_ptr<PerfWriter> Writer)
+        : Writer(std::move(Writer)) {}
+
+    virtual void modifyPassConfig(orc::MaterializationResponsibility &,
+                                  jitlink::LinkGraph &,
+                                  jitlink::PassConfiguration &Config) override {
+        Config.PostFixupPasses.push_back([this](jitlink::LinkGraph &G) {
+            for (jitlink::Symbol *Sym : G.defined_symbols()) {
+                if (Sym->isCallable() && Sym->hasName()) {
+                    Writer->Record(Sym->getName(), Sym->getAddress().getValue(),
+                                   Sym->getSize());
+                }
+            }
+            return Error::success();
+        });
+    }
+
+    virtual Error notifyFailed(orc::MaterializationResponsibility &) override {
+        return Error::success();
+    }
+
+    // perf keeps the names of removed code around anyway, in case it has
+    // samples from before
+    virtual Error notifyRemovingResources(orc::JITDylib &,
+                                          orc::ResourceKey) override {
+        return Error::success();
+    }
+
+    virtual void notifyTransferringResources(orc::JITDylib &, orc::ResourceKey,
+                                             orc::ResourceKey) override {}
+};
+
+// The same for objects loaded by RuntimeDyld
+class PerfEventListener : public JITEventListener {
+    std::unique_ptr<PerfWriter> Writer;
+
+   public:
+    PerfEventListener(std::unique_ptr<PerfWriter> Writer)
+        : Writer(std::move(Writer)) {}
+
+    virtual void notifyObjectLoaded(
+        ObjectKey, const object::ObjectFile &Obj,
+        const RuntimeDyld::LoadedObjectInfo &L) override {
+        // A copy of the object with its sections at their load addresses
+        object::OwningBinary<object::ObjectFile> Loaded =
+            L.getObjectForDebug(Obj);
+        if (!Loaded.getBinary()) {
+            return;
+        }
+
+        for (const auto &[Sym, Size] :
+             object::computeSymbolSizes(*Loaded.getBinary())) {
+            Expected<object::SymbolRef::Type> Type = Sym.getType();
+            if (!Type || *Type != object::SymbolRef::ST_Function) {
+                consumeError(Type.takeError());
+                continue;
+            }
+            Expected<StringRef> Name = Sym.getName();
+            Expected<uint64_t> Addr = Sym.getAddress();
+            if (!Name || !Addr) {
+                consumeError(Name.takeError());
+                consumeError(Addr.takeError());
+                continue;
+            }
+            Writer->Record(*Name, *Addr, Size);
+        }
+    }
+};
+
+Error EnablePerfSupport(orc::KaleidoscopeJIT &TheJIT, PerfFormat Format,
+                        const std::string &Dir) {
+    if (Format == PERF_OFF) {
+        return Error::success();
+    }
+
+    auto Writer = Format == PERF_MAP ? PerfMapWriter::Create()
+                                     : JitDumpWriter::Create(Dir);
+    if (!Writer) {
+        return Writer.takeError();
+    }
+    if (TheJIT.usesJITLink()) {
+        TheJIT.addObjectLinkingPlugin(
+            std::make_unique<PerfPlugin>(std::move(*Writer)));
+    } else {
+        TheJIT.addEventListener(
+            std::make_unique<PerfEventListener>(std::move(*Writer)));
+    }
+    return Error::success();
+}
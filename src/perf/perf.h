@@ -0,0 +1,26 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <string>
+
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "llvm/Support/Error.h"
+
+enum PerfFormat {
+    PERF_OFF,
+    // /tmp/perf-<pid>.map, read by perf report directly
+    PERF_MAP,
+    // <dir>/jit-<pid>.dump with a copy of the code, for perf inject --jit
+    PERF_JITDUMP,
+};
+
+/**
+ * Records the name, address and size of every function the JIT links from
+ * then on, so that perf can attribute samples in JIT code to procedures
+ * instead of showing unknown addresses. Works with both JITLink and
+ * RuntimeDyld. Dir is where jitdump files go.
+ */
+llvm::Error EnablePerfSupport(llvm::orc::KaleidoscopeJIT &TheJIT,
+                              PerfFormat Format, const std::string &Dir);
+
+#endif
@@ -0,0 +1,204 @@
+#include "pgo/pgo.h"
+
+#include <iostream>
+#include <map>
+#include <set>
+
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/ProfileData/InstrProf.h"
+#include "llvm/ProfileData/InstrProfReader.h"
+#include "llvm/ProfileData/InstrProfWriter.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/VirtualFileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Instrumentation/PGOInstrumentation.h"
+
+using namespace llvm;
+
+// Lets the counter lowering run between instrumentation and optimization
+// within a single pipeline
+struct LowerCountersPass : PassInfoMixin<LowerCountersPass> {
+    ProfiledProgram &P;
+
+    LowerCountersPass(ProfiledProgram &P) : P(P) {}
+
+    PreservedAnalyses run(Module &M, ModuleAnalysisManager &) {
+        P.LowerCounters(M);
+        return PreservedAnalyses::none();
+    }
+};
+
+ProfiledProgram::ProfiledProgram(std::string ProfilePath, PGOMode Mode)
+    : ProfilePath(std::move(ProfilePath)) {
+    Instrumented = Mode == PGO_GEN ||
+                   (Mode == PGO_AUTO && !sys::fs::exists(this->ProfilePath));
+}
+
+void ProfiledProgram::LowerCounters(Module &M) {
+    LLVMContext &Ctx = M.getContext();
+    Type *Int64Ty = Type::getInt64Ty(Ctx);
+    PointerType *PtrTy = PointerType::getUnqual(Ctx);
+
+    std::map<GlobalVariable *, FunctionCounters *> ByName;
+    std::set<GlobalVariable *> NameVars;
+    std::vector<Instruction *> Dead;
+
+    for (Function &F : M) {
+        for (Instruction &I : instructions(F)) {
+            if (auto *VP = dyn_cast<InstrProfValueProfileInst>(&I)) {
+                // Value profiles only matter for indirect calls and memory
+                // intrinsic sizes, neither of which we generate
+                NameVars.insert(VP->getName());
+                Dead.push_back(VP);
+                continue;
+            }
+
+            auto *Inc = dyn_cast<InstrProfIncrementInst>(&I);
+            if (!Inc) {
+                continue;
+            }
+
+            GlobalVariable *NameVar = Inc->getName();
+            FunctionCounters *&FC = ByName[NameVar];
+            if (!FC) {
+                Counters.push_back(std::make_unique<FunctionCounters>());
+                FC = Counters.back().get();
+                FC->Name = getPGOFuncNameVarInitializer(NameVar).str();
+                FC->Hash = Inc->getHash()->getZExtValue();
+                FC->Counts.resize(Inc->getNumCounters()->getZExtValue());
+            }
+
+            // The counters are never resized once code refers to them, so
+            // their addresses can be baked into the module
+            uint64_t *Counter = &FC->Counts[Inc->getIndex()->getZExtValue()];
+            IRBuilder<> Builder(Inc);
+            Value *Addr = ConstantExpr::getIntToPtr(
+                ConstantInt::get(Int64Ty, reinterpret_cast<uintptr_t>(Counter)),
+                PtrTy);
+            // Parallel loop bodies bump the same counters from several
+            // threads. Only the totals matter, so relaxed adds are enough.
+            Builder.CreateAtomicRMW(AtomicRMWInst::Add, Addr, Inc->getStep(),
+                                    MaybeAlign(8), AtomicOrdering::Monotonic);
+
+            NameVars.insert(NameVar);
+            Dead.push_back(Inc);
+        }
+    }
+
+    for (Instruction *I : Dead) {
+        I->eraseFromParent();
+    }
+    for (GlobalVariable *NameVar : NameVars) {
+        if (NameVar->use_empty()) {
+            NameVar->eraseFromParent();
+        }
+    }
+
+    // Only read by the profiling runtime, which is not linked in
+    if (auto *Version = M.getNamedGlobal(
+            INSTR_PROF_QUOTE(INSTR_PROF_RAW_VERSION_VAR))) {
+        Version->eraseFromParent();
+    }
+}
+
+Error ProfiledProgram::Optimize(Module &M, TargetMachine &TM) {
+    // Without it, PGOInstrumentationUse reports a diagnostic that ends the
+    // whole process, not just this program
+    if (!Instrumented && !sys::fs::exists(ProfilePath)) {
+        return createStringError(inconvertibleErrorCode(),
+                                 "No profile at " + ProfilePath +
+                                     ", run the program with --pgo=gen first");
+    }
+
+    LoopAnalysisManager LAM;
+    FunctionAnalysisManager FAM;
+    CGSCCAnalysisManager CGAM;
+    ModuleAnalysisManager MAM;
+
+    PassBuilder PB(&TM);
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    ModulePassManager MPM;
+    if (Instrumented) {
+        std::cerr << "pgo: instrumenting, profile will be written to "
+                  << ProfilePath << "\n";
+        MPM.addPass(PGOInstrumentationGen());
+        MPM.addPass(LowerCountersPass(*this));
+    } else {
+        std::cerr << "pgo: optimizing with " << ProfilePath << "\n";
+        MPM.addPass(PGOInstrumentationUse(ProfilePath));
+    }
+
+    // The profile reaches the pipeline as branch weights, entry counts and a
+    // profile summary on the module, so the default pipeline needs no PGO
+    // options of its own
+    MPM.addPass(PB.buildPerModuleDefaultPipeline(OptimizationLevel::O2));
+    MPM.run(M, MAM);
+
+    return Error::success();
+}
+
+Error ProfiledProgram::WriteProfile() {
+    if (!Instrumented) {
+        return Error::success();
+    }
+
+    auto Warn = [](Error Err) {
+        logAllUnhandledErrors(std::move(Err), errs(), "pgo: ");
+    };
+
+    InstrProfWriter Writer;
+    if (auto Err = Writer.mergeProfileKind(InstrProfKind::IRInstrumentation)) {
+        return Err;
+    }
+
+    // Accumulate over training runs instead of keeping only the last one
+    if (sys::fs::exists(ProfilePath)) {
+        auto FS = vfs::getRealFileSystem();
+        auto Reader = IndexedInstrProfReader::create(ProfilePath, *FS);
+        if (!Reader) {
+            return Reader.takeError();
+        }
+        if (auto Err = Writer.mergeProfileKind((*Reader)->getProfileKind())) {
+            return Err;
+        }
+        for (auto &Record : **Reader) {
+            Writer.addRecord(NamedInstrProfRecord(Record), Warn);
+        }
+        if ((*Reader)->hasError()) {
+            return (*Reader)->getError();
+        }
+    }
+
+    for (auto &FC : Counters) {
+        Writer.addRecord(NamedInstrProfRecord(FC->Name, FC->Hash, FC->Counts),
+                         Warn);
+    }
+
+    StringRef Dir = sys::path::parent_path(ProfilePath);
+    if (!Dir.empty()) {
+        if (auto EC = sys::fs::create_directories(Dir)) {
+            return errorCodeToError(EC);
+        }
+    }
+
+    std::error_code EC;
+    raw_fd_ostream OS(ProfilePath, EC, sys::fs::OF_None);
+    if (EC) {
+        return errorCodeToError(EC);
+    }
+    if (auto Err = Writer.write(OS)) {
+        return Err;
+    }
+
+    std::cerr << "pgo: wrote " << ProfilePath << "\n";
+    return Error::success();
+}
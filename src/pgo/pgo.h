@@ -0,0 +1,64 @@
+#ifndef PGO_H
+#define PGO_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Target/TargetMachine.h"
+
+enum PGOMode { PGO_OFF, PGO_GEN, PGO_USE, PGO_AUTO };
+
+/**
+ * Runs one program through profile-guided optimization.
+ *
+ * In the instrumented phase, LLVM's PGO instrumentation is added to the
+ * module and its counter intrinsics are lowered to atomic increments of
+ * buffers owned by this object, so no profiling runtime is needed. After the
+ * run, the counters are written to an indexed profile on disk and merged with
+ * any earlier runs. In the optimizing phase, the profile is attached to the
+ * module before the -O2 pipeline, so inlining, block layout and unrolling
+ * follow the recorded branch weights.
+ */
+class ProfiledProgram {
+    struct FunctionCounters {
+        std::string Name;
+        uint64_t Hash;
+        std::vector<uint64_t> Counts;
+    };
+
+    std::string ProfilePath;
+    bool Instrumented;
+    std::vector<std::unique_ptr<FunctionCounters>> Counters;
+
+    void LowerCounters(llvm::Module &M);
+    friend struct LowerCountersPass;
+
+   public:
+    /**
+     * PGO_AUTO instruments the program when ProfilePath does not exist yet
+     * and uses the profile otherwise. Mode must not be PGO_OFF.
+     */
+    ProfiledProgram(std::string ProfilePath, PGOMode Mode);
+
+    bool IsInstrumented() const { return Instrumented; }
+
+    /**
+     * Instruments M or applies the profile to it, then optimizes it for TM.
+     * M must not have been run through TheFPM, so that its control flow
+     * matches between the two phases. Fails if the profile to apply does not
+     * exist.
+     */
+    llvm::Error Optimize(llvm::Module &M, llvm::TargetMachine &TM);
+
+    /**
+     * Writes the counters of an instrumented run to the profile. Does nothing
+     * for an optimized program.
+     */
+    llvm::Error WriteProfile();
+};
+
+#endif
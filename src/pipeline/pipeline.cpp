@@ -0,0 +1,26 @@
+#include "pipeline/pipeline.h"
+
+void ActionQueue::Push(std::function<void()> Action) {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    NotFull.wait(Lock, [this]() { return Actions.size() < Capacity; });
+    Actions.push_back(std::move(Action));
+    NotEmpty.notify_one();
+}
+
+void ActionQueue::Close() {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Closed = true;
+    NotEmpty.notify_all();
+}
+
+bool ActionQueue::Pop(std::function<void()> &Action) {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    NotEmpty.wait(Lock, [this]() { return !Actions.empty() || Closed; });
+    if (Actions.empty()) {
+        return false;
+    }
+    Action = std::move(Actions.front());
+    Actions.pop_front();
+    NotFull.notify_one();
+    return true;
+}
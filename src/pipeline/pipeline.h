@@ -0,0 +1,38 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/**
+ * Hands work from the thread that reads and parses the input to the thread
+ * that compiles and runs it, in input order. Push blocks while Capacity
+ * actions are waiting, so parsing runs at most that far ahead of execution.
+ */
+class ActionQueue {
+    std::mutex Mutex;
+    std::condition_variable NotEmpty, NotFull;
+    std::deque<std::function<void()>> Actions;
+    size_t Capacity;
+    bool Closed = false;
+
+   public:
+    ActionQueue(size_t Capacity) : Capacity(Capacity) {}
+
+    void Push(std::function<void()> Action);
+
+    /**
+     * Tells the consumer that nothing more will be pushed
+     */
+    void Close();
+
+    /**
+     * Waits for the next action. Returns false once the queue has been
+     * closed and drained.
+     */
+    bool Pop(std::function<void()> &Action);
+};
+
+#endif
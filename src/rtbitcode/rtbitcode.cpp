@@ -0,0 +1,60 @@
+#include "rtbitcode/rtbitcode.h"
+
+#include <string>
+#include <vector>
+
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Linker/Linker.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#ifdef MICROPASCAL_RUNTIME_BITCODE
+// Generated from runtime/inline.cpp, defines RuntimeBitcode
+#include "runtime_bitcode.inc"
+#endif
+
+using namespace llvm;
+
+Error LinkRuntime(Module &M) {
+#ifndef MICROPASCAL_RUNTIME_BITCODE
+    return Error::success();
+#else
+    auto Runtime = parseBitcodeFile(
+        MemoryBufferRef(
+            StringRef(reinterpret_cast<const char *>(RuntimeBitcode),
+                      sizeof(RuntimeBitcode)),
+            "micropascal.runtime"),
+        M.getContext());
+    if (!Runtime) {
+        return Runtime.takeError();
+    }
+
+    // The bitcode was built for a generic CPU. Dropping its target
+    // attributes lets the helpers be tuned and inlined like program code.
+    (*Runtime)->setTargetTriple(M.getTargetTriple());
+    (*Runtime)->setDataLayout(M.getDataLayout());
+    std::vector<std::string> Helpers;
+    for (Function &F : **Runtime) {
+        if (F.isDeclaration()) {
+            continue;
+        }
+        F.removeFnAttr("target-cpu");
+        F.removeFnAttr("target-features");
+        F.removeFnAttr("tune-cpu");
+        Helpers.push_back(F.getName().str());
+    }
+
+    if (Linker::linkModules(M, std::move(*Runtime), Linker::LinkOnlyNeeded)) {
+        return createStringError(inconvertibleErrorCode(),
+                                 "failed to link the runtime bitcode");
+    }
+
+    for (auto &Name : Helpers) {
+        Function *F = M.getFunction(Name);
+        if (F && !F->isDeclaration()) {
+            F->setLinkage(GlobalValue::InternalLinkage);
+            F->addFnAttr(Attribute::AlwaysInline);
+        }
+    }
+    return Error::success();
+#endif
+}
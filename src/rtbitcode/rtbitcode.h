@@ -0,0 +1,16 @@
+#ifndef RTBITCODE_H
+#define RTBITCODE_H
+
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Error.h"
+
+/**
+ * Links the runtime helpers that M calls from the bitcode embedded at build
+ * time. They are given internal linkage, so every module carries its own
+ * copy, and are marked always_inline so that the next inliner run folds them
+ * into their callers. Does nothing if the build had no clang to produce the
+ * bitcode; the calls then resolve to the host's copies.
+ */
+llvm::Error LinkRuntime(llvm::Module &M);
+
+#endif
@@ -0,0 +1,79 @@
+#include "runner/runner.h"
+
+#include "runtime/runtime.h"
+
+using namespace llvm;
+
+// Serializes the copies to stdout
+static std::mutex OutputMutex;
+
+OutputCapture::OutputCapture() : File(std::tmpfile()) {
+    if (File) {
+        PreviousFD = mp_set_output_fd(fileno(File));
+    }
+}
+
+void OutputCapture::Release() {
+    if (!File) {
+        return;
+    }
+    mp_set_output_fd(PreviousFD);
+
+    std::lock_guard<std::mutex> Lock(OutputMutex);
+    std::rewind(File);
+    char Buffer[64 * 1024];
+    size_t Read;
+    while ((Read = std::fread(Buffer, 1, sizeof(Buffer), File)) > 0) {
+        std::fwrite(Buffer, 1, Read, stdout);
+    }
+    std::fflush(stdout);
+    std::fclose(File);
+    File = nullptr;
+}
+
+PhaseTimings RunIsolated(orc::KaleidoscopeJIT &TheJIT,
+                         std::unique_ptr<ProgramAST> P) {
+    static std::atomic<unsigned> NextId = 0;
+    ExitOnError ExitOnErr;
+
+    // Programs may share a name, so the JITDylib name includes an id
+    orc::JITDylib &JD = ExitOnErr(TheJIT.createProgramJITDylib(
+        P->GetName() + "#" + std::to_string(NextId++)));
+
+    // Sessions cannot be shared between threads
+    static thread_local CompilerSession Compiler(
+        ExitOnErr(TheJIT.createTargetMachine()));
+    CodeGen CG(&Compiler);
+    // Other programs print to stderr at the same time
+    CG.SetVerbose(false);
+    CG.CompileAndRun(std::move(P), TheJIT, &JD);
+
+    ExitOnErr(TheJIT.removeJITDylib(JD));
+    return CG.GetTimings();
+}
+
+ConcurrentRunner::ConcurrentRunner(orc::KaleidoscopeJIT &TheJIT,
+                                   unsigned Threads)
+    : TheJIT(TheJIT), Pool(hardware_concurrency(Threads)) {}
+
+void ConcurrentRunner::Submit(std::unique_ptr<ProgramAST> P) {
+    // ThreadPool tasks must be copyable, so the program travels as a shared
+    // pointer until the task takes it over
+    auto Shared = std::make_shared<std::unique_ptr<ProgramAST>>(std::move(P));
+    Pool.async([this, Shared]() {
+        OutputCapture Capture;
+        PhaseTimings T = RunIsolated(TheJIT, std::move(*Shared));
+        std::lock_guard<std::mutex> Lock(TimingsMutex);
+        Timings.Codegen += T.Codegen;
+        Timings.Link += T.Link;
+        Timings.Execute += T.Execute;
+    });
+}
+
+PhaseTimings ConcurrentRunner::Wait() {
+    Pool.wait();
+    std::lock_guard<std::mutex> Lock(TimingsMutex);
+    PhaseTimings T = Timings;
+    Timings = {};
+    return T;
+}
@@ -0,0 +1,65 @@
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+#include "ast/ast.h"
+#include "codegen/codegen.h"
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "llvm/Support/ThreadPool.h"
+
+/**
+ * Collects the output of programs run by the calling thread in a temporary
+ * file until Release() writes it to stdout in one piece, so that output from
+ * programs running on other threads is not interleaved with it.
+ */
+class OutputCapture {
+    std::FILE *File;
+    int PreviousFD = -1;
+
+   public:
+    OutputCapture();
+    ~OutputCapture() { Release(); }
+
+    void Release();
+};
+
+/**
+ * Compiles and runs P in a JITDylib of its own, which is removed afterwards,
+ * and returns the time spent on it
+ */
+PhaseTimings RunIsolated(llvm::orc::KaleidoscopeJIT &TheJIT,
+                         std::unique_ptr<ProgramAST> P);
+
+/**
+ * Compiles and runs programs concurrently on a pool of threads.
+ *
+ * Every program is linked into a JITDylib of its own, so that the
+ * micropascal_main and procedures of one program do not clash with those of
+ * another. Each program's output is captured and written out once it has
+ * finished, so programs may complete in any order but their output is never
+ * interleaved.
+ */
+class ConcurrentRunner {
+    llvm::orc::KaleidoscopeJIT &TheJIT;
+    llvm::ThreadPool Pool;
+    std::mutex TimingsMutex;
+    PhaseTimings Timings;
+
+   public:
+    ConcurrentRunner(llvm::orc::KaleidoscopeJIT &TheJIT, unsigned Threads);
+
+    void Submit(std::unique_ptr<ProgramAST> P);
+
+    /**
+     * Waits for every program submitted so far to finish and returns the
+     * time they spent, summed over the programs. Each call only counts the
+     * programs that finished since the previous one.
+     */
+    PhaseTimings Wait();
+};
+
+#endif
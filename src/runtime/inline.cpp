@@ -0,0 +1,78 @@
+// Output helpers small enough to be inlined into programs. They are compiled
+// into the host like the rest of the runtime, and at build time also to the
+// bitcode that the JIT links into every program.
+
+#include <cstring>
+
+#include "runtime/output.h"
+#include "runtime/runtime.h"
+
+// Two digits at a time halves the number of divisions
+static const char DigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536"
+    "37383940414243444546474849505152535455565758596061626364656667686970717273"
+    "7475767778798081828384858687888990919293949596979899";
+
+// Makes room for at least N bytes, which must not exceed the buffer
+static inline char *Reserve(OutputBuffer *Out, size_t N) {
+    if (Out->Size + N > OutputBufferSize) {
+        mp_flush_buffer(Out);
+    }
+    return Out->Data + Out->Size;
+}
+
+static inline void Append(OutputBuffer *Out, const char *S, size_t N) {
+    if (N > OutputBufferSize) {
+        mp_flush_buffer(Out);
+        mp_write_unbuffered(S, N);
+        return;
+    }
+    std::memcpy(Reserve(Out, N), S, N);
+    Out->Size += N;
+}
+
+extern "C" void mp_write_int(OutputBuffer *Out, int64_t V) {
+    // 20 digits and a sign
+    char *Begin = Reserve(Out, 21);
+    char Digits[20];
+    char *End = Digits + sizeof(Digits);
+    char *P = End;
+
+    uint64_t U = V < 0 ? 0 - uint64_t(V) : uint64_t(V);
+    while (U >= 100) {
+        const char *Pair = DigitPairs + (U % 100) * 2;
+        U /= 100;
+        *--P = Pair[1];
+        *--P = Pair[0];
+    }
+    if (U >= 10) {
+        *--P = DigitPairs[U * 2 + 1];
+        *--P = DigitPairs[U * 2];
+    } else {
+        *--P = char('0' + U);
+    }
+
+    char *Dst = Begin;
+    if (V < 0) {
+        *Dst++ = '-';
+    }
+    std::memcpy(Dst, P, End - P);
+    Out->Size += (Dst - Begin) + (End - P);
+}
+
+extern "C" void mp_write_bool(OutputBuffer *Out, int64_t V) {
+    if (V) {
+        Append(Out, "TRUE", 4);
+    } else {
+        Append(Out, "FALSE", 5);
+    }
+}
+
+extern "C" void mp_write_str(OutputBuffer *Out, const char *S, int64_t Len) {
+    Append(Out, S, size_t(Len));
+}
+
+extern "C" void mp_write_newline(OutputBuffer *Out) {
+    *Reserve(Out, 1) = '\n';
+    Out->Size++;
+}
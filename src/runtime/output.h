@@ -0,0 +1,27 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Per-thread output buffer. Shared by the host runtime and the helpers in
+ * inline.cpp, which are also compiled to bitcode and inlined into programs,
+ * so both sides must agree on this layout.
+ */
+static const size_t OutputBufferSize = 1 << 16;
+
+struct OutputBuffer {
+    char Data[OutputBufferSize];
+    size_t Size = 0;
+};
+
+extern "C" {
+/**
+ * Slow paths of the helpers, which stay in the host.
+ */
+void mp_flush_buffer(OutputBuffer *Out);
+void mp_write_unbuffered(const char *S, size_t Len);
+}
+
+#endif
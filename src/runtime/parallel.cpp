@@ -0,0 +1,294 @@
+// Work-stealing scheduler behind parallel for loops.
+//
+// Every worker owns a deque of iteration ranges. A worker runs its range in
+// small chunks, and whenever its deque has run dry it first splits off the
+// upper half of what is left for others to steal. Work is therefore only
+// divided while some worker could use it, which adapts the chunking to the
+// load without a tuning knob. Threads that find nothing to run spin briefly,
+// then sleep until more ranges are published or the loop is over, so a long
+// last chunk does not keep every core busy.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "runtime/runtime.h"
+
+namespace {
+
+struct Job {
+    mp_loop_body Body;
+    void *Env;
+    int OutputFD;
+    int64_t Grain;
+    std::atomic<int64_t> Remaining;
+};
+
+struct Range {
+    Job *J;
+    int64_t Lo, Hi;
+};
+
+struct WorkQueue {
+    std::mutex Mutex;
+    std::deque<Range> Ranges;
+
+    void Push(Range R) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Ranges.push_back(R);
+    }
+
+    bool Empty() {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        return Ranges.empty();
+    }
+
+    // The owner works on the most recently split, smallest range
+    bool Pop(Range &R) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Ranges.empty()) {
+            return false;
+        }
+        R = Ranges.back();
+        Ranges.pop_back();
+        return true;
+    }
+
+    // Thieves take the oldest, largest range
+    bool Steal(Range &R) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Ranges.empty()) {
+            return false;
+        }
+        R = Ranges.front();
+        Ranges.pop_front();
+        return true;
+    }
+};
+
+// One thread per core unless MP_NUM_THREADS says otherwise, counting the
+// thread that starts a loop
+unsigned ThreadCount() {
+    if (const char *Env = std::getenv("MP_NUM_THREADS")) {
+        int N = std::atoi(Env);
+        if (N > 0) {
+            return N;
+        }
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Set while a thread runs a loop body, so nested parallel loops run serially
+thread_local bool InLoopBody = false;
+
+class Scheduler {
+    // Queue 0 belongs to the thread that started the current loop
+    std::vector<std::unique_ptr<WorkQueue>> Queues;
+    std::vector<std::thread> Workers;
+
+    // Serializes loops started by different threads
+    std::mutex JobMutex;
+
+    // HasJob is polled while stealing, but only changed under Mutex so that
+    // sleeping workers cannot miss the start of a loop
+    std::mutex Mutex;
+    std::condition_variable WorkAvailable;
+    std::atomic<bool> HasJob = false;
+    bool Stop = false;
+
+    // Attempts an idle thread makes to find a range before it sleeps
+    static constexpr unsigned SpinLimit = 64;
+    // Bumped under Mutex whenever sleepers should look for work again
+    uint64_t Published = 0;
+    // Threads that may be asleep. A range pushed after one of them last
+    // looked is only published when this is nonzero.
+    std::atomic<unsigned> Sleepers = 0;
+
+    void Publish() {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Published++;
+        }
+        WorkAvailable.notify_all();
+    }
+
+    bool GetRange(unsigned Self, Range &R) {
+        if (Queues[Self]->Pop(R)) {
+            return true;
+        }
+        unsigned N = Queues.size();
+        for (unsigned I = 1; I < N; I++) {
+            if (Queues[(Self + I) % N]->Steal(R)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Execute(unsigned Self, Range R) {
+        Job *J = R.J;
+        int64_t Done = 0;
+        // Output goes where the thread that started the loop sends its own
+        int SavedFD = mp_set_output_fd(J->OutputFD);
+        InLoopBody = true;
+        while (R.Lo < R.Hi) {
+            if (R.Hi - R.Lo > 2 * J->Grain && Queues[Self]->Empty()) {
+                int64_t Mid = R.Lo + (R.Hi - R.Lo) / 2;
+                Queues[Self]->Push({J, Mid, R.Hi});
+                R.Hi = Mid;
+                if (Sleepers.load() > 0) {
+                    Publish();
+                }
+            }
+            int64_t End = std::min(R.Hi, R.Lo + J->Grain);
+            J->Body(J->Env, R.Lo, End);
+            Done += End - R.Lo;
+            R.Lo = End;
+        }
+        InLoopBody = false;
+        mp_set_output_fd(SavedFD);
+
+        // J may be gone as soon as the last iterations are accounted for
+        if (J->Remaining.fetch_sub(Done) == Done) {
+            // Wakes the thread that started the loop
+            Publish();
+        }
+    }
+
+    // Runs a range if there is one. Otherwise spins for a while, then sleeps
+    // until ranges are published or Done() holds. Done is checked under
+    // Mutex, so whatever makes it true must be followed by Publish.
+    template <typename Pred>
+    void WorkOrWait(unsigned Self, unsigned &Idle, Pred Done) {
+        Range R;
+        if (GetRange(Self, R)) {
+            Idle = 0;
+            Execute(Self, R);
+            return;
+        }
+        if (++Idle < SpinLimit) {
+            std::this_thread::yield();
+            return;
+        }
+        Idle = 0;
+
+        uint64_t Seen;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Seen = Published;
+        }
+        // A range pushed before Sleepers went up is found here, and one
+        // pushed after it is published
+        Sleepers++;
+        if (GetRange(Self, R)) {
+            Sleepers--;
+            Execute(Self, R);
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> Lock(Mutex);
+            WorkAvailable.wait(
+                Lock, [&]() { return Published != Seen || Done(); });
+        }
+        Sleepers--;
+    }
+
+    void WorkerLoop(unsigned Self) {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> Lock(Mutex);
+                WorkAvailable.wait(Lock, [this]() { return HasJob || Stop; });
+                if (Stop) {
+                    return;
+                }
+            }
+
+            unsigned Idle = 0;
+            while (HasJob.load()) {
+                WorkOrWait(Self, Idle, [this]() { return !HasJob.load(); });
+            }
+        }
+    }
+
+   public:
+    Scheduler() {
+        unsigned Threads = ThreadCount();
+        for (unsigned I = 0; I < Threads; I++) {
+            Queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (unsigned I = 1; I < Threads; I++) {
+            Workers.emplace_back([this, I]() { WorkerLoop(I); });
+        }
+    }
+
+    ~Scheduler() {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Stop = true;
+        }
+        WorkAvailable.notify_all();
+        for (auto &Worker : Workers) {
+            Worker.join();
+        }
+    }
+
+    void Run(mp_loop_body Body, void *Env, int64_t Lo, int64_t Hi) {
+        std::lock_guard<std::mutex> JobLock(JobMutex);
+
+        Job J;
+        J.Body = Body;
+        J.Env = Env;
+        J.OutputFD = mp_output_fd();
+        J.Grain = std::max<int64_t>(1, (Hi - Lo) / (64 * Queues.size()));
+        J.Remaining = Hi - Lo;
+        Queues[0]->Push({&J, Lo, Hi});
+
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            HasJob = true;
+            Published++;
+        }
+        WorkAvailable.notify_all();
+
+        // The calling thread works on the loop as well
+        unsigned Idle = 0;
+        while (J.Remaining.load() > 0) {
+            WorkOrWait(0, Idle, [&J]() { return J.Remaining.load() == 0; });
+        }
+
+        // Sends sleeping workers back to wait for the next loop
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            HasJob = false;
+        }
+        WorkAvailable.notify_all();
+    }
+};
+
+std::mutex ReduceMutex;
+
+}  // namespace
+
+extern "C" void mp_parallel_for(mp_loop_body Body, void *Env, int64_t Lo,
+                                int64_t Hi) {
+    if (Lo >= Hi) {
+        return;
+    }
+    if (InLoopBody) {
+        Body(Env, Lo, Hi);
+        return;
+    }
+
+    static Scheduler TheScheduler;
+    TheScheduler.Run(Body, Env, Lo, Hi);
+}
+
+extern "C" void mp_reduce_lock() { ReduceMutex.lock(); }
+
+extern "C" void mp_reduce_unlock() { ReduceMutex.unlock(); }
@@ -0,0 +1,226 @@
+// Counters behind --profile. Codegen brackets the body of every procedure
+// with mp_profile_enter and mp_profile_exit and ends the program with
+// mp_profile_report.
+//
+// Every thread counts into a table of its own, indexed by the ids of the
+// procedures' sites, and keeps a stack of the calls it is inside of so that
+// the cycles spent in callees can be taken out of the caller's exclusive
+// count. Nothing is shared on the way in or out of a procedure but the
+// first call through a site, which gives it an id. The report adds up the
+// tables of all threads and starts them over for the next program.
+//
+// Only one program may be profiled at a time: the report reads the other
+// threads' tables, which is only safe while they are not running any
+// profiled code, and it would mix in the counts of a concurrent program.
+// --profile is rejected with the modes that run programs concurrently.
+
+#include <time.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "runtime/runtime.h"
+
+namespace {
+
+struct Counters {
+    uint64_t Calls = 0;
+    uint64_t Inclusive = 0;
+    uint64_t Exclusive = 0;
+    // Activations on the thread's stack now, and the most there have been
+    uint64_t Depth = 0;
+    uint64_t MaxDepth = 0;
+};
+
+struct Frame {
+    int64_t Id;
+    uint64_t Start;
+    // Cycles spent in the calls made from this one
+    uint64_t Callees;
+};
+
+struct ThreadProfile {
+    std::vector<Counters> Sites;
+    std::vector<Frame> Stack;
+};
+
+std::mutex Mutex;
+// By id. Ids start at 1, as 0 marks a site that has not been called yet.
+std::vector<std::string> Names(1);
+// Kept after their threads exit, for the report
+std::vector<std::unique_ptr<ThreadProfile>> Threads;
+
+ThreadProfile &ThisThread() {
+    static thread_local ThreadProfile *Profile = nullptr;
+    if (!Profile) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Threads.push_back(std::make_unique<ThreadProfile>());
+        Profile = Threads.back().get();
+    }
+    return *Profile;
+}
+
+int64_t SiteId(mp_profile_site *Site) {
+    int64_t Id = __atomic_load_n(&Site->Id, __ATOMIC_ACQUIRE);
+    if (Id != 0) {
+        return Id;
+    }
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Id = __atomic_load_n(&Site->Id, __ATOMIC_RELAXED);
+    if (Id == 0) {
+        // Copied, as the site goes away with the program's code
+        Id = Names.size();
+        Names.push_back(Site->Name);
+        __atomic_store_n(&Site->Id, Id, __ATOMIC_RELEASE);
+    }
+    return Id;
+}
+
+// The time stamp counter where there is one, nanoseconds elsewhere
+#if defined(__x86_64__) || defined(__i386__)
+const char *CycleUnit = "cycles";
+
+uint64_t ReadCycles() { return __rdtsc(); }
+#else
+const char *CycleUnit = "ns";
+
+uint64_t ReadCycles() {
+    timespec TS;
+    clock_gettime(CLOCK_MONOTONIC, &TS);
+    return uint64_t(TS.tv_sec) * 1000000000 + TS.tv_nsec;
+}
+#endif
+
+using Entry = std::pair<std::string, Counters>;
+
+void WriteText(std::FILE *Out, const char *Program,
+               const std::vector<Entry> &Entries) {
+    uint64_t Total = 0;
+    for (auto &[Name, C] : Entries) {
+        Total += C.Exclusive;
+    }
+
+    std::fprintf(Out,
+                 "\n============================ Profile "
+                 "===========================\n");
+    std::fprintf(Out, "%s, %s\n", Program, CycleUnit);
+    std::fprintf(Out, "%-20s %12s %15s %15s %6s %6s\n", "procedure", "calls",
+                 "inclusive", "exclusive", "excl%", "depth");
+    for (auto &[Name, C] : Entries) {
+        double Share = Total ? 100.0 * C.Exclusive / Total : 0;
+        std::fprintf(Out,
+                     "%-20s %12" PRIu64 " %15" PRIu64 " %15" PRIu64
+                     " %6.1f %6" PRIu64 "\n",
+                     Name.c_str(), C.Calls, C.Inclusive, C.Exclusive, Share,
+                     C.MaxDepth);
+    }
+}
+
+// Names are identifiers, or (main), and need no escaping
+void WriteJSON(std::FILE *Out, const char *Program,
+               const std::vector<Entry> &Entries) {
+    std::fprintf(Out, "{\n  \"program\": \"%s\",\n  \"unit\": \"%s\",\n",
+                 Program, CycleUnit);
+    std::fprintf(Out, "  \"procedures\": [");
+    for (size_t i = 0; i < Entries.size(); i++) {
+        const Counters &C = Entries[i].second;
+        std::fprintf(Out,
+                     "%s\n    {\"name\": \"%s\", \"calls\": %" PRIu64
+                     ", \"inclusive\": %" PRIu64 ", \"exclusive\": %" PRIu64
+                     ", \"max_depth\": %" PRIu64 "}",
+                     i ? "," : "", Entries[i].first.c_str(), C.Calls,
+                     C.Inclusive, C.Exclusive, C.MaxDepth);
+    }
+    std::fprintf(Out, "\n  ]\n}\n");
+}
+
+}  // namespace
+
+extern "C" void mp_profile_enter(mp_profile_site *Site) {
+    ThreadProfile &T = ThisThread();
+    int64_t Id = SiteId(Site);
+    if (T.Sites.size() <= size_t(Id)) {
+        T.Sites.resize(Id + 1);
+    }
+    Counters &C = T.Sites[Id];
+    C.Calls++;
+    C.MaxDepth = std::max(C.MaxDepth, ++C.Depth);
+    T.Stack.push_back({Id, 0, 0});
+    // Last, so that none of the above is charged to the procedure
+    T.Stack.back().Start = ReadCycles();
+}
+
+extern "C" void mp_profile_exit() {
+    uint64_t End = ReadCycles();
+    ThreadProfile &T = ThisThread();
+    Frame F = T.Stack.back();
+    T.Stack.pop_back();
+
+    uint64_t Elapsed = End - F.Start;
+    Counters &C = T.Sites[F.Id];
+    // Recursive activations are part of the outermost one already
+    if (--C.Depth == 0) {
+        C.Inclusive += Elapsed;
+    }
+    C.Exclusive += Elapsed - F.Callees;
+    if (!T.Stack.empty()) {
+        T.Stack.back().Callees += Elapsed;
+    }
+}
+
+extern "C" void mp_profile_report(const char *Program, const char *JSONPath) {
+    // Sites with the same name, such as the copies tiering makes, are the
+    // same procedure
+    std::map<std::string, Counters> ByName;
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        for (auto &T : Threads) {
+            for (size_t Id = 1; Id < T->Sites.size(); Id++) {
+                Counters &C = T->Sites[Id];
+                if (C.Calls == 0) {
+                    continue;
+                }
+                Counters &Sum = ByName[Names[Id]];
+                Sum.Calls += C.Calls;
+                Sum.Inclusive += C.Inclusive;
+                Sum.Exclusive += C.Exclusive;
+                Sum.MaxDepth = std::max(Sum.MaxDepth, C.MaxDepth);
+                // The next program in this process starts from zero. Depth
+                // is left alone, as it follows the thread's stack.
+                uint64_t Depth = C.Depth;
+                C = Counters();
+                C.Depth = Depth;
+            }
+        }
+    }
+
+    std::vector<Entry> Entries(ByName.begin(), ByName.end());
+    std::stable_sort(Entries.begin(), Entries.end(),
+                     [](const Entry &A, const Entry &B) {
+                         return A.second.Exclusive > B.second.Exclusive;
+                     });
+
+    if (!JSONPath) {
+        // After the program's own output
+        mp_flush();
+        WriteText(stderr, Program, Entries);
+        return;
+    }
+    std::FILE *Out = std::fopen(JSONPath, "w");
+    if (!Out) {
+        std::perror(JSONPath);
+        return;
+    }
+    WriteJSON(Out, Program, Entries);
+    std::fclose(Out);
+}
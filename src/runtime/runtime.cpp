@@ -0,0 +1,58 @@
+#include "runtime/runtime.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+
+#include "runtime/output.h"
+
+// The thread's buffer is written out when the thread exits
+struct ThreadOutputBuffer : OutputBuffer {
+    ~ThreadOutputBuffer() { mp_flush_buffer(this); }
+};
+
+static thread_local ThreadOutputBuffer ThreadOutput;
+static thread_local int OutputFD = STDOUT_FILENO;
+
+extern "C" void mp_write_unbuffered(const char *S, size_t Len) {
+    while (Len > 0) {
+        ssize_t Written = ::write(OutputFD, S, Len);
+        if (Written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        S += Written;
+        Len -= Written;
+    }
+}
+
+extern "C" void mp_flush_buffer(OutputBuffer *Out) {
+    mp_write_unbuffered(Out->Data, Out->Size);
+    Out->Size = 0;
+}
+
+extern "C" OutputBuffer *mp_output_buffer() { return &ThreadOutput; }
+
+extern "C" void mp_write_real(OutputBuffer *Out, double V) {
+    // Shortest representation that reads back as the same double
+    if (Out->Size + 32 > OutputBufferSize) {
+        mp_flush_buffer(Out);
+    }
+    char *Begin = Out->Data + Out->Size;
+    auto Result = std::to_chars(Begin, Begin + 32, V);
+    Out->Size += Result.ptr - Begin;
+}
+
+extern "C" void mp_flush() { mp_flush_buffer(&ThreadOutput); }
+
+extern "C" int mp_set_output_fd(int FD) {
+    mp_flush_buffer(&ThreadOutput);
+    int Previous = OutputFD;
+    OutputFD = FD;
+    return Previous;
+}
+
+extern "C" int mp_output_fd() { return OutputFD; }
@@ -0,0 +1,85 @@
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include <cstdint>
+
+/**
+ * Functions called by compiled programs. The JIT resolves them in the host
+ * process; ahead-of-time executables link them from libmpruntime.a.
+ *
+ * Output goes to a per-thread buffer on stdout that is only written out when
+ * it fills up, on mp_flush() and when the thread exits. write and writeln
+ * statements fetch the buffer once and append each argument to it.
+ *
+ * The small appends are defined in inline.cpp. The JIT links those into
+ * programs from bitcode so that they can be inlined.
+ */
+extern "C" {
+struct OutputBuffer;
+
+OutputBuffer *mp_output_buffer();
+void mp_write_int(OutputBuffer *Out, int64_t V);
+void mp_write_bool(OutputBuffer *Out, int64_t V);
+void mp_write_real(OutputBuffer *Out, double V);
+void mp_write_str(OutputBuffer *Out, const char *S, int64_t Len);
+void mp_write_newline(OutputBuffer *Out);
+
+/**
+ * Writes out the calling thread's buffer.
+ */
+void mp_flush();
+
+/**
+ * Makes the calling thread write its output to FD instead, stdout by
+ * default, after flushing what it has buffered. Returns the previous file
+ * descriptor. Used by the compiler to keep the output of programs that run
+ * concurrently apart; parallel loops pass it on to their workers.
+ */
+int mp_set_output_fd(int FD);
+int mp_output_fd();
+
+/**
+ * Body of a parallel for loop, outlined by codegen. Runs iterations
+ * [Lo, Hi) with the enclosing procedure's variables reached through Env.
+ */
+typedef void (*mp_loop_body)(void *Env, int64_t Lo, int64_t Hi);
+
+/**
+ * Runs the iterations [Lo, Hi) of Body on the work-stealing thread pool and
+ * returns once all of them have finished. Loops nested in a body run
+ * serially on the calling worker.
+ */
+void mp_parallel_for(mp_loop_body Body, void *Env, int64_t Lo, int64_t Hi);
+
+/**
+ * Guards the merge of a chunk's private reduction results into the shared
+ * variables.
+ */
+void mp_reduce_lock();
+void mp_reduce_unlock();
+
+/**
+ * One per instrumented procedure, emitted by codegen for --profile. Id is 0
+ * until the procedure is first called.
+ */
+struct mp_profile_site {
+    const char *Name;
+    int64_t Id;
+};
+
+/**
+ * Bracket the body of an instrumented procedure on the calling thread.
+ * Every thread counts calls, cycles and recursion depth on its own.
+ */
+void mp_profile_enter(mp_profile_site *Site);
+void mp_profile_exit();
+
+/**
+ * Adds up the counts of all threads, sorted by exclusive cycles, and resets
+ * them. Prints a table to stderr, or writes JSON to JSONPath unless it is
+ * null.
+ */
+void mp_profile_report(const char *Program, const char *JSONPath);
+}
+
+#endif
@@ -0,0 +1,11 @@
+// Entry point of ahead-of-time compiled executables, linked from libmpstart.a
+
+#include "runtime/runtime.h"
+
+extern "C" void micropascal_main();
+
+int main() {
+    micropascal_main();
+    mp_flush();
+    return 0;
+}
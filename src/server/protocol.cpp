@@ -0,0 +1,126 @@
+#include "server/protocol.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+std::string DefaultSocketPath() {
+    if (const char *Path = std::getenv("MICROPASCAL_SOCKET")) {
+        return Path;
+    }
+    // Already private to the user where there is one
+    if (const char *Dir = std::getenv("XDG_RUNTIME_DIR")) {
+        if (*Dir) {
+            return std::string(Dir) + "/micropascal.sock";
+        }
+    }
+    // The server creates the directory with mode 0700
+    return "/tmp/micropascal-" + std::to_string(getuid()) + "/server.sock";
+}
+
+int ConnectToServer(const std::string &Path) {
+    sockaddr_un Addr = {};
+    Addr.sun_family = AF_UNIX;
+    if (Path.size() >= sizeof(Addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    std::strcpy(Addr.sun_path, Path.c_str());
+
+    int FD = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (FD < 0) {
+        return -1;
+    }
+    if (connect(FD, reinterpret_cast<sockaddr *>(&Addr), sizeof(Addr)) < 0) {
+        int Err = errno;
+        close(FD);
+        errno = Err;
+        return -1;
+    }
+    return FD;
+}
+
+bool WriteAll(int FD, const char *Data, size_t Len) {
+    while (Len > 0) {
+        ssize_t Written = write(FD, Data, Len);
+        if (Written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        Data += Written;
+        Len -= Written;
+    }
+    return true;
+}
+
+bool ReadAll(int FD, std::string &Out) {
+    char Buffer[64 * 1024];
+    while (true) {
+        ssize_t Read = read(FD, Buffer, sizeof(Buffer));
+        if (Read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (Read == 0) {
+            return true;
+        }
+        Out.append(Buffer, Read);
+    }
+}
+
+bool WriteFrame(int FD, const std::string &Kind, const std::string &Payload) {
+    std::string Header = Kind + " " + std::to_string(Payload.size()) + "\n";
+    return WriteAll(FD, Header.data(), Header.size()) &&
+           WriteAll(FD, Payload.data(), Payload.size());
+}
+
+static bool ReadExactly(int FD, char *Data, size_t Len) {
+    while (Len > 0) {
+        ssize_t Read = read(FD, Data, Len);
+        if (Read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (Read <= 0) {
+            return false;
+        }
+        Data += Read;
+        Len -= Read;
+    }
+    return true;
+}
+
+bool ReadFrame(int FD, std::string &Kind, std::string &Payload) {
+    // Headers are short, so reading them a byte at a time is fine
+    std::string Header;
+    char C;
+    while (ReadExactly(FD, &C, 1) && C != '\n') {
+        if (Header.size() > 64) {
+            return false;
+        }
+        Header += C;
+    }
+    size_t Space = Header.find(' ');
+    if (Space == std::string::npos) {
+        return false;
+    }
+
+    Kind = Header.substr(0, Space);
+    const char *Digits = Header.c_str() + Space + 1;
+    char *End;
+    errno = 0;
+    unsigned long long Len = std::strtoull(Digits, &End, 10);
+    if (End == Digits || *End != '\0' || errno == ERANGE ||
+        Len > MaxFrameBytes) {
+        return false;
+    }
+    Payload.resize(Len);
+    return ReadExactly(FD, Payload.data(), Len);
+}
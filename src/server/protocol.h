@@ -0,0 +1,53 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Wire format between the compile server and mpclient. A client connects to
+ * the server's Unix socket, sends program source and shuts down its side of
+ * the connection. The server answers with a sequence of frames, each a line
+ * "<kind> <length>" followed by length bytes of payload:
+ *
+ *   stdout   output of the programs
+ *   stderr   compiler diagnostics
+ *   timings  one "<phase> <seconds>" line per phase
+ *   status   "ok", or "error" if compilation reported errors
+ *
+ * and closes the connection after the status frame.
+ */
+
+/**
+ * $MICROPASCAL_SOCKET, or a socket in $XDG_RUNTIME_DIR, or else in a
+ * directory under /tmp private to the user
+ */
+std::string DefaultSocketPath();
+
+/**
+ * Returns a socket connected to the server at Path, or -1
+ */
+int ConnectToServer(const std::string &Path);
+
+bool WriteAll(int FD, const char *Data, size_t Len);
+
+/**
+ * Reads from FD until the other side shuts down its end
+ */
+bool ReadAll(int FD, std::string &Out);
+
+bool WriteFrame(int FD, const std::string &Kind, const std::string &Payload);
+
+/**
+ * Payloads longer than this are taken for a corrupt header rather than
+ * allocated
+ */
+constexpr size_t MaxFrameBytes = size_t(1) << 30;
+
+/**
+ * Reads the next frame. Returns false at the end of the stream or if it is
+ * malformed.
+ */
+bool ReadFrame(int FD, std::string &Kind, std::string &Payload);
+
+#endif
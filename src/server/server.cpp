@@ -0,0 +1,250 @@
+#include "server/server.h"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include "llvm/Support/raw_ostream.h"
+#include "logger/logger.h"
+#include "server/protocol.h"
+
+// Requests are served one at a time, so a client that stops sending or
+// reading must not hold the server up for longer than this
+static const int ClientTimeoutSeconds = 10;
+static const size_t MaxRequestBytes = 16 << 20;
+
+// Writes out whatever the process has buffered for stdout and stderr
+static void FlushStandardStreams() {
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(stdout);
+    std::fflush(stderr);
+    llvm::outs().flush();
+    llvm::errs().flush();
+}
+
+// Points one of the standard streams at a temporary file until Release()
+class CapturedStream {
+    int FD;
+    int Saved;
+    std::FILE *File;
+
+   public:
+    CapturedStream(int FD) : FD(FD) {
+        // Output buffered before the request must not end up in its response
+        FlushStandardStreams();
+        Saved = dup(FD);
+        File = std::tmpfile();
+        if (File) {
+            dup2(fileno(File), FD);
+        }
+    }
+
+    /**
+     * Restores the stream and returns what was written to it
+     */
+    std::string Release() {
+        FlushStandardStreams();
+        dup2(Saved, FD);
+        close(Saved);
+
+        std::string Contents;
+        if (!File) {
+            return Contents;
+        }
+        std::rewind(File);
+        char Buffer[64 * 1024];
+        size_t Read;
+        while ((Read = std::fread(Buffer, 1, sizeof(Buffer), File)) > 0) {
+            Contents.append(Buffer, Read);
+        }
+        std::fclose(File);
+        return Contents;
+    }
+};
+
+// Reads the client's source up to its shutdown, giving up once the client
+// has taken ClientTimeoutSeconds in all or sent more than MaxRequestBytes
+static bool ReadRequest(int Client, std::string &Source) {
+    auto Deadline = std::chrono::steady_clock::now() +
+                    std::chrono::seconds(ClientTimeoutSeconds);
+    char Buffer[64 * 1024];
+    while (true) {
+        auto Left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Deadline - std::chrono::steady_clock::now());
+        if (Left.count() <= 0) {
+            return false;
+        }
+        pollfd PFD = {Client, POLLIN, 0};
+        int Ready = poll(&PFD, 1, Left.count());
+        if (Ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (Ready <= 0) {
+            return false;
+        }
+
+        ssize_t Read = read(Client, Buffer, sizeof(Buffer));
+        if (Read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (Read < 0) {
+            return false;
+        }
+        if (Read == 0) {
+            return true;
+        }
+        Source.append(Buffer, Read);
+        if (Source.size() > MaxRequestBytes) {
+            return false;
+        }
+    }
+}
+
+static void HandleClient(int Client, RequestHandler &Handle) {
+    // Bounds how long responses may take to write to a client that does
+    // not read them
+    timeval Timeout = {ClientTimeoutSeconds, 0};
+    setsockopt(Client, SOL_SOCKET, SO_SNDTIMEO, &Timeout, sizeof(Timeout));
+
+    std::string Source;
+    if (!ReadRequest(Client, Source)) {
+        std::cerr << "serve: dropped a client that did not finish its "
+                     "request\n";
+        return;
+    }
+    // Ends the last token even if the source does not, and keeps the buffer
+    // non-empty for fmemopen
+    Source += '\n';
+
+    std::FILE *In = fmemopen(Source.data(), Source.size(), "r");
+    if (!In) {
+        WriteFrame(Client, "stderr", std::strerror(errno));
+        WriteFrame(Client, "status", "error");
+        return;
+    }
+
+    unsigned ErrorsBefore = GetErrorCount();
+    auto Start = std::chrono::steady_clock::now();
+    CapturedStream Out(STDOUT_FILENO);
+    CapturedStream Err(STDERR_FILENO);
+    PhaseTimings T = Handle(In);
+    std::string Output = Out.Release();
+    std::string Diagnostics = Err.Release();
+    std::chrono::duration<double> Total =
+        std::chrono::steady_clock::now() - Start;
+    std::fclose(In);
+
+    std::ostringstream Timings;
+    Timings << "parse " << T.Parse << "\n"
+            << "codegen " << T.Codegen << "\n"
+            << "link " << T.Link << "\n"
+            << "execute " << T.Execute << "\n"
+            << "total " << Total.count() << "\n";
+
+    // These only fail if the client has gone away, which is its business
+    bool Failed = GetErrorCount() != ErrorsBefore;
+    WriteFrame(Client, "stdout", Output);
+    WriteFrame(Client, "stderr", Diagnostics);
+    WriteFrame(Client, "timings", Timings.str());
+    WriteFrame(Client, "status", Failed ? "error" : "ok");
+}
+
+// Whoever can write to the socket's directory can replace the socket, so it
+// must belong to the user or root. A missing directory is created private.
+static bool CheckSocketDirectory(const std::string &Path) {
+    size_t Slash = Path.rfind('/');
+    std::string Dir = Slash == std::string::npos ? "."
+                      : Slash == 0              ? "/"
+                                                : Path.substr(0, Slash);
+    if (mkdir(Dir.c_str(), 0700) == 0) {
+        return true;
+    }
+    if (errno != EEXIST) {
+        std::perror(("serve: " + Dir).c_str());
+        return false;
+    }
+    struct stat St;
+    if (stat(Dir.c_str(), &St) < 0) {
+        std::perror(("serve: " + Dir).c_str());
+        return false;
+    }
+    if (!S_ISDIR(St.st_mode) || (St.st_uid != getuid() && St.st_uid != 0)) {
+        std::cerr << "serve: " << Dir
+                  << " is not a directory owned by this user\n";
+        return false;
+    }
+    return true;
+}
+
+int Serve(const std::string &Path, RequestHandler Handle) {
+    // A client that hangs up early must not take the server down with it
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un Addr = {};
+    Addr.sun_family = AF_UNIX;
+    if (Path.size() >= sizeof(Addr.sun_path)) {
+        std::cerr << "serve: socket path is too long: " << Path << "\n";
+        return 1;
+    }
+    std::strcpy(Addr.sun_path, Path.c_str());
+
+    if (!CheckSocketDirectory(Path)) {
+        return 1;
+    }
+    struct stat St;
+    if (lstat(Path.c_str(), &St) == 0) {
+        if (!S_ISSOCK(St.st_mode)) {
+            std::cerr << "serve: " << Path << " exists and is not a socket\n";
+            return 1;
+        }
+        int Live = ConnectToServer(Path);
+        if (Live >= 0) {
+            close(Live);
+            std::cerr << "serve: a server is already listening on " << Path
+                      << "\n";
+            return 1;
+        }
+        // Left behind by a server that did not shut down cleanly
+        unlink(Path.c_str());
+    }
+
+    int Listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (Listener < 0) {
+        std::perror("serve: socket");
+        return 1;
+    }
+    // Clients run code in this process, so only the user may connect
+    mode_t OldMask = umask(077);
+    int Bound =
+        bind(Listener, reinterpret_cast<sockaddr *>(&Addr), sizeof(Addr));
+    umask(OldMask);
+    if (Bound < 0 || listen(Listener, SOMAXCONN) < 0) {
+        std::perror(("serve: " + Path).c_str());
+        return 1;
+    }
+    std::cerr << "serving on " << Path << "\n";
+
+    while (true) {
+        int Client = accept(Listener, nullptr, nullptr);
+        if (Client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            std::perror("serve: accept");
+            return 1;
+        }
+        HandleClient(Client, Handle);
+        close(Client);
+    }
+}
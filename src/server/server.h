@@ -0,0 +1,27 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "codegen/codegen.h"
+
+/**
+ * Compiles and runs every program in Source and returns the time spent on
+ * them
+ */
+typedef std::function<PhaseTimings(std::FILE *Source)> RequestHandler;
+
+/**
+ * Accepts mpclient connections on the Unix socket at Path and passes each
+ * request to Handle, one at a time. The process's stdout and stderr are
+ * captured while a request runs and sent back to its client, so the JIT and
+ * everything set up with it stay warm across requests. A client that has
+ * not sent its whole request within a few seconds is disconnected, so that
+ * it cannot hold up the ones behind it. Only returns if the socket cannot
+ * be set up.
+ */
+int Serve(const std::string &Path, RequestHandler Handle);
+
+#endif
@@ -0,0 +1,200 @@
+#include "session/session.h"
+
+#include <iostream>
+
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "logger/logger.h"
+#include "runtime/runtime.h"
+
+using namespace llvm;
+
+static std::vector<VarType> GetParamTypes(const PrototypeAST &Proto) {
+    std::vector<VarType> Params;
+    for (auto &Decl : Proto.GetParameters()) {
+        Params.insert(Params.end(), Decl->GetVarNames().size(),
+                      Decl->GetType());
+    }
+    return Params;
+}
+
+ReplSession::ReplSession(orc::KaleidoscopeJIT &TheJIT)
+    : TheJIT(TheJIT),
+      SessionJD(
+          TheJIT.getExecutionSession().createBareJITDylib("<session>")) {
+    // Session procedures find the runtime through the main dylib, and
+    // programs find session procedures through the session dylib
+    SessionJD.addToLinkOrder(TheJIT.getMainJITDylib());
+    TheJIT.getMainJITDylib().addToLinkOrder(SessionJD);
+
+    ExitOnError ExitOnErr;
+    Compiler = std::make_unique<CompilerSession>(
+        ExitOnErr(TheJIT.createTargetMachine()));
+}
+
+std::set<std::string> ReplSession::Dependents(
+    const std::set<std::string> &Names) {
+    std::set<std::string> Changed = Names;
+    std::set<std::string> Result;
+
+    bool Grew = true;
+    while (Grew) {
+        Grew = false;
+        for (auto &[Name, Proc] : Procedures) {
+            if (Changed.count(Name)) {
+                continue;
+            }
+            for (auto &Callee : Proc.Callees) {
+                if (Changed.count(Callee)) {
+                    Changed.insert(Name);
+                    Result.insert(Name);
+                    Grew = true;
+                    break;
+                }
+            }
+        }
+    }
+    return Result;
+}
+
+Error ReplSession::Link(Procedure &P) {
+    auto TSM = LoadBitcode(P.Bitcode);
+    if (!TSM) {
+        return TSM.takeError();
+    }
+    P.RT = SessionJD.createResourceTracker();
+    return TheJIT.addModule(std::move(*TSM), P.RT);
+}
+
+void ReplSession::RunProgram(std::unique_ptr<ProgramAST> P, bool Redefine) {
+    ExitOnError ExitOnErr;
+
+    ProcedureTable Defined;
+    for (auto &Func : P->GetFunctions()) {
+        const PrototypeAST &Proto = Func->GetPrototype();
+        Defined[Proto.GetName()] = GetParamTypes(Proto);
+    }
+
+    std::set<std::string> Replaced;
+    for (auto &[Name, Params] : Defined) {
+        if (!Procedures.count(Name)) {
+            continue;
+        }
+        if (!Redefine) {
+            std::string Msg = "Procedure '" + Name +
+                              "' is already defined in this session, use "
+                              "'redefine program' to replace it";
+            LogError(Msg.c_str());
+            return;
+        }
+        Replaced.insert(Name);
+    }
+
+    // Callers of a replaced procedure are relinked against the new body,
+    // which is only sound if its parameters did not change
+    std::set<std::string> Relinked = Dependents(Replaced);
+    for (auto &Name : Relinked) {
+        for (auto &Callee : Procedures[Name].Callees) {
+            if (Replaced.count(Callee) &&
+                Procedures[Callee].Params != Defined[Callee]) {
+                std::string Msg = "Cannot change the parameters of '" +
+                                  Callee + "' while '" + Name + "' calls it";
+                LogError(Msg.c_str());
+                return;
+            }
+        }
+    }
+
+    CodeGen CG(Compiler.get());
+    for (auto &[Name, Proc] : Procedures) {
+        if (!Defined.count(Name)) {
+            CG.DeclareProcedure(Name, Proc.Params);
+        }
+    }
+    unsigned ErrorsBefore = GetThreadErrorCount();
+    CG.Generate(std::move(P), TheJIT.getDataLayout(), true);
+    // Nothing has been unlinked yet, so the session keeps the old bodies
+    if (GetThreadErrorCount() != ErrorsBefore) {
+        LogError("Program not run, session procedures are unchanged");
+        return;
+    }
+    Module &M = CG.GetModule();
+
+    std::map<std::string, std::set<std::string>> Callees;
+    for (Function &F : M) {
+        if (F.isDeclaration()) {
+            continue;
+        }
+        for (Instruction &I : instructions(F)) {
+            auto *Call = dyn_cast<CallInst>(&I);
+            if (!Call || !Call->getCalledFunction()) {
+                continue;
+            }
+            std::string Callee = Call->getCalledFunction()->getName().str();
+            // Calls from the outlined body of a parallel for belong to the
+            // procedure it was outlined from
+            if (Procedures.count(Callee) || Defined.count(Callee)) {
+                Callees[F.getName().split('.').first.str()].insert(Callee);
+            }
+        }
+    }
+
+    for (auto &Name : Relinked) {
+        ExitOnErr(Procedures[Name].RT->remove());
+    }
+    for (auto &Name : Replaced) {
+        ExitOnErr(Procedures[Name].RT->remove());
+        Procedures.erase(Name);
+    }
+
+    auto RT = TheJIT.getMainJITDylib().createResourceTracker();
+    for (auto &PB : SplitPerProcedure(M)) {
+        if (PB.Name == "micropascal_main") {
+            ExitOnErr(TheJIT.addModule(ExitOnErr(LoadBitcode(PB)), RT));
+            continue;
+        }
+
+        Procedure &Proc = Procedures[PB.Name];
+        Proc.Params = Defined[PB.Name];
+        Proc.Callees = Callees[PB.Name];
+        Proc.Bitcode = std::move(PB);
+        ExitOnErr(Link(Proc));
+    }
+    for (auto &Name : Relinked) {
+        ExitOnErr(Link(Procedures[Name]));
+    }
+
+    auto ExprSymbol = ExitOnErr(TheJIT.lookup("micropascal_main"));
+
+    std::cerr << "\n";
+    std::cerr
+        << "============================ Result ============================\n";
+    void (*FP)() = ExprSymbol.getAddress().toPtr<void (*)()>();
+    FP();
+    mp_flush();
+
+    ExitOnErr(RT->remove());
+}
+
+void ReplSession::Unload(const std::string &Name) {
+    auto It = Procedures.find(Name);
+    if (It == Procedures.end()) {
+        std::string Msg = "Unknown session procedure '" + Name + "'";
+        LogError(Msg.c_str());
+        return;
+    }
+
+    for (auto &[Caller, Proc] : Procedures) {
+        if (Caller != Name && Proc.Callees.count(Name)) {
+            std::string Msg = "Cannot unload '" + Name + "' while '" +
+                              Caller + "' calls it";
+            LogError(Msg.c_str());
+            return;
+        }
+    }
+
+    ExitOnError ExitOnErr;
+    ExitOnErr(It->second.RT->remove());
+    Procedures.erase(It);
+    std::cerr << "Unloaded '" << Name << "'\n";
+}
@@ -0,0 +1,55 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ast/ast.h"
+#include "codegen/codegen.h"
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+
+/**
+ * A REPL session in which procedures outlive the program that defined them.
+ *
+ * Procedures are kept in a session JITDylib, one ResourceTracker each, and are
+ * declared to every later program so they can be called without being
+ * defined again. Only micropascal_main is removed after a program has run.
+ */
+class ReplSession {
+    struct Procedure {
+        std::vector<VarType> Params;
+        // Session procedures this one calls
+        std::set<std::string> Callees;
+        // Kept so that the procedure can be relinked when a callee changes
+        ProcedureBitcode Bitcode;
+        llvm::orc::ResourceTrackerSP RT;
+    };
+
+    llvm::orc::KaleidoscopeJIT &TheJIT;
+    llvm::orc::JITDylib &SessionJD;
+    std::map<std::string, Procedure> Procedures;
+    std::unique_ptr<CompilerSession> Compiler;
+
+    std::set<std::string> Dependents(const std::set<std::string> &Names);
+    llvm::Error Link(Procedure &P);
+
+   public:
+    ReplSession(llvm::orc::KaleidoscopeJIT &TheJIT);
+
+    /**
+     * Compiles and runs P. Procedures it defines are added to the session;
+     * replacing an existing procedure requires Redefine.
+     */
+    void RunProgram(std::unique_ptr<ProgramAST> P, bool Redefine);
+
+    /**
+     * Removes a procedure from the session. Fails while other session
+     * procedures still call it.
+     */
+    void Unload(const std::string &Name);
+};
+
+#endif
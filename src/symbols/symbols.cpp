@@ -0,0 +1,57 @@
+#include "symbols/symbols.h"
+
+#include <cstring>
+
+#include "runtime/output.h"
+#include "runtime/runtime.h"
+#include "tiering/tiering.h"
+
+using namespace llvm;
+
+struct RuntimeSymbol {
+    const char *Name;
+    void *Address;
+};
+
+static const RuntimeSymbol RuntimeSymbols[] = {
+    // Output, see runtime.h
+    {"mp_output_buffer", reinterpret_cast<void *>(&mp_output_buffer)},
+    {"mp_write_int", reinterpret_cast<void *>(&mp_write_int)},
+    {"mp_write_bool", reinterpret_cast<void *>(&mp_write_bool)},
+    {"mp_write_real", reinterpret_cast<void *>(&mp_write_real)},
+    {"mp_write_str", reinterpret_cast<void *>(&mp_write_str)},
+    {"mp_write_newline", reinterpret_cast<void *>(&mp_write_newline)},
+    {"mp_flush_buffer", reinterpret_cast<void *>(&mp_flush_buffer)},
+    {"mp_write_unbuffered", reinterpret_cast<void *>(&mp_write_unbuffered)},
+    {"mp_flush", reinterpret_cast<void *>(&mp_flush)},
+
+    // Parallel for loops
+    {"mp_parallel_for", reinterpret_cast<void *>(&mp_parallel_for)},
+    {"mp_reduce_lock", reinterpret_cast<void *>(&mp_reduce_lock)},
+    {"mp_reduce_unlock", reinterpret_cast<void *>(&mp_reduce_unlock)},
+
+    // --profile counters
+    {"mp_profile_enter", reinterpret_cast<void *>(&mp_profile_enter)},
+    {"mp_profile_exit", reinterpret_cast<void *>(&mp_profile_exit)},
+    {"mp_profile_report", reinterpret_cast<void *>(&mp_profile_report)},
+
+    // Tier-up requests from baseline code
+    {"micropascal_tier_up", reinterpret_cast<void *>(&micropascal_tier_up)},
+
+    // Library calls that LLVM may emit for memory intrinsics
+    {"memcpy", reinterpret_cast<void *>(&memcpy)},
+    {"memmove", reinterpret_cast<void *>(&memmove)},
+    {"memset", reinterpret_cast<void *>(&memset)},
+    {"memcmp", reinterpret_cast<void *>(&memcmp)},
+};
+
+Error DefineRuntimeSymbols(orc::KaleidoscopeJIT &TheJIT) {
+    orc::SymbolMap Symbols;
+    for (const RuntimeSymbol &Symbol : RuntimeSymbols) {
+        Symbols[TheJIT.mangle(Symbol.Name)] = orc::ExecutorSymbolDef(
+            orc::ExecutorAddr::fromPtr(Symbol.Address),
+            JITSymbolFlags::Exported | JITSymbolFlags::Callable);
+    }
+    return TheJIT.getMainJITDylib().define(
+        orc::absoluteSymbols(std::move(Symbols)));
+}
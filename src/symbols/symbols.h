@@ -0,0 +1,15 @@
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "llvm/Support/Error.h"
+
+/**
+ * Defines every host function that compiled programs may call as an absolute
+ * symbol in the JIT's main dylib. This is what JIT code links against, so a
+ * function added to the runtime must also be added to the table in
+ * symbols.cpp.
+ */
+llvm::Error DefineRuntimeSymbols(llvm::orc::KaleidoscopeJIT &TheJIT);
+
+#endif
@@ -0,0 +1,233 @@
+#include "tiering/tiering.h"
+
+#include <iostream>
+
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/BasicBlockUtils.h"
+
+using namespace llvm;
+
+static const char *BaselineSuffix = ".t0";
+static const char *OptimizedSuffix = ".t1";
+
+extern "C" void micropascal_tier_up(TieredProgram *P, uint64_t Id) {
+    P->Promote(Id);
+}
+
+static void LogTierUpError(Error Err, const std::string &Name) {
+    logAllUnhandledErrors(std::move(Err), errs(),
+                          "tier-up of '" + Name + "' failed: ");
+}
+
+TieredProgram::TieredProgram(orc::KaleidoscopeJIT &TheJIT,
+                             orc::ResourceTrackerSP RT, unsigned OptLevel,
+                             uint64_t Threshold)
+    : TheJIT(TheJIT),
+      RT(std::move(RT)),
+      ISM(orc::createLocalIndirectStubsManagerBuilder(
+          TheJIT.getTargetTriple())()),
+      OptLevel(OptLevel),
+      Threshold(Threshold) {}
+
+TieredProgram::~TieredProgram() { WaitForPromotions(); }
+
+void TieredProgram::RewriteForStubs(Module &M) {
+    std::vector<Function *> Bodies;
+    for (Function &F : M) {
+        if (!F.isDeclaration() && !F.hasLocalLinkage() &&
+            F.getName() != "micropascal_main") {
+            Bodies.push_back(&F);
+        }
+    }
+
+    // Rename each body and route every call, including recursive ones,
+    // through a declaration that resolves to the procedure's stub
+    for (Function *Body : Bodies) {
+        std::string Name = Body->getName().str();
+        Body->setName(Name + BaselineSuffix);
+        Function *Stub = Function::Create(Body->getFunctionType(),
+                                          Function::ExternalLinkage, Name, M);
+        Body->replaceAllUsesWith(Stub);
+        Procedures.push_back(Name);
+    }
+}
+
+void TieredProgram::InjectCounters(Module &M) {
+    LLVMContext &Ctx = M.getContext();
+    Type *Int64Ty = Type::getInt64Ty(Ctx);
+    PointerType *PtrTy = PointerType::getUnqual(Ctx);
+
+    FunctionCallee TierUp = M.getOrInsertFunction(
+        "micropascal_tier_up", Type::getVoidTy(Ctx), PtrTy, Int64Ty);
+    Constant *Handle = ConstantExpr::getIntToPtr(
+        ConstantInt::get(Int64Ty, reinterpret_cast<uintptr_t>(this)), PtrTy);
+
+    for (uint64_t Id = 0; Id < Procedures.size(); Id++) {
+        Function *Body = M.getFunction(Procedures[Id] + BaselineSuffix);
+        auto *Counter = new GlobalVariable(
+            M, Int64Ty, false, GlobalValue::InternalLinkage,
+            ConstantInt::get(Int64Ty, 0), Procedures[Id] + ".calls");
+
+        BasicBlock &Entry = Body->getEntryBlock();
+        IRBuilder<> Builder(&Entry, Entry.getFirstInsertionPt());
+
+        // The increment is deliberately not atomic. Racing callers can only
+        // both observe the threshold, and Promote() ignores the second one.
+        Value *Count = Builder.CreateLoad(Int64Ty, Counter);
+        Count = Builder.CreateAdd(Count, ConstantInt::get(Int64Ty, 1));
+        Builder.CreateStore(Count, Counter);
+        Value *IsHot =
+            Builder.CreateICmpEQ(Count, ConstantInt::get(Int64Ty, Threshold));
+
+        Instruction *Then =
+            SplitBlockAndInsertIfThen(IsHot, &*Builder.GetInsertPoint(), false);
+        Builder.SetInsertPoint(Then);
+        Builder.CreateCall(TierUp, {Handle, ConstantInt::get(Int64Ty, Id)});
+    }
+}
+
+Error TieredProgram::Add(orc::ThreadSafeModule TSM) {
+    TSM.withModuleDo([this](Module &M) {
+        RewriteForStubs(M);
+
+        raw_svector_ostream OS(Snapshot);
+        WriteBitcodeToFile(M, OS);
+        Promoted = std::make_unique<std::atomic<bool>[]>(Procedures.size());
+
+        InjectCounters(M);
+    });
+
+    // Stubs start out null and are pointed at the baseline bodies once those
+    // have been compiled
+    orc::SymbolMap StubSymbols;
+    for (auto &Name : Procedures) {
+        if (auto Err = ISM->createStub(Name, orc::ExecutorAddr(),
+                                       JITSymbolFlags::Exported)) {
+            return Err;
+        }
+        auto Stub = ISM->findStub(Name, true);
+        StubSymbols[TheJIT.mangle(Name)] = orc::ExecutorSymbolDef(
+            Stub.getAddress(),
+            JITSymbolFlags::Exported | JITSymbolFlags::Callable);
+    }
+
+    if (!StubSymbols.empty()) {
+        if (auto Err = TheJIT.getMainJITDylib().define(
+                orc::absoluteSymbols(std::move(StubSymbols)), RT)) {
+            return Err;
+        }
+    }
+
+    if (auto Err = TheJIT.addModule(
+            std::move(TSM), RT, orc::KaleidoscopeJIT::CompileTier::Baseline)) {
+        return Err;
+    }
+
+    for (auto &Name : Procedures) {
+        auto Sym = TheJIT.lookup(Name + BaselineSuffix);
+        if (!Sym) {
+            return Sym.takeError();
+        }
+        if (auto Err = ISM->updatePointer(Name, Sym->getAddress())) {
+            return Err;
+        }
+    }
+
+    return Error::success();
+}
+
+void TieredProgram::Promote(uint64_t Id) {
+    if (Promoted[Id].exchange(true)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock(WorkersMutex);
+    Workers.emplace_back([this, Id]() { Reoptimize(Id); });
+}
+
+void TieredProgram::Reoptimize(uint64_t Id) {
+    const std::string &Name = Procedures[Id];
+
+    auto Ctx = std::make_unique<LLVMContext>();
+    auto M = parseBitcodeFile(
+        MemoryBufferRef(StringRef(Snapshot.data(), Snapshot.size()),
+                        "micropascal.tier1"),
+        *Ctx);
+    if (!M) {
+        LogTierUpError(M.takeError(), Name);
+        return;
+    }
+
+    // Only the hot procedure is re-optimized; everything else, including
+    // its callees, stays reachable through the stubs. Internal runtime
+    // helpers are kept so that they can be inlined.
+    std::string BodyName = Name + BaselineSuffix;
+    for (Function &F : **M) {
+        if (!F.isDeclaration() && !F.hasLocalLinkage() &&
+            F.getName() != BodyName) {
+            F.deleteBody();
+        }
+    }
+    (*M)->getFunction(BodyName)->setName(Name + OptimizedSuffix);
+
+    LoopAnalysisManager LAM;
+    FunctionAnalysisManager FAM;
+    CGSCCAnalysisManager CGAM;
+    ModuleAnalysisManager MAM;
+
+    // Give the pipeline the JIT's target so the vectorizers and cost models
+    // see the host's real vector width
+    auto TM = TheJIT.createTargetMachine();
+    if (!TM) {
+        LogTierUpError(TM.takeError(), Name);
+        return;
+    }
+
+    PassBuilder PB(TM->get());
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    ModulePassManager MPM = PB.buildPerModuleDefaultPipeline(
+        OptLevel >= 3 ? OptimizationLevel::O3 : OptimizationLevel::O2);
+    MPM.run(**M, MAM);
+
+    if (auto Err = TheJIT.addModule(
+            orc::ThreadSafeModule(std::move(*M), std::move(Ctx)), RT,
+            orc::KaleidoscopeJIT::CompileTier::Optimized)) {
+        LogTierUpError(std::move(Err), Name);
+        return;
+    }
+
+    auto Sym = TheJIT.lookup(Name + OptimizedSuffix);
+    if (!Sym) {
+        LogTierUpError(Sym.takeError(), Name);
+        return;
+    }
+
+    if (auto Err = ISM->updatePointer(Name, Sym->getAddress())) {
+        LogTierUpError(std::move(Err), Name);
+        return;
+    }
+
+    std::cerr << "tier-up: '" << Name << "' re-optimized at -O" << OptLevel
+              << "\n";
+}
+
+void TieredProgram::WaitForPromotions() {
+    std::vector<std::thread> Pending;
+    {
+        std::lock_guard<std::mutex> Lock(WorkersMutex);
+        Pending.swap(Workers);
+    }
+
+    for (auto &Worker : Pending) {
+        Worker.join();
+    }
+}
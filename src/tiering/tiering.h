@@ -0,0 +1,73 @@
+#ifndef TIERING_H
+#define TIERING_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "kaleidoscopejit/KaleidoscopeJIT.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ExecutionEngine/Orc/IndirectionUtils.h"
+#include "llvm/IR/Module.h"
+
+/**
+ * Runs one program through two execution tiers.
+ *
+ * Every procedure is first compiled through the JIT's baseline layer and
+ * called through an indirection stub. A counter at procedure entry calls back
+ * into the runtime once it reaches the threshold, and the procedure is then
+ * re-optimized on a background thread and its stub repointed at the new body.
+ */
+class TieredProgram {
+    llvm::orc::KaleidoscopeJIT &TheJIT;
+    llvm::orc::ResourceTrackerSP RT;
+    std::unique_ptr<llvm::orc::IndirectStubsManager> ISM;
+    unsigned OptLevel;
+    uint64_t Threshold;
+
+    // Module after stub rewriting but before counters were injected. Hot
+    // procedures are re-optimized from this snapshot.
+    llvm::SmallVector<char, 0> Snapshot;
+    std::vector<std::string> Procedures;
+    std::unique_ptr<std::atomic<bool>[]> Promoted;
+
+    std::mutex WorkersMutex;
+    std::vector<std::thread> Workers;
+
+    void RewriteForStubs(llvm::Module &M);
+    void InjectCounters(llvm::Module &M);
+    void Reoptimize(uint64_t Id);
+
+   public:
+    TieredProgram(llvm::orc::KaleidoscopeJIT &TheJIT,
+                  llvm::orc::ResourceTrackerSP RT, unsigned OptLevel,
+                  uint64_t Threshold);
+    ~TieredProgram();
+
+    /**
+     * Adds a freshly generated module at the baseline tier. The module must
+     * not have been run through TheFPM.
+     */
+    llvm::Error Add(llvm::orc::ThreadSafeModule TSM);
+
+    /**
+     * Called from JIT-compiled code when procedure Id becomes hot.
+     */
+    void Promote(uint64_t Id);
+
+    /**
+     * Blocks until all background re-optimizations have finished. Must be
+     * called before the program's resource tracker is removed.
+     */
+    void WaitForPromotions();
+};
+
+/**
+ * Called by the entry counter of a baseline procedure once it becomes hot.
+ */
+extern "C" void micropascal_tier_up(TieredProgram *P, uint64_t Id);
+
+#endif